@@ -1,133 +1,15 @@
-////////////////////////////////////////////////////////////////////////////////////////
-//                                                                                    //
-// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //
-//                                                                                    //
-// more info and bugs-report:  github.com/raysan5/raylib                              //
-// feedback and support:       ray[at]raylib.com                                      //
-//                                                                                    //
-// Copyright (c) 2018-2023 Ramon Santamaria (@raysan5)                                //
-//                                                                                    //
-////////////////////////////////////////////////////////////////////////////////////////
+// Generated by tools/assets.c from assets/TrashIcon.png, do not edit
 
-// Image data information
-#define TRASHICON_WIDTH    24
-#define TRASHICON_HEIGHT   24
-#define TRASHICON_FORMAT   7          // raylib internal pixel format
+#define TRASHICON_WIDTH 24
+#define TRASHICON_HEIGHT 24
+#define TRASHICON_FORMAT 7
+#define TRASHICON_SIZE 2304
+// zero when the data is not compressed
+#define TRASHICON_COMPRESSED_SIZE 57
 
-static unsigned char TRASHICON_DATA[2304] = { 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
-0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
-0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff,
-0x7a, 0x7a, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xff, 0x7a, 0x7a, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6,
-0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0xe6, 0x29, 0x37, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0 };
+static const unsigned char TRASHICON_DATA[57] = {
+	0x63, 0x60, 0x18, 0x05, 0x43, 0x01, 0x3c, 0xd3, 0x34, 0xff, 0x8f, 0x8c, 0x07, 0xab, 0xf9, 0xe8,
+	0xe6, 0x90, 0x8a, 0x07, 0xda, 0x7c, 0x64, 0x7b, 0xfe, 0x57, 0x55, 0x81, 0x31, 0x4c, 0x2f, 0x3e,
+	0x3e, 0x39, 0xe1, 0x34, 0x6a, 0xfe, 0xa8, 0xf9, 0xa3, 0xe6, 0xd3, 0xce, 0x7c, 0x5a, 0x94, 0x0b,
+	0xe4, 0xd8, 0x31, 0x5a, 0x7b, 0x0d, 0x5e, 0x00, 0x00,
+};
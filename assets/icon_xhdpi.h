@@ -1,1861 +1,46 @@
-////////////////////////////////////////////////////////////////////////////////////////
-//                                                                                    //
-// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //
-//                                                                                    //
-// more info and bugs-report:  github.com/raysan5/raylib                              //
-// feedback and support:       ray[at]raylib.com                                      //
-//                                                                                    //
-// Copyright (c) 2018-2023 Ramon Santamaria (@raysan5)                                //
-//                                                                                    //
-////////////////////////////////////////////////////////////////////////////////////////
+// Generated by tools/assets.c from assets/icon_xhdpi.png, do not edit
 
-// Image data information
-#define WINDOWICON_WIDTH    96
-#define WINDOWICON_HEIGHT   96
-#define WINDOWICON_FORMAT   7          // raylib internal pixel format
+#define WINDOWICON_WIDTH 96
+#define WINDOWICON_HEIGHT 96
+#define WINDOWICON_FORMAT 7
+#define WINDOWICON_SIZE 36864
+// zero when the data is not compressed
+#define WINDOWICON_COMPRESSED_SIZE 560
 
-static unsigned char WINDOWICON_DATA[36864] = { 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x9d, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x9d, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x1, 0x0, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x2, 0x0, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x9, 0x1, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0,
-0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x0, 0x9e, 0x2f, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x16, 0x9, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x4,
-0x1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x1,
-0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x1, 0x5, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x3,
-0x1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0,
-0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x1,
-0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x0,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x1, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff, 0x5, 0x2, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0x1,
-0x79, 0xf1, 0xff, 0x1, 0x79, 0xf1, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff,
-0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0xff, 0xa1, 0x0, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0 };
+static const unsigned char WINDOWICON_DATA[560] = {
+	0xed, 0xdd, 0x51, 0x4e, 0x02, 0x41, 0x10, 0x84, 0xe1, 0x19, 0x94, 0x07, 0x2f, 0xe0, 0x35, 0x3c,
+	0x9f, 0x87, 0xd1, 0xc4, 0x23, 0xfa, 0xc0, 0x1b, 0xd0, 0xba, 0x51, 0x0c, 0x11, 0x04, 0x76, 0x9d,
+	0x99, 0xae, 0xea, 0xae, 0x4a, 0x3a, 0xbe, 0x7f, 0xff, 0x06, 0x49, 0x34, 0xd9, 0x52, 0xf0, 0x66,
+	0x33, 0x57, 0x5e, 0x9f, 0x6e, 0x3b, 0xad, 0x89, 0xf7, 0x62, 0x7f, 0xf5, 0x68, 0x66, 0xde, 0xc4,
+	0x3f, 0x61, 0x0b, 0xeb, 0xb0, 0x26, 0xfe, 0xc1, 0x3b, 0x58, 0xc7, 0x35, 0xf5, 0x0f, 0xd6, 0xc1,
+	0x06, 0xac, 0x8b, 0x3f, 0x79, 0x07, 0x1b, 0xb8, 0xae, 0xfe, 0x84, 0x1d, 0x6c, 0xf0, 0x86, 0xf8,
+	0x13, 0x34, 0x30, 0xa7, 0x0d, 0xf3, 0x07, 0xee, 0x60, 0x8e, 0x1b, 0xee, 0x0f, 0xd6, 0xc0, 0x9c,
+	0xe7, 0xe2, 0x0f, 0xd2, 0xc0, 0x00, 0xe6, 0xe6, 0xef, 0xd8, 0xc0, 0x80, 0xe6, 0xea, 0xef, 0xd0,
+	0xc1, 0xc0, 0x06, 0xe1, 0x3f, 0xa8, 0x81, 0x01, 0x0e, 0xc6, 0x7f, 0x40, 0x03, 0xf9, 0xfb, 0xf9,
+	0x1b, 0xe8, 0xa0, 0xfc, 0x3b, 0x35, 0x30, 0xe0, 0xc1, 0xf9, 0x37, 0x6e, 0x60, 0xe0, 0x83, 0xf4,
+	0x6f, 0xd4, 0xc0, 0x08, 0x06, 0xeb, 0xdf, 0xa0, 0x81, 0xfc, 0xfd, 0xfc, 0x8d, 0x64, 0xd0, 0xfe,
+	0x0b, 0x1b, 0x18, 0xd1, 0xe0, 0xfd, 0x17, 0x34, 0x90, 0xbf, 0x9f, 0xbf, 0x91, 0x8d, 0xc2, 0x7f,
+	0x46, 0x03, 0x26, 0xfb, 0xcd, 0x66, 0x13, 0xca, 0xdf, 0x08, 0x47, 0xe3, 0x7f, 0x43, 0x03, 0xf9,
+	0xfb, 0xf9, 0x1b, 0xe9, 0xa8, 0xfc, 0x2f, 0x34, 0x90, 0xbf, 0x9f, 0xbf, 0x11, 0x8f, 0xce, 0xff,
+	0x4c, 0x03, 0xf9, 0xcb, 0x3f, 0xab, 0xbf, 0x91, 0x8f, 0xd2, 0xff, 0xa8, 0x81, 0xfc, 0xe5, 0x2f,
+	0x7f, 0xf9, 0x7b, 0xf8, 0x5b, 0x80, 0xd1, 0xfa, 0x7f, 0x1e, 0xdb, 0x76, 0xbb, 0xdd, 0xf4, 0xdc,
+	0xfc, 0x7d, 0xf2, 0xef, 0xb2, 0xfd, 0x7e, 0x7f, 0xd9, 0xfd, 0xf7, 0xbd, 0xc8, 0xdf, 0xcd, 0x9e,
+	0xa8, 0x01, 0xfa, 0xb6, 0xdb, 0xed, 0x32, 0x7b, 0x92, 0xcf, 0xa3, 0x90, 0xcf, 0x3d, 0x51, 0x03,
+	0xe8, 0xef, 0x35, 0x2d, 0xec, 0xa7, 0xab, 0x45, 0xfe, 0xad, 0xbf, 0xe7, 0xcc, 0xb9, 0x95, 0xfc,
+	0xdd, 0x9e, 0xfd, 0xc3, 0x3d, 0x54, 0xf9, 0x7b, 0xfa, 0x83, 0xfe, 0x1e, 0xa8, 0xcf, 0xef, 0x90,
+	0x27, 0xff, 0x78, 0xfe, 0xf6, 0x86, 0x77, 0xf2, 0x97, 0xbf, 0xfc, 0xe3, 0xfb, 0x3f, 0x3e, 0xc8,
+	0xdf, 0xb3, 0x01, 0xa2, 0x7d, 0x16, 0xff, 0xfb, 0x2a, 0x7f, 0xcf, 0x06, 0xa8, 0xf6, 0x0c, 0xfe,
+	0xff, 0x69, 0x50, 0xc1, 0xed, 0x59, 0xfc, 0x4f, 0x1a, 0xd4, 0xf5, 0x55, 0xfb, 0xbb, 0x8a, 0x6f,
+	0xcf, 0xe4, 0xff, 0xd5, 0xa0, 0x86, 0x79, 0xee, 0x0f, 0x37, 0xfd, 0x0d, 0x9e, 0xa9, 0xc1, 0xb9,
+	0xcf, 0xa3, 0xfa, 0xfd, 0x73, 0xbd, 0xe2, 0x71, 0x3f, 0xd8, 0x33, 0xfa, 0x1f, 0x1f, 0x93, 0xb7,
+	0xfc, 0xe5, 0x2f, 0xff, 0x53, 0x7f, 0xe6, 0x06, 0x11, 0xec, 0xe5, 0x2f, 0xff, 0xec, 0xfe, 0xac,
+	0x0d, 0xa2, 0xd8, 0xcb, 0xdf, 0xdf, 0x9f, 0xb1, 0x41, 0x24, 0x7b, 0xf9, 0xfb, 0xfb, 0xb3, 0x35,
+	0x88, 0x66, 0x2f, 0x7f, 0x7f, 0x7f, 0xa6, 0x06, 0x11, 0xed, 0xe5, 0xef, 0xef, 0xcf, 0xd2, 0x20,
+	0xaa, 0x3d, 0x4b, 0x83, 0xc8, 0xf6, 0xf2, 0xf7, 0xf7, 0x47, 0x6f, 0x10, 0xdd, 0x1e, 0xbd, 0x41,
+	0x06, 0x7b, 0xe4, 0x06, 0x59, 0xec, 0x51, 0x1b, 0x64, 0xb2, 0x97, 0xbf, 0xbf, 0x3f, 0x5a, 0x83,
+	0x6c, 0xf6, 0x68, 0x0d, 0x32, 0xda, 0x23, 0x75, 0xc8, 0xea, 0x8e, 0xd0, 0xc0, 0xa6, 0xff, 0x33,
+	0x2c, 0xb9, 0xed, 0xbd, 0x1a, 0xfc, 0xd8, 0x3b, 0x35, 0x40, 0x7c, 0x07, 0x67, 0x16, 0x7f, 0xf4,
+	0xf7, 0xd0, 0x0e, 0xb7, 0x1f, 0xd4, 0x80, 0xe9, 0x1d, 0xcc, 0xd1, 0xfc, 0x0b, 0xe9, 0x86, 0xd9,
+	0x77, 0x6a, 0x50, 0x82, 0x8c, 0xcd, 0xbf, 0x04, 0x1d, 0xba, 0x7f, 0x49, 0x32, 0x34, 0xff, 0x92,
+	0x7c, 0xa3, 0xfd, 0x8b, 0xb6, 0xec, 0x9d, 0x70, 0x57, 0xfc, 0x25, 0x24, 0xff, 0x39, 0xfb, 0x00,
+};
@@ -1,1179 +1,562 @@
-////////////////////////////////////////////////////////////////////////////////////////
-//                                                                                    //
-// FontAsCode exporter v1.0 - Font data exported as an array of bytes                 //
-//                                                                                    //
-// more info and bugs-report:  github.com/raysan5/raylib                              //
-// feedback and support:       ray[at]raylib.com                                      //
-//                                                                                    //
-// Copyright (c) 2018-2023 Ramon Santamaria (@raysan5)                                //
-//                                                                                    //
-// ---------------------------------------------------------------------------------- //
-//                                                                                    //
-// Font name:    Iosevka                                                              //
-// Font creator: Belleve Invis                                                        //
-// Font LICENSE: OFL-1.1                                                              //
-//                                                                                    //
-////////////////////////////////////////////////////////////////////////////////////////
+// Converted from the raylib export of assets/iosevka-regular.ttf, the ttf is
+// not in the tree. With it tools/assets.c writes this header, do not edit
 
-#define COMPRESSED_DATA_SIZE_FONT_IOSEVKA 12656
+// Font name:    Iosevka
+// Font creator: Belleve Invis
+// Font LICENSE: OFL-1.1
 
-// Font image pixels data compressed (DEFLATE)
-// NOTE: Original pixel data simplified to GRAYSCALE
-static unsigned char fontData_Iosevka[COMPRESSED_DATA_SIZE_FONT_IOSEVKA] = {
-		0xed, 0x9d, 0x07, 0x78, 0x54, 0x45, 0xf7, 0xc6, 0x37, 0x05, 0x0c, 0x1d,
-		0x91, 0x66, 0xa4, 0x48, 0x91, 0x2e, 0x10, 0x05, 0x44, 0x10, 0x90, 0x26,
-		0x48, 0x53, 0xec, 0x0a, 0xd8, 0xf9, 0x54, 0xfc, 0xac, 0x58, 0x50, 0xf4,
-		0xef, 0x67, 0x2f, 0xa8, 0x88, 0x62, 0x45, 0x45, 0xb1, 0x62, 0x17, 0x45,
-		0x40, 0xec, 0x80, 0x05, 0x50, 0x14, 0x50, 0x40, 0x11, 0x29, 0x52, 0x85,
-		0x80, 0x74, 0x08, 0xc9, 0xfb, 0x7f, 0xe6, 0xbd, 0x37, 0x9b, 0x2d, 0x33,
-		0x73, 0xef, 0x96, 0x84, 0x04, 0x4e, 0x7e, 0xcf, 0x03, 0xbb, 0xd9, 0xc9,
-		0xec, 0xdc, 0xb9, 0xf7, 0x9d, 0x72, 0xe6, 0xcc, 0x1c, 0x04, 0x04, 0x41,
-		0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x34, 0x74,
-		0x43, 0x36, 0xbe, 0xd3, 0xfc, 0xbe, 0x06, 0x36, 0x63, 0x33, 0xda, 0xf1,
-		0xf5, 0x4b, 0xd8, 0x8c, 0xe7, 0x0d, 0x7f, 0x7f, 0x29, 0xae, 0x43, 0x26,
-		0x5f, 0xf5, 0xc3, 0x75, 0x38, 0xc6, 0xfa, 0x5d, 0x9d, 0xb0, 0x14, 0x53,
-		0x3d, 0xca, 0x93, 0x82, 0x4c, 0x54, 0xf2, 0x5d, 0xfa, 0x32, 0xa8, 0xe9,
-		0x91, 0x62, 0x30, 0x36, 0x63, 0xb9, 0x35, 0xc5, 0xa5, 0xe8, 0xa9, 0xfd,
-		0xfd, 0xfd, 0xa8, 0xe7, 0xb3, 0x0c, 0xf5, 0x70, 0x84, 0x8f, 0x74, 0x47,
-		0xe2, 0x06, 0x5c, 0x14, 0xc7, 0x1d, 0x2a, 0x87, 0xe6, 0x51, 0x34, 0x4c,
-		0xe0, 0x8e, 0x57, 0xc3, 0x40, 0xf4, 0x31, 0x7e, 0x9a, 0x8e, 0xda, 0xa8,
-		0xe2, 0x23, 0x97, 0xb6, 0x58, 0x80, 0x6c, 0x8c, 0xb3, 0xd4, 0x4a, 0x5d,
-		0x54, 0x43, 0x8a, 0x47, 0x2e, 0xe9, 0xa8, 0xe5, 0x23, 0x95, 0xc3, 0xd9,
-		0xc8, 0xc6, 0x62, 0x1c, 0xa2, 0xf9, 0xa4, 0x0a, 0xb2, 0xa3, 0x38, 0xd9,
-		0x9a, 0xd7, 0x08, 0x64, 0x63, 0x86, 0xf1, 0x7b, 0xbb, 0x68, 0xf2, 0x9b,
-		0x69, 0xcc, 0x2b, 0x03, 0x75, 0x51, 0xdd, 0xc7, 0x35, 0xa4, 0xa1, 0x16,
-		0x2a, 0x58, 0x53, 0x94, 0x45, 0x0f, 0xb4, 0x88, 0xf1, 0x93, 0x44, 0xe9,
-		0x05, 0xe0, 0x37, 0xad, 0xfe, 0xd5, 0xcf, 0x71, 0x7c, 0xfd, 0x16, 0x80,
-		0x57, 0x0c, 0x7f, 0xbf, 0x02, 0xc0, 0x09, 0x7c, 0xf5, 0x0e, 0x80, 0x6b,
-		0xe3, 0xfa, 0xae, 0x02, 0x4e, 0xc3, 0x6a, 0x7e, 0xef, 0x17, 0xa8, 0xe3,
-		0xfe, 0x66, 0x3a, 0xb2, 0xf1, 0x7f, 0xda, 0xb4, 0x4d, 0xf0, 0x35, 0xf6,
-		0x01, 0xd8, 0x84, 0x6b, 0x91, 0x6a, 0xcc, 0xf1, 0x42, 0xa6, 0x30, 0x7d,
-		0x5a, 0x19, 0xef, 0x03, 0x58, 0x8a, 0x74, 0x4d, 0x49, 0x80, 0x7f, 0x71,
-		0x8e, 0x8f, 0x1a, 0xec, 0x0a, 0xe0, 0xe7, 0x04, 0x6a, 0x3a, 0xbf, 0xdd,
-		0x7b, 0x06, 0x3b, 0xb0, 0x0c, 0x27, 0x46, 0x7d, 0xd2, 0x9d, 0x35, 0x12,
-		0xfe, 0x33, 0xdf, 0xf0, 0xf7, 0x4b, 0xd1, 0xc9, 0xb3, 0x1c, 0x37, 0x03,
-		0xf8, 0x48, 0xfb, 0x49, 0x0b, 0x7c, 0x88, 0x3d, 0xcc, 0x7f, 0x25, 0xee,
-		0xd0, 0xd4, 0x49, 0x3e, 0xa9, 0xb8, 0x09, 0x7b, 0x99, 0xee, 0x75, 0x43,
-		0x3e, 0x53, 0x91, 0xc3, 0xcf, 0x57, 0xe3, 0xff, 0x8c, 0xf9, 0x64, 0xe2,
-		0x75, 0x6c, 0x77, 0x53, 0xdd, 0x86, 0x34, 0x8f, 0x52, 0xa7, 0xe2, 0x37,
-		0x00, 0x37, 0x6a, 0x3f, 0x3b, 0x8c, 0xb9, 0xec, 0xc2, 0xce, 0x10, 0xfa,
-		0x59, 0xf2, 0xaa, 0x88, 0x4d, 0x00, 0xce, 0xb4, 0xdc, 0xd1, 0x9d, 0x61,
-		0xec, 0xd5, 0xd6, 0xb8, 0xa2, 0x31, 0x3e, 0x71, 0x6b, 0xec, 0x6f, 0x8c,
-		0xb0, 0x5c, 0x43, 0x3d, 0xbc, 0x82, 0x5d, 0x4c, 0xb7, 0x18, 0x83, 0x0c,
-		0x69, 0x2a, 0xe0, 0x0f, 0x00, 0x79, 0xb8, 0x3e, 0x86, 0x4f, 0x0a, 0x4f,
-		0xff, 0xd5, 0x58, 0xda, 0x36, 0x7c, 0xfd, 0x26, 0x80, 0x97, 0x8a, 0x40,
-		0xff, 0x35, 0xb1, 0x03, 0xc0, 0x5c, 0xfc, 0x1d, 0x7c, 0x42, 0x6b, 0x22,
-		0x17, 0x40, 0x96, 0xb6, 0xcd, 0xdf, 0x08, 0x60, 0x23, 0xe6, 0x23, 0x0f,
-		0xc0, 0x08, 0x63, 0x9e, 0x17, 0x00, 0xd8, 0x60, 0xec, 0x59, 0x67, 0x01,
-		0xd8, 0xa9, 0xbd, 0x23, 0x95, 0xf0, 0x09, 0x80, 0x5c, 0x0c, 0xf1, 0xac,
-		0xc1, 0xf6, 0x80, 0x76, 0x04, 0x15, 0xdb, 0xd5, 0x77, 0x76, 0x95, 0xfd,
-		0x43, 0xd4, 0x27, 0x59, 0xf8, 0x34, 0x8a, 0x67, 0x8d, 0x7f, 0xff, 0xbd,
-		0x67, 0x39, 0xbe, 0x03, 0x70, 0xa9, 0xe6, 0xf7, 0xc7, 0x63, 0x1b, 0x80,
-		0xed, 0xf8, 0x01, 0x8b, 0x99, 0xd3, 0xc7, 0x86, 0x56, 0x35, 0x13, 0xd3,
-		0x01, 0xec, 0xc3, 0x02, 0x83, 0xfe, 0x8f, 0xc5, 0x4e, 0x00, 0x3b, 0xf0,
-		0xa3, 0xdb, 0x96, 0xbf, 0xab, 0xed, 0x1b, 0xab, 0xf3, 0xd3, 0xbd, 0xf8,
-		0x05, 0xcb, 0x99, 0xea, 0x15, 0x8f, 0x52, 0x9f, 0xc3, 0xfb, 0x58, 0xce,
-		0xa2, 0xff, 0xb2, 0xbe, 0x9f, 0xf9, 0x91, 0xd4, 0x73, 0xaa, 0xef, 0xf4,
-		0x0f, 0x01, 0x78, 0x43, 0xab, 0xfe, 0xcd, 0xbc, 0xd2, 0xb9, 0xf8, 0x93,
-		0x25, 0x18, 0x6f, 0xf8, 0xfb, 0x46, 0x58, 0x03, 0x60, 0x37, 0x7e, 0x74,
-		0xaf, 0x75, 0xb8, 0x36, 0x55, 0x1f, 0xf7, 0x0e, 0xfe, 0x16, 0xc3, 0x27,
-		0x85, 0xa7, 0xff, 0xaa, 0xfc, 0x46, 0x47, 0x79, 0x6f, 0x00, 0x78, 0x21,
-		0x09, 0xfa, 0x3f, 0x85, 0x8a, 0x35, 0x8f, 0x94, 0xfa, 0x53, 0xfd, 0x01,
-		0x34, 0x03, 0xb0, 0x8d, 0xbf, 0xf9, 0x0f, 0x80, 0x45, 0xda, 0xb4, 0x77,
-		0xb2, 0xd7, 0xad, 0x88, 0x00, 0xce, 0x07, 0xb0, 0x55, 0x3b, 0x2e, 0x54,
-		0x0c, 0x01, 0xb0, 0xd6, 0x30, 0x1e, 0x9b, 0xca, 0x76, 0xbb, 0xad, 0x71,
-		0xbc, 0xf6, 0x30, 0x80, 0x1c, 0xf4, 0x37, 0x7e, 0xee, 0xfc, 0xdf, 0x8a,
-		0xe3, 0x95, 0xf0, 0xdf, 0xc5, 0xae, 0xff, 0xde, 0xee, 0x3d, 0xfe, 0x3d,
-		0xce, 0xfb, 0x98, 0xff, 0xf7, 0x0b, 0x3c, 0xd2, 0x1d, 0x8e, 0x5c, 0xe4,
-		0xa2, 0xba, 0xa6, 0x7f, 0x5d, 0xc4, 0x56, 0xf7, 0x50, 0xbe, 0xeb, 0x89,
-		0xad, 0x00, 0x2e, 0xd3, 0xfc, 0x7d, 0x73, 0xfc, 0xc3, 0xf1, 0x41, 0x67,
-		0xdc, 0x64, 0xd0, 0xff, 0x3c, 0x00, 0x93, 0x51, 0xd5, 0x1d, 0xb3, 0xab,
-		0xb6, 0xe0, 0x3c, 0x4d, 0xaa, 0x71, 0x2c, 0x6b, 0x03, 0xbe, 0x3e, 0x03,
-		0xbb, 0x01, 0x9c, 0x64, 0xed, 0xfd, 0x17, 0x02, 0xb8, 0xc9, 0xf0, 0x69,
-		0x6c, 0xfa, 0xaf, 0xc0, 0xde, 0xff, 0xf4, 0x18, 0xea, 0xf6, 0x77, 0x00,
-		0x67, 0x6b, 0x7e, 0xff, 0x01, 0xdb, 0xdb, 0x1a, 0xee, 0x35, 0xa8, 0x9e,
-		0xaa, 0xbd, 0xf6, 0xef, 0x27, 0x03, 0x98, 0xe5, 0xce, 0x92, 0xcf, 0x43,
-		0x0e, 0xf6, 0xa1, 0x91, 0x26, 0xd5, 0x71, 0xee, 0x1d, 0xfc, 0x2a, 0x86,
-		0x4f, 0x0a, 0x4f, 0xff, 0x55, 0xf8, 0x8d, 0x2d, 0xf9, 0xfa, 0x35, 0x00,
-		0xcf, 0x25, 0xa8, 0xff, 0x2c, 0xf6, 0x1a, 0xea, 0x67, 0x3d, 0x1e, 0x41,
-		0x79, 0x6d, 0x9a, 0x73, 0x01, 0x7c, 0xe6, 0xce, 0x3d, 0xf2, 0xf8, 0x1b,
-		0xd5, 0x07, 0xeb, 0x47, 0xff, 0x1f, 0x02, 0xf8, 0xaf, 0xfb, 0x6c, 0x6c,
-		0x01, 0xd0, 0xdc, 0xf0, 0xbd, 0x83, 0x00, 0xac, 0xd2, 0x7e, 0x32, 0x8c,
-		0x6d, 0x72, 0x33, 0x6b, 0xed, 0x3c, 0x07, 0x60, 0x1d, 0x2a, 0x6b, 0x3f,
-		0x7b, 0x00, 0x73, 0x70, 0x0d, 0x6a, 0xa0, 0x11, 0xfb, 0xca, 0x14, 0x74,
-		0xc4, 0xd3, 0xd8, 0xe0, 0xde, 0x65, 0xdd, 0xfc, 0x5d, 0xb5, 0x65, 0x7f,
-		0x1a, 0xe7, 0xef, 0x19, 0x98, 0xcd, 0xda, 0xf9, 0x3c, 0xce, 0xfb, 0x98,
-		0x81, 0x9f, 0xd8, 0x2b, 0x5f, 0xe2, 0x91, 0xee, 0x32, 0x00, 0x33, 0x0c,
-		0xa3, 0x98, 0xad, 0xae, 0xfa, 0x15, 0x4a, 0xdd, 0xdf, 0x6a, 0x67, 0xec,
-		0x9f, 0xe3, 0x5d, 0x5a, 0x08, 0xf4, 0xfa, 0x6f, 0xc6, 0x5e, 0xbd, 0xc0,
-		0x2a, 0xf3, 0x38, 0x6b, 0x27, 0x7a, 0xb6, 0xf2, 0x2f, 0x80, 0xee, 0x61,
-		0xad, 0xc1, 0x78, 0x4b, 0xa9, 0xcf, 0x02, 0xf0, 0x8f, 0xe1, 0xa9, 0x89,
-		0x55, 0xff, 0xb7, 0xb2, 0xe7, 0x48, 0xf1, 0x5d, 0xb3, 0xcd, 0xf9, 0x9c,
-		0x54, 0xd0, 0x5c, 0x83, 0x6a, 0xb5, 0x3a, 0x06, 0xdf, 0xbf, 0x0d, 0xe0,
-		0x1e, 0xcd, 0xdf, 0xd7, 0xe1, 0x7d, 0xa9, 0x1b, 0x7c, 0x3f, 0x06, 0xc0,
-		0x58, 0xed, 0x37, 0xdd, 0x83, 0x65, 0xf8, 0x5e, 0x3b, 0xda, 0x35, 0x7f,
-		0x52, 0x58, 0xfa, 0x2f, 0xc7, 0x3a, 0x6d, 0xc2, 0xd7, 0x2f, 0x6a, 0x4b,
-		0xdc, 0x08, 0x93, 0x30, 0x89, 0xed, 0xfb, 0x4c, 0xbe, 0x52, 0x63, 0x9c,
-		0x85, 0x98, 0x84, 0x87, 0xb4, 0x4f, 0xd7, 0x6e, 0x6a, 0x1a, 0xee, 0xbf,
-		0xdf, 0x21, 0xc3, 0x87, 0xfe, 0x2b, 0xf2, 0xaf, 0x1a, 0x69, 0xcb, 0xfd,
-		0x49, 0xc8, 0x28, 0x56, 0x8d, 0xc2, 0x4c, 0xd6, 0x91, 0x33, 0x00, 0x2c,
-		0xd3, 0x8e, 0x3f, 0xd5, 0x5f, 0xdd, 0xee, 0x51, 0x3b, 0x15, 0xb1, 0x12,
-		0xc0, 0x93, 0xda, 0xcf, 0xa6, 0xf1, 0x6a, 0x72, 0x30, 0x13, 0xc0, 0x0a,
-		0x77, 0x04, 0xb8, 0x03, 0xa7, 0xc5, 0x39, 0x7f, 0x57, 0x63, 0x07, 0xd5,
-		0x42, 0x8c, 0x89, 0xfb, 0x4e, 0xa6, 0xe3, 0x68, 0x4d, 0xeb, 0x13, 0xc9,
-		0x14, 0xc3, 0xf8, 0xf3, 0x72, 0x20, 0xcc, 0x36, 0xdb, 0x94, 0x33, 0x6a,
-		0xbd, 0x2d, 0xaa, 0xa0, 0x85, 0x88, 0xd6, 0x7f, 0x47, 0xcc, 0xc3, 0xa4,
-		0x88, 0x71, 0xc9, 0x32, 0x4d, 0xbd, 0xce, 0xc3, 0xbc, 0x10, 0x4d, 0x0d,
-		0x36, 0xb4, 0x36, 0xf9, 0xbd, 0xff, 0x02, 0xeb, 0x1c, 0x2f, 0x16, 0xfd,
-		0x3b, 0x73, 0xff, 0x53, 0x63, 0xa8, 0xd7, 0x91, 0xda, 0x16, 0x4c, 0xd5,
-		0x83, 0xfa, 0xa9, 0x11, 0xd2, 0x1f, 0x00, 0x4f, 0x69, 0xd2, 0x9d, 0x07,
-		0x60, 0x76, 0x58, 0x0d, 0x99, 0xac, 0x09, 0xfb, 0x03, 0x93, 0xfe, 0xd3,
-		0x78, 0x75, 0xf5, 0xf9, 0xfa, 0x29, 0x00, 0x8f, 0x46, 0xa5, 0x68, 0xa7,
-		0x79, 0xae, 0xc1, 0x91, 0x8e, 0x7e, 0x4c, 0xf8, 0x3e, 0x32, 0x01, 0x3c,
-		0x8d, 0xce, 0x6c, 0xfb, 0xaf, 0xf6, 0xa1, 0x7f, 0xd5, 0xea, 0xcf, 0x31,
-		0x94, 0x7b, 0x14, 0xe0, 0xae, 0x49, 0xb4, 0xe1, 0x93, 0x5a, 0xda, 0x32,
-		0xa7, 0xd0, 0xcd, 0x20, 0xfe, 0x07, 0xe0, 0x17, 0x94, 0xf2, 0xac, 0x9f,
-		0x3e, 0xec, 0xcf, 0xaa, 0x19, 0x2c, 0xfa, 0xc3, 0xf0, 0x31, 0x5b, 0x40,
-		0xd5, 0xb3, 0x3f, 0x81, 0x93, 0x51, 0x46, 0x3b, 0xf2, 0x71, 0xe6, 0xec,
-		0x3f, 0x72, 0x76, 0x6d, 0x9a, 0xbf, 0xe7, 0x8f, 0x13, 0x4f, 0x2c, 0xd4,
-		0xbb, 0xed, 0xb4, 0xa8, 0x0d, 0xb5, 0x16, 0xf1, 0xf0, 0x39, 0xb8, 0x63,
-		0xff, 0xc9, 0xb0, 0xe4, 0x75, 0x93, 0xd1, 0xfe, 0x17, 0x6e, 0x55, 0x50,
-		0xf6, 0x3d, 0x6f, 0xdb, 0xbe, 0x6d, 0x74, 0x7b, 0x06, 0xe7, 0x8d, 0x15,
-		0x92, 0xa2, 0xff, 0xdb, 0xa8, 0xc6, 0x94, 0x18, 0xea, 0x6c, 0x8e, 0xc1,
-		0x5e, 0x12, 0xa0, 0x05, 0xa3, 0x57, 0x58, 0xcb, 0xaa, 0x1b, 0xff, 0x5e,
-		0x07, 0x60, 0x62, 0x98, 0xfd, 0xc4, 0xd4, 0xb2, 0x16, 0x27, 0xfd, 0x07,
-		0x68, 0xf5, 0xac, 0xc5, 0x57, 0x8f, 0x02, 0x78, 0x40, 0x33, 0x42, 0x38,
-		0x16, 0xc7, 0x62, 0x2d, 0x80, 0x4b, 0xf8, 0xea, 0x73, 0x00, 0x8f, 0xe0,
-		0x58, 0x34, 0x8e, 0x4a, 0xd9, 0x80, 0x1a, 0xaa, 0x8c, 0x32, 0xd4, 0xbf,
-		0x33, 0x02, 0xfb, 0xd2, 0x87, 0xfe, 0x5f, 0x07, 0x8c, 0x36, 0xcf, 0x2c,
-		0xaa, 0xe9, 0x70, 0xa4, 0xe1, 0x4b, 0x8b, 0x75, 0x42, 0xcd, 0x64, 0x95,
-		0xce, 0xa3, 0xc7, 0x6e, 0x4b, 0x01, 0x5c, 0xe0, 0xab, 0x86, 0x7e, 0x01,
-		0x70, 0x95, 0xc5, 0x66, 0xe9, 0x58, 0xb9, 0x1e, 0x4e, 0xd0, 0xfe, 0xa7,
-		0x56, 0xd4, 0xf2, 0xb0, 0xd4, 0xd3, 0x0e, 0x9e, 0x18, 0x67, 0x1b, 0x2d,
-		0x04, 0xaa, 0x97, 0x9b, 0x10, 0xf2, 0xfe, 0x4c, 0x4f, 0x4d, 0xf9, 0xd3,
-		0xff, 0xf9, 0xbe, 0x6c, 0x92, 0xa3, 0x8d, 0x63, 0x62, 0x75, 0xaf, 0xe6,
-		0x03, 0xb8, 0x95, 0x3d, 0x6e, 0x59, 0xad, 0x72, 0x1d, 0xfd, 0xdf, 0x80,
-		0x1f, 0xb0, 0x01, 0xcb, 0xf1, 0x5e, 0xc8, 0x98, 0x3c, 0x7a, 0x55, 0x72,
-		0x03, 0x80, 0x6e, 0xa8, 0xe9, 0x7b, 0xb6, 0x50, 0x1b, 0x79, 0xd8, 0xa7,
-		0xb1, 0x97, 0xe4, 0xcf, 0x6d, 0xbe, 0x74, 0x4b, 0xd4, 0x06, 0xb9, 0xc8,
-		0xd1, 0xae, 0x18, 0xdf, 0x00, 0xe0, 0xcd, 0x30, 0x0b, 0x8c, 0xfa, 0x29,
-		0x55, 0xec, 0xf5, 0xaf, 0xac, 0xc1, 0xd5, 0xdc, 0x95, 0x70, 0xe0, 0xce,
-		0x04, 0xe6, 0xff, 0x6a, 0xc4, 0xb3, 0x9c, 0xb5, 0xef, 0xe8, 0xbf, 0x15,
-		0xde, 0xc0, 0x68, 0x4d, 0xba, 0x53, 0xdd, 0x51, 0x60, 0x03, 0x5a, 0xe5,
-		0x4b, 0x63, 0x0b, 0x72, 0xdd, 0x16, 0xc8, 0x64, 0x01, 0x98, 0xc8, 0xb1,
-		0x49, 0xb6, 0x65, 0xa5, 0xbe, 0x93, 0x76, 0x0c, 0xd1, 0x8e, 0x73, 0xb2,
-		0xaa, 0xbe, 0x6a, 0xe8, 0x1e, 0xce, 0x70, 0x4c, 0x63, 0xee, 0xaf, 0x59,
-		0x37, 0x7f, 0x20, 0xcf, 0xb2, 0x9e, 0xe4, 0x47, 0xff, 0x95, 0xd8, 0x22,
-		0x9d, 0x57, 0xc8, 0x77, 0x5b, 0x59, 0x72, 0xef, 0xf6, 0xd4, 0x7f, 0x2a,
-		0xee, 0xa4, 0x35, 0x2b, 0x19, 0xfa, 0xff, 0x14, 0xc0, 0x5d, 0x1e, 0x69,
-		0x1a, 0x62, 0x2b, 0xf2, 0x5c, 0x5f, 0x93, 0x68, 0x4e, 0xe7, 0x0a, 0x6e,
-		0x05, 0x1c, 0xc2, 0x12, 0x55, 0x37, 0xea, 0x1f, 0xec, 0x65, 0xf2, 0xd8,
-		0x77, 0x5c, 0x68, 0xf4, 0xf5, 0x00, 0xf6, 0x70, 0x06, 0x90, 0x87, 0x25,
-		0xb8, 0xd2, 0xc7, 0x38, 0xe0, 0x2a, 0x00, 0xdf, 0x18, 0xdb, 0x06, 0x35,
-		0x87, 0x1c, 0x8d, 0x14, 0xd4, 0xa5, 0x0e, 0xf4, 0xa3, 0xba, 0x8b, 0x22,
-		0xe6, 0x36, 0x1d, 0xb9, 0xb2, 0x5c, 0xfc, 0xfb, 0xff, 0xb4, 0x60, 0x5f,
-		0x94, 0x8a, 0x34, 0xe3, 0x6a, 0x89, 0x1f, 0xfd, 0x1f, 0xc9, 0xfa, 0xae,
-		0x11, 0xd4, 0xbf, 0x89, 0xba, 0xbc, 0x7f, 0x93, 0xf1, 0x2b, 0xdb, 0xd5,
-		0x0a, 0x38, 0xd5, 0xe0, 0x99, 0x93, 0xff, 0xd4, 0x38, 0x23, 0xef, 0x3d,
-		0x56, 0x5f, 0x8f, 0x94, 0x90, 0xeb, 0x08, 0xbf, 0xab, 0x7e, 0xad, 0xa9,
-		0xc7, 0xb1, 0x35, 0xd2, 0xf7, 0xcb, 0x8f, 0x72, 0xbe, 0x93, 0x86, 0x13,
-		0x90, 0x8b, 0x6d, 0x1e, 0xb6, 0x44, 0xbb, 0xfe, 0xef, 0x67, 0x89, 0x52,
-		0x0b, 0xf5, 0x5e, 0x97, 0xa6, 0xa5, 0xb4, 0x8d, 0x87, 0xfe, 0x2b, 0x61,
-		0x12, 0xc0, 0x94, 0x89, 0xeb, 0x7f, 0x08, 0xf2, 0xb0, 0x35, 0xe8, 0xcb,
-		0xa1, 0x6b, 0xf5, 0xfa, 0xe2, 0x76, 0xea, 0xf1, 0x2e, 0xe3, 0xfd, 0xfb,
-		0x19, 0xc0, 0x48, 0x04, 0x3c, 0xf5, 0xbf, 0x01, 0xa7, 0xa2, 0x34, 0x2a,
-		0x72, 0xb5, 0x2e, 0xc7, 0x5d, 0x59, 0x88, 0xe4, 0x2b, 0xb7, 0x95, 0x58,
-		0xe8, 0x8e, 0xda, 0x9e, 0xf0, 0xac, 0x33, 0x35, 0xaa, 0xbd, 0xce, 0xb2,
-		0xea, 0xa2, 0x56, 0xff, 0x3f, 0xe0, 0x28, 0x78, 0xa6, 0x61, 0xb6, 0xd4,
-		0x98, 0xdf, 0x78, 0x44, 0xd8, 0x58, 0xe7, 0xb7, 0x12, 0xa0, 0x7f, 0x7f,
-		0xf8, 0xb3, 0xff, 0x2b, 0xdb, 0xf6, 0x27, 0xa8, 0xec, 0xa1, 0x7f, 0x65,
-		0x93, 0xdf, 0xee, 0x7a, 0x49, 0x34, 0xa7, 0x4d, 0xbb, 0x49, 0x88, 0x7d,
-		0x25, 0x7a, 0x2c, 0x37, 0x8f, 0x69, 0x07, 0xc6, 0x51, 0xea, 0xf1, 0x00,
-		0xfe, 0xe7, 0x33, 0x6d, 0x2a, 0xbd, 0x12, 0x9a, 0x6a, 0xfd, 0x5c, 0xf6,
-		0x61, 0x87, 0x6b, 0x9f, 0x7c, 0x38, 0xc2, 0x7e, 0x16, 0x6b, 0x4d, 0x97,
-		0xc6, 0xa8, 0x10, 0x1b, 0x71, 0xe1, 0xdd, 0xeb, 0x95, 0x86, 0x3e, 0x2f,
-		0x5f, 0xff, 0xcd, 0xb0, 0x84, 0x23, 0xa6, 0xac, 0x24, 0xe8, 0x7f, 0x18,
-		0xdb, 0xf3, 0x21, 0x1e, 0xd6, 0x01, 0x18, 0xac, 0x41, 0x0e, 0x03, 0xd9,
-		0xfb, 0x57, 0xf4, 0xa1, 0xff, 0x21, 0x61, 0x33, 0xf1, 0x31, 0x5a, 0x6f,
-		0x2f, 0x35, 0xa7, 0xfd, 0x09, 0x47, 0xb2, 0x5d, 0x19, 0x4c, 0xef, 0xb1,
-		0x1e, 0xd6, 0x2b, 0xa8, 0x42, 0x3f, 0x26, 0x9b, 0x1f, 0x68, 0x77, 0xe6,
-		0xa2, 0xc6, 0x08, 0xe5, 0x8c, 0x69, 0xbe, 0xe2, 0x0a, 0x71, 0x15, 0xd7,
-		0x9e, 0xa4, 0x5a, 0x8c, 0x17, 0x0f, 0x32, 0xfd, 0xb7, 0xa3, 0xdd, 0x69,
-		0x99, 0x71, 0x8c, 0x14, 0xda, 0x23, 0x1c, 0x83, 0xa6, 0xec, 0x6d, 0x2f,
-		0xa7, 0x9d, 0x10, 0x98, 0xae, 0xb5, 0xbe, 0xa5, 0x72, 0x05, 0x40, 0xfd,
-		0x3c, 0x14, 0x47, 0xa9, 0x67, 0x00, 0xb8, 0xc2, 0x77, 0x6a, 0x55, 0xee,
-		0xfe, 0x06, 0xdf, 0x9f, 0xf3, 0x82, 0xeb, 0x6f, 0xb7, 0x1b, 0xd7, 0xa7,
-		0x6c, 0x23, 0x91, 0xa2, 0xe4, 0x69, 0x4b, 0x8f, 0xe7, 0xe8, 0x7f, 0x20,
-		0xd7, 0xfd, 0xc7, 0x23, 0xc3, 0x87, 0x4d, 0xcd, 0xae, 0xff, 0xf2, 0x5c,
-		0x35, 0xce, 0xc5, 0x95, 0xd6, 0x12, 0x1d, 0x85, 0x49, 0x5c, 0x61, 0xc9,
-		0xd6, 0xac, 0x9b, 0x38, 0x75, 0x36, 0x2f, 0xb8, 0x4a, 0x63, 0xd6, 0x7f,
-		0x45, 0xda, 0x54, 0xab, 0x85, 0xcd, 0x18, 0x7e, 0x36, 0xd8, 0x82, 0x72,
-		0x43, 0xd6, 0x93, 0xc6, 0xd2, 0x2a, 0xed, 0x65, 0xbd, 0x98, 0x67, 0xf5,
-		0xcd, 0xfe, 0xc0, 0x7d, 0x0a, 0x77, 0x58, 0xe6, 0x7f, 0x2d, 0xe8, 0xab,
-		0xb6, 0x05, 0x5f, 0xd1, 0x96, 0x64, 0xea, 0xb3, 0xcc, 0x1e, 0x9c, 0x66,
-		0xdf, 0xd0, 0xc4, 0xe9, 0x8e, 0xad, 0x46, 0x1b, 0xbb, 0x9d, 0x43, 0x50,
-		0x1f, 0xf5, 0x39, 0x8e, 0x3a, 0x93, 0xaf, 0xa6, 0x70, 0x6e, 0x59, 0xdf,
-		0xb0, 0x06, 0xd5, 0x93, 0x73, 0x25, 0xf5, 0x73, 0xa1, 0xc7, 0x28, 0xf7,
-		0x30, 0x74, 0x46, 0x4b, 0x34, 0xc3, 0x3e, 0xe4, 0xe1, 0x1b, 0x8e, 0xac,
-		0xc6, 0x1b, 0xec, 0xd5, 0xeb, 0xb9, 0x6a, 0xb5, 0x87, 0x16, 0xc7, 0xda,
-		0xb8, 0x06, 0xc3, 0x7c, 0xdb, 0x75, 0x7f, 0xb6, 0xfa, 0x7f, 0x46, 0xf2,
-		0x3d, 0x80, 0xc1, 0x25, 0x7e, 0xa7, 0x47, 0x2a, 0xef, 0x55, 0x77, 0x8b,
-		0xfe, 0xd7, 0x23, 0x0f, 0x7b, 0x5d, 0xaf, 0x8a, 0xc4, 0xf4, 0x5f, 0x8b,
-		0x35, 0xbc, 0xd9, 0xb2, 0xcf, 0x20, 0x7c, 0x96, 0xb0, 0x07, 0xbb, 0xd1,
-		0x41, 0xf3, 0xc9, 0x00, 0xda, 0xca, 0xdb, 0xa3, 0x29, 0x9a, 0xa2, 0x25,
-		0x4b, 0x74, 0x82, 0x8f, 0x5d, 0x19, 0x8d, 0xa8, 0x47, 0xfd, 0x4c, 0x7c,
-		0x4e, 0x84, 0x6d, 0x68, 0x9d, 0x35, 0xa7, 0xf7, 0x00, 0xdc, 0x61, 0xfc,
-		0xb4, 0x14, 0xd7, 0x80, 0xff, 0x46, 0x17, 0x8e, 0xe9, 0xf7, 0x19, 0x3d,
-		0xc5, 0xd4, 0xa8, 0x6a, 0xb2, 0xbb, 0xfa, 0xbd, 0x95, 0xe3, 0x99, 0xb2,
-		0x16, 0x0f, 0xd0, 0xef, 0x63, 0xf0, 0x0d, 0xdd, 0x9f, 0xc4, 0xb2, 0xfe,
-		0xe7, 0x58, 0xca, 0x5f, 0x76, 0x53, 0x7c, 0x6b, 0x19, 0xd5, 0x3b, 0xf6,
-		0xb6, 0x51, 0x18, 0xea, 0xae, 0xba, 0x76, 0xe6, 0xda, 0x5a, 0x74, 0xbb,
-		0xbb, 0xd9, 0xed, 0x93, 0xdf, 0xe2, 0xcc, 0xc2, 0xf1, 0xd1, 0x7c, 0xdf,
-		0x77, 0xd9, 0x97, 0xd2, 0x0a, 0xec, 0x37, 0xf5, 0x47, 0x80, 0x47, 0x3f,
-		0x56, 0x12, 0x68, 0xcf, 0x7e, 0xb6, 0x94, 0x45, 0xff, 0x4a, 0x0d, 0x9d,
-		0x7c, 0xaf, 0xa9, 0x99, 0xf5, 0x7f, 0x18, 0xe7, 0x10, 0x7f, 0x68, 0x56,
-		0x82, 0x4c, 0x0c, 0x0f, 0xf1, 0xa1, 0x8c, 0x2e, 0x95, 0xb7, 0xef, 0x44,
-		0xa4, 0x6f, 0x87, 0xfa, 0x29, 0xad, 0x2d, 0x71, 0xe8, 0x4a, 0xdc, 0x11,
-		0x1c, 0x0f, 0xa4, 0x59, 0xf6, 0xe3, 0xec, 0x08, 0xfa, 0xc0, 0xe9, 0xb8,
-		0x9b, 0xbe, 0x65, 0xce, 0x1a, 0xf9, 0xed, 0xf4, 0x59, 0x3d, 0xdc, 0xba,
-		0xf6, 0xda, 0x04, 0x75, 0xb8, 0xa6, 0xf5, 0x50, 0x8c, 0x1e, 0x9c, 0x89,
-		0xfa, 0x86, 0x16, 0x0e, 0xcd, 0x30, 0x03, 0x33, 0x38, 0xae, 0xff, 0x85,
-		0xaf, 0x36, 0x72, 0x84, 0x3f, 0xc3, 0x32, 0xc3, 0x2f, 0xc3, 0xab, 0xd8,
-		0xce, 0x6b, 0x2c, 0x67, 0x1c, 0x25, 0x2f, 0xa5, 0x57, 0xd5, 0xb5, 0xee,
-		0xd3, 0xd5, 0x52, 0xdb, 0x46, 0x0f, 0xa4, 0x8d, 0xc0, 0xf1, 0xae, 0xda,
-		0x41, 0x7f, 0x8e, 0x75, 0xc6, 0x31, 0xba, 0x0e, 0xe5, 0xeb, 0xda, 0xc7,
-		0x77, 0xea, 0xcf, 0x00, 0x0c, 0x2d, 0xf1, 0xfa, 0xbf, 0xdf, 0xea, 0x65,
-		0x3f, 0x92, 0xf3, 0xc0, 0x5a, 0x31, 0xac, 0xa9, 0x9b, 0xf5, 0xff, 0x01,
-		0x9f, 0x84, 0x5a, 0x31, 0x94, 0xad, 0x12, 0x47, 0x7b, 0x55, 0x35, 0xde,
-		0x9b, 0x9f, 0x05, 0xf9, 0xc2, 0x9d, 0x67, 0x8f, 0xf3, 0xb1, 0xd3, 0x52,
-		0x59, 0xdc, 0xa2, 0x7f, 0x7f, 0xb5, 0x66, 0x25, 0x2e, 0xcf, 0xa2, 0xff,
-		0x53, 0xb5, 0x7d, 0x4f, 0x81, 0x6d, 0x60, 0x6b, 0x98, 0xd7, 0xb2, 0xb2,
-		0x14, 0x3e, 0xee, 0x51, 0xb2, 0x36, 0xc8, 0xc3, 0x1e, 0x83, 0x3d, 0xd4,
-		0xec, 0xc1, 0x99, 0xa8, 0x6f, 0x68, 0x61, 0x12, 0x8b, 0xff, 0xbf, 0x63,
-		0xff, 0xaf, 0xcf, 0x31, 0xfd, 0xff, 0x2c, 0xd6, 0xf6, 0x75, 0x48, 0xf5,
-		0xd0, 0xff, 0x8d, 0x21, 0xcf, 0xde, 0x6d, 0x6e, 0x9b, 0xb2, 0xc6, 0xb2,
-		0x63, 0x4d, 0xe7, 0xd3, 0x71, 0xbe, 0xef, 0xd4, 0x6a, 0xd6, 0x76, 0x56,
-		0x89, 0xd7, 0xff, 0x22, 0xab, 0xd7, 0xfb, 0x2d, 0x11, 0xad, 0x83, 0xb3,
-		0xff, 0xa3, 0x4c, 0x1c, 0xfa, 0xef, 0xc1, 0xa7, 0xf8, 0xf8, 0x18, 0x4b,
-		0xa7, 0xf6, 0x7c, 0xb5, 0xf3, 0x98, 0x6f, 0x9a, 0xe6, 0xff, 0x47, 0x63,
-		0x4a, 0x98, 0xef, 0x42, 0x0f, 0x83, 0x6e, 0x07, 0x44, 0x8c, 0x4e, 0x8f,
-		0xa3, 0x57, 0xb1, 0xf9, 0x1b, 0x5f, 0xb2, 0xfa, 0x75, 0xf4, 0xa7, 0xbf,
-		0x6b, 0xc1, 0xfb, 0xbe, 0xdc, 0x49, 0xea, 0xed, 0x7d, 0x39, 0x36, 0x0e,
-		0x0f, 0xce, 0x44, 0x7d, 0x43, 0xcd, 0xb4, 0xc2, 0x68, 0x0c, 0xb7, 0xfa,
-		0x79, 0x25, 0x5b, 0xff, 0x8e, 0x4f, 0xbe, 0xa9, 0x5d, 0x7d, 0x0c, 0x60,
-		0x0b, 0x6f, 0xd7, 0xbf, 0xf2, 0xa9, 0x7a, 0x2f, 0xd8, 0x3a, 0x3a, 0xbe,
-		0xb7, 0xf7, 0xc7, 0x50, 0xea, 0xa9, 0xd6, 0x55, 0x9d, 0x48, 0xd6, 0xc6,
-		0x34, 0x5b, 0x28, 0x9e, 0x34, 0xe1, 0x4c, 0xda, 0x6c, 0xa1, 0xbc, 0x82,
-		0xbb, 0x76, 0xc2, 0x57, 0xad, 0x76, 0x5b, 0x73, 0x34, 0xe9, 0x5f, 0xf5,
-		0xfe, 0xaf, 0x7a, 0xee, 0x42, 0x58, 0x80, 0x07, 0xc3, 0x46, 0x7d, 0x6a,
-		0x14, 0x77, 0x74, 0x9c, 0xfa, 0xaf, 0x46, 0x6f, 0x85, 0x26, 0xc1, 0xf7,
-		0xcf, 0x46, 0xf8, 0x32, 0x15, 0xa4, 0xdb, 0x87, 0x3d, 0x21, 0x63, 0x74,
-		0x35, 0x22, 0x9a, 0x64, 0x51, 0xe3, 0xc6, 0xe0, 0xb3, 0x1d, 0x30, 0xf8,
-		0xf5, 0xbd, 0x17, 0xb6, 0xc7, 0xd7, 0x3e, 0x9b, 0x08, 0xa0, 0x03, 0xef,
-		0x41, 0x66, 0x5c, 0xf7, 0xaf, 0x70, 0x7c, 0x43, 0x4b, 0x61, 0x3d, 0x6b,
-		0xf5, 0x8e, 0x42, 0xd5, 0xff, 0x40, 0x3c, 0xcf, 0x93, 0x2f, 0xf2, 0xf5,
-		0x5f, 0xcb, 0x58, 0x53, 0x69, 0xdc, 0x45, 0xd0, 0xd7, 0x53, 0xff, 0x27,
-		0xd1, 0x5a, 0x55, 0x3a, 0xc4, 0xae, 0x03, 0x8b, 0xd7, 0x97, 0x7e, 0x47,
-		0xe7, 0x93, 0x31, 0x8c, 0x4d, 0x61, 0xf0, 0x00, 0x2b, 0x39, 0x98, 0x77,
-		0xfd, 0x17, 0xd8, 0xc2, 0x36, 0x87, 0xf8, 0xd8, 0x5e, 0xed, 0xee, 0xc5,
-		0x8c, 0x55, 0xff, 0xe9, 0xf4, 0x1b, 0xeb, 0xe2, 0x51, 0x9a, 0x41, 0xec,
-		0x2b, 0x4b, 0x85, 0xf5, 0xd8, 0x3b, 0x3c, 0x7c, 0xf2, 0xcc, 0xfa, 0x0f,
-		0xd0, 0x63, 0xe1, 0x6b, 0x77, 0xfe, 0x70, 0x1a, 0xef, 0xd7, 0x71, 0xda,
-		0x74, 0x6a, 0x4d, 0x62, 0x9a, 0x7b, 0xbe, 0x4c, 0x2f, 0xce, 0x5d, 0x07,
-		0x58, 0xcf, 0x75, 0x58, 0x67, 0xb1, 0x55, 0x0f, 0xa2, 0x67, 0x79, 0x4a,
-		0xd8, 0xee, 0xd6, 0x0d, 0x9e, 0xbe, 0x50, 0x8f, 0xc7, 0x75, 0xf7, 0x0a,
-		0xcb, 0x37, 0xb4, 0xaa, 0x6b, 0x59, 0x78, 0xa3, 0x50, 0xf5, 0x7f, 0xa5,
-		0x6b, 0x77, 0xcd, 0xd7, 0x7f, 0x2f, 0xe3, 0x9e, 0xdc, 0x6e, 0xb4, 0xa2,
-		0x64, 0xb8, 0x3b, 0x7f, 0x3f, 0x74, 0xbd, 0xa5, 0x96, 0x69, 0x9e, 0x05,
-		0xd5, 0x6e, 0xdd, 0xcb, 0xda, 0xaf, 0xca, 0xd1, 0xbc, 0x1f, 0x5f, 0xb4,
-		0xf0, 0xdd, 0xe4, 0x2b, 0x7c, 0x9f, 0x3b, 0xa3, 0xe6, 0x16, 0x25, 0x7d,
-		0xf4, 0xff, 0x1d, 0xfd, 0xb4, 0x6d, 0xbb, 0x87, 0x56, 0xb0, 0xdf, 0x3e,
-		0xc4, 0xf5, 0xae, 0xde, 0x44, 0x8f, 0xda, 0xd8, 0xf5, 0x7f, 0x14, 0xbd,
-		0x6f, 0xca, 0x78, 0xee, 0xc1, 0xfd, 0x97, 0xcf, 0x42, 0x59, 0x77, 0x87,
-		0x9d, 0x3a, 0x71, 0xe0, 0x65, 0xcf, 0xf5, 0x26, 0xb3, 0xfe, 0xeb, 0xb1,
-		0xbc, 0xff, 0xe2, 0x0b, 0xd7, 0x27, 0xe4, 0x71, 0xe3, 0xba, 0xc4, 0x0a,
-		0xda, 0xdf, 0xa7, 0xb9, 0x33, 0x6a, 0xdb, 0x33, 0x33, 0xc6, 0xb2, 0xeb,
-		0xd5, 0xb1, 0x90, 0xec, 0x64, 0xcf, 0x99, 0xe6, 0xfa, 0xae, 0xfd, 0xee,
-		0xb1, 0xba, 0x7d, 0x02, 0x7b, 0xff, 0x23, 0xe2, 0xb8, 0x77, 0x85, 0xe9,
-		0x1b, 0x3a, 0x95, 0x2b, 0x68, 0xfd, 0xe3, 0xfe, 0xfb, 0xe1, 0xb8, 0xdb,
-		0xf5, 0x5b, 0x39, 0x07, 0x77, 0x6b, 0xd7, 0x70, 0xd4, 0xda, 0xdc, 0x5e,
-		0xee, 0xdf, 0x2a, 0xc7, 0x7b, 0x7e, 0x24, 0xef, 0xb6, 0xde, 0x4a, 0xa8,
-		0xf6, 0x81, 0xbe, 0xcd, 0x57, 0xad, 0x91, 0x87, 0x5c, 0x4c, 0xe6, 0x89,
-		0x09, 0x6f, 0x18, 0xce, 0xf5, 0x50, 0x16, 0xd1, 0x69, 0xf4, 0x54, 0x7b,
-		0x94, 0x9e, 0x26, 0xfe, 0x47, 0x00, 0x35, 0xe9, 0xd7, 0xe1, 0x6f, 0x3f,
-		0xe5, 0xab, 0x3e, 0x4e, 0xa7, 0x28, 0xee, 0xa8, 0x5d, 0xff, 0xfb, 0x3c,
-		0xc6, 0x30, 0xbd, 0xe8, 0x99, 0xb2, 0x01, 0x53, 0xf1, 0x1d, 0xc7, 0xd3,
-		0xdf, 0x7a, 0xf8, 0xa8, 0xeb, 0xf5, 0xdf, 0x81, 0x63, 0xbb, 0xd5, 0x61,
-		0x7c, 0xae, 0x6d, 0x81, 0xf3, 0xf8, 0x6d, 0x9f, 0x61, 0x2e, 0x9f, 0x8e,
-		0xe5, 0x9e, 0xde, 0xd8, 0x36, 0xfd, 0x2b, 0x6f, 0xd0, 0x69, 0xae, 0xcf,
-		0xf2, 0x46, 0xdc, 0x62, 0xe9, 0xb5, 0xeb, 0xe3, 0x2d, 0x37, 0xdd, 0x26,
-		0xdc, 0x65, 0xe9, 0x51, 0x53, 0xd8, 0x52, 0xd8, 0x4f, 0x11, 0xbb, 0x82,
-		0xf9, 0xac, 0xc0, 0x14, 0xd7, 0x0e, 0xbe, 0xdc, 0x7a, 0x1a, 0xdd, 0xe7,
-		0xd6, 0xb9, 0xbf, 0x97, 0xe5, 0xb6, 0xb0, 0x7c, 0x43, 0x53, 0xd1, 0xdc,
-		0xba, 0x1a, 0x97, 0x1c, 0x46, 0xb8, 0x3b, 0xff, 0x1d, 0xef, 0x4b, 0xe5,
-		0x85, 0x96, 0xa9, 0xf5, 0x81, 0xcb, 0x06, 0x82, 0xa7, 0xf1, 0xdc, 0xec,
-		0x9e, 0x98, 0x34, 0xdb, 0x60, 0x49, 0xbe, 0x90, 0x36, 0x23, 0x95, 0xeb,
-		0x7f, 0x5d, 0x4f, 0xdc, 0xb9, 0x31, 0xd4, 0x91, 0x9a, 0x4f, 0xdd, 0xe7,
-		0x23, 0x5d, 0x59, 0xf6, 0x2c, 0x3d, 0x4b, 0xb8, 0xfe, 0x2f, 0x37, 0xec,
-		0xfa, 0x8f, 0xd4, 0xee, 0x2c, 0x77, 0x3c, 0xf8, 0x2f, 0xc6, 0x78, 0xf6,
-		0xe1, 0xe6, 0x51, 0xb3, 0xbf, 0x15, 0xbb, 0x9e, 0xb4, 0x77, 0x3b, 0xbe,
-		0x33, 0x13, 0x7c, 0xee, 0xc5, 0x08, 0x78, 0x78, 0x8e, 0xb4, 0x46, 0x7d,
-		0x1f, 0x3b, 0x6b, 0xca, 0xa3, 0x05, 0x1a, 0x1a, 0x77, 0x8c, 0xc6, 0xc2,
-		0xe9, 0xee, 0x59, 0x49, 0xaa, 0x67, 0x7f, 0xcd, 0x3a, 0xb3, 0xef, 0x42,
-		0x7b, 0x4a, 0xad, 0x38, 0xfd, 0xb6, 0x0b, 0xdf, 0x37, 0xb4, 0xb0, 0x39,
-		0x9f, 0x5e, 0x74, 0x4e, 0x4d, 0xbd, 0x69, 0xf1, 0x08, 0x0f, 0x1f, 0xf7,
-		0xb4, 0x42, 0x3d, 0xcb, 0x28, 0x3d, 0x1d, 0x0d, 0x91, 0x15, 0xa7, 0xed,
-		0xf2, 0x34, 0x7a, 0xf5, 0x37, 0xf2, 0x4c, 0xf7, 0x18, 0xe7, 0x1f, 0x69,
-		0x25, 0xbc, 0xf6, 0xa7, 0x18, 0x4f, 0x9d, 0x8a, 0x5e, 0x3b, 0x6f, 0x8d,
-		0x46, 0x09, 0xd8, 0x83, 0x63, 0xa3, 0x06, 0x5a, 0xa3, 0x49, 0x9c, 0x2d,
-		0x4d, 0x71, 0xa1, 0x36, 0x8e, 0x41, 0x0b, 0x8b, 0xf7, 0xaf, 0x90, 0xcf,
-		0xd0, 0x18, 0xcf, 0x69, 0x2b, 0x4c, 0x52, 0xf0, 0x0d, 0x57, 0x93, 0xed,
-		0x23, 0x86, 0x13, 0x38, 0x56, 0x3c, 0xad, 0x84, 0xd7, 0x7b, 0x45, 0x8e,
-		0xec, 0x1b, 0xc8, 0x13, 0x28, 0x94, 0xe8, 0xbd, 0x06, 0xc9, 0xe5, 0x68,
-		0xda, 0x00, 0x6e, 0xb7, 0xce, 0x9a, 0xd5, 0xb9, 0xab, 0x53, 0x4a, 0x7c,
-		0xbd, 0x9f, 0xe3, 0xe3, 0x5c, 0x40, 0x41, 0x38, 0xb8, 0xf4, 0xaf, 0xe6,
-		0x24, 0x79, 0x3c, 0x45, 0x48, 0x3f, 0x13, 0x3c, 0x16, 0xab, 0x00, 0xfc,
-		0x9a, 0x94, 0x99, 0xe9, 0xfe, 0xc5, 0xbc, 0xeb, 0x5f, 0x10, 0x8a, 0x8e,
-		0x13, 0xb1, 0x06, 0x5f, 0x17, 0xab, 0x12, 0x5d, 0xcd, 0x16, 0x60, 0x86,
-		0xc6, 0x73, 0xb0, 0x3b, 0x3d, 0x52, 0xfe, 0x88, 0xd3, 0x5b, 0xa3, 0x38,
-		0x51, 0x9a, 0x6b, 0x6d, 0xc7, 0xca, 0xf3, 0x27, 0x08, 0x1a, 0x2b, 0xf4,
-		0x2a, 0x6d, 0x6c, 0x83, 0x3a, 0xd8, 0x86, 0xd7, 0x0c, 0x27, 0xff, 0x96,
-		0x2c, 0x3a, 0x62, 0x79, 0x8c, 0x27, 0xde, 0x09, 0xc2, 0xc1, 0xc3, 0xa1,
-		0x86, 0x78, 0x57, 0x62, 0x2f, 0x13, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,
-		0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,
-		0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,
-		0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x8a, 0x8a, 0x14, 0xed, 0x4e, 0xb6,
-		0xc6, 0x78, 0x32, 0x8a, 0x5b, 0xb5, 0x3b, 0x64, 0xfc, 0x7f, 0x53, 0x59,
-		0xd4, 0x45, 0x75, 0x8f, 0xdd, 0x66, 0x55, 0x30, 0x04, 0xb7, 0xe3, 0x7a,
-		0x74, 0xf1, 0x48, 0x77, 0x27, 0xb2, 0x91, 0x6d, 0x39, 0x53, 0xb1, 0x0b,
-		0x3f, 0x57, 0xac, 0xc3, 0x4f, 0x78, 0xd0, 0x73, 0xaf, 0x6e, 0x19, 0xd4,
-		0x45, 0x35, 0xe3, 0x77, 0x16, 0xe4, 0xb6, 0x0a, 0xdf, 0xe3, 0x0e, 0x63,
-		0x6e, 0xe5, 0x82, 0xe9, 0x0a, 0x98, 0xa9, 0x39, 0x5b, 0xc0, 0x3b, 0x8d,
-		0xff, 0x72, 0xcd, 0x0e, 0xdb, 0xb1, 0xa8, 0xcb, 0x6b, 0x4d, 0xd4, 0xf7,
-		0x99, 0x4f, 0x36, 0x79, 0x2a, 0x24, 0x55, 0x74, 0x5c, 0xe3, 0x59, 0xc8,
-		0x0e, 0x89, 0x41, 0xf9, 0x28, 0xb2, 0x31, 0x5d, 0x53, 0x36, 0x75, 0x7d,
-		0x6f, 0x7b, 0xd4, 0xf7, 0xeb, 0xac, 0xcb, 0x82, 0xf3, 0xf8, 0x2e, 0xe1,
-		0x37, 0x76, 0x32, 0xd4, 0xfc, 0x4d, 0x1e, 0x57, 0x98, 0x4f, 0x06, 0xea,
-		0x58, 0x6a, 0xcb, 0x29, 0xbf, 0xc3, 0x32, 0x7c, 0x82, 0xc1, 0x1e, 0xcf,
-		0x98, 0x57, 0x6e, 0x5d, 0x42, 0xea, 0x6a, 0x19, 0x26, 0xa1, 0xb7, 0xe7,
-		0x6e, 0xeb, 0xda, 0xa8, 0x61, 0x39, 0x55, 0xea, 0x3f, 0x9a, 0xa7, 0x67,
-		0x43, 0x9c, 0xf7, 0xdc, 0x2f, 0xcd, 0xf0, 0x35, 0x66, 0x6a, 0xca, 0xd4,
-		0xdd, 0xd7, 0x59, 0x8d, 0x1d, 0xb0, 0x1d, 0xb7, 0xf9, 0x3a, 0x2d, 0xf1,
-		0x78, 0x7c, 0xcd, 0x33, 0x75, 0x80, 0xd5, 0xb8, 0xcb, 0x3d, 0x49, 0x3a,
-		0x9a, 0x2b, 0x79, 0x56, 0xaa, 0xf3, 0x33, 0x8f, 0xb1, 0x98, 0x4d, 0x38,
-		0xd1, 0xda, 0x4f, 0x35, 0x7e, 0xde, 0x9d, 0xf1, 0x9b, 0x76, 0x62, 0xa7,
-		0xfb, 0xad, 0x1b, 0x70, 0x8c, 0x31, 0x6d, 0x5b, 0x4c, 0x77, 0xcf, 0x7d,
-		0x5d, 0x89, 0x91, 0xda, 0x33, 0x22, 0x0b, 0x72, 0x73, 0x22, 0x35, 0x6e,
-		0x36, 0x7c, 0x73, 0x79, 0xf7, 0x14, 0xc3, 0x9d, 0x21, 0x44, 0x47, 0x50,
-		0x1d, 0xca, 0x73, 0x70, 0xed, 0x69, 0xfc, 0x97, 0x6b, 0x49, 0xc8, 0xfb,
-		0x3e, 0xda, 0xbb, 0x94, 0xcd, 0xef, 0xd8, 0x13, 0xbc, 0x86, 0x9d, 0xb8,
-		0xd3, 0x58, 0x17, 0xe3, 0xdc, 0x14, 0xea, 0xa7, 0x45, 0xd4, 0xa7, 0x0b,
-		0x43, 0xa2, 0x9d, 0xb4, 0x42, 0x0e, 0xf2, 0xb4, 0xb1, 0x7c, 0x86, 0xfa,
-		0x38, 0x19, 0x69, 0x92, 0x1b, 0xb1, 0x33, 0xff, 0xfd, 0x3b, 0x7c, 0xdf,
-		0xcd, 0xf0, 0x1c, 0xce, 0xf7, 0xb8, 0xc2, 0x00, 0x4f, 0x85, 0xfe, 0x24,
-		0xf8, 0x84, 0xdd, 0x6d, 0x78, 0x26, 0x17, 0xf2, 0x44, 0xeb, 0x82, 0xfb,
-		0x38, 0xd1, 0x78, 0x7a, 0xa3, 0x9f, 0xdc, 0xba, 0x87, 0xd4, 0xa8, 0x93,
-		0x9f, 0x39, 0x6e, 0x7c, 0x3d, 0xbc, 0xe3, 0x9e, 0x59, 0xbb, 0x16, 0xf7,
-		0x19, 0xce, 0x50, 0xbc, 0xc2, 0xcd, 0x2b, 0xf4, 0x4e, 0x6d, 0x8b, 0xf3,
-		0x9e, 0xfb, 0xa1, 0x0c, 0xee, 0xe5, 0x77, 0xfd, 0xe5, 0xc6, 0x29, 0x0c,
-		0xa5, 0x1a, 0x4e, 0x8d, 0x22, 0xfa, 0xee, 0xdc, 0xc8, 0x78, 0x0a, 0x8b,
-		0x3c, 0xa3, 0x8f, 0x74, 0x67, 0x5d, 0xaa, 0x68, 0xc2, 0x7f, 0xb1, 0x0e,
-		0xa6, 0x6a, 0xeb, 0xfd, 0x74, 0x7e, 0xf6, 0x19, 0xae, 0xc7, 0x83, 0x3c,
-		0x0f, 0x78, 0xb1, 0xb1, 0x9d, 0x48, 0x67, 0x54, 0x2f, 0x84, 0xc5, 0x89,
-		0x31, 0xd5, 0x52, 0x29, 0xb4, 0x65, 0x94, 0xde, 0xa5, 0x86, 0xd3, 0x5f,
-		0xbb, 0xf1, 0xbe, 0xec, 0xc6, 0x4f, 0x6e, 0xd9, 0x3e, 0xd0, 0xb4, 0xf8,
-		0x05, 0xb9, 0x95, 0xc6, 0xf1, 0x3c, 0x17, 0x7d, 0x3b, 0x9a, 0x19, 0xf5,
-		0xef, 0x35, 0x26, 0x1a, 0xea, 0xeb, 0xe4, 0xb0, 0xd8, 0xca, 0xe5, 0xfd,
-		0x2c, 0xc4, 0x76, 0xc2, 0xd2, 0x16, 0x0f, 0xfd, 0x3b, 0x67, 0x24, 0x8e,
-		0x8f, 0xfb, 0xfa, 0x26, 0x85, 0xe9, 0x25, 0x8d, 0xa7, 0x3b, 0x9b, 0xf5,
-		0x8f, 0x60, 0x6d, 0x9b, 0xae, 0xb0, 0x0b, 0xdb, 0xac, 0x6d, 0xf8, 0x81,
-		0xf1, 0x45, 0x55, 0x3c, 0xbc, 0x34, 0x83, 0xfe, 0x9d, 0x73, 0xbb, 0x2b,
-		0x60, 0x28, 0xeb, 0xf7, 0x1a, 0x43, 0xcf, 0xee, 0x27, 0xb7, 0xd0, 0xda,
-		0xaf, 0x88, 0x11, 0xc8, 0x45, 0x9e, 0x21, 0xba, 0xc9, 0x51, 0x8c, 0x49,
-		0xbb, 0x1b, 0xf3, 0x78, 0x5a, 0xbf, 0x8a, 0x5b, 0x6f, 0x3b, 0x35, 0xd6,
-		0x7e, 0xa7, 0x92, 0xa5, 0xff, 0xde, 0x8c, 0x8d, 0xb5, 0x07, 0xf7, 0x25,
-		0x74, 0xea, 0xe6, 0x31, 0xf8, 0x81, 0xad, 0xd5, 0x4b, 0xda, 0x48, 0xfc,
-		0xf9, 0x33, 0x0c, 0x75, 0x56, 0xde, 0x5b, 0x6e, 0x6c, 0x95, 0xfe, 0xec,
-		0xe3, 0x75, 0x31, 0xb3, 0x55, 0x5d, 0x8f, 0x76, 0x9f, 0xf2, 0x3a, 0x8c,
-		0xac, 0x65, 0x8a, 0x4a, 0x91, 0xc5, 0x3e, 0x11, 0x96, 0x13, 0x83, 0xc2,
-		0x6b, 0xe9, 0x30, 0x3e, 0xcf, 0xbd, 0xb4, 0x2d, 0xc9, 0x5f, 0x8c, 0xf4,
-		0x14, 0x5a, 0xb6, 0x73, 0x3c, 0x72, 0x4b, 0xe5, 0xe8, 0xe3, 0xb9, 0x42,
-		0xd5, 0x7f, 0x3c, 0xe5, 0x2a, 0x4a, 0xfd, 0x0f, 0xe2, 0x28, 0xa8, 0x46,
-		0x42, 0xfa, 0xdf, 0x1b, 0x8c, 0xb8, 0xd7, 0xce, 0x3d, 0xfb, 0x5d, 0xaf,
-		0xff, 0x9d, 0x21, 0x2d, 0x85, 0xfe, 0x0a, 0x53, 0xf9, 0x84, 0xbd, 0xe7,
-		0xc6, 0x28, 0xea, 0xcc, 0x53, 0x8d, 0xae, 0xb4, 0xea, 0x5f, 0x31, 0x8c,
-		0x27, 0xf4, 0x07, 0xe2, 0xce, 0x2d, 0xb2, 0xf6, 0x9f, 0x8c, 0x88, 0xfa,
-		0x55, 0xc0, 0xa7, 0x8c, 0x2e, 0xe8, 0xc4, 0xf7, 0xe8, 0xc1, 0x28, 0x48,
-		0x17, 0xed, 0x57, 0xfd, 0x67, 0x62, 0x22, 0x9f, 0xd4, 0x2f, 0x35, 0x73,
-		0xbc, 0x58, 0x49, 0xc5, 0xe5, 0x6c, 0xbd, 0x37, 0xe1, 0x52, 0xc3, 0x5c,
-		0xa9, 0x15, 0xef, 0x61, 0xc5, 0xe0, 0xfb, 0x87, 0x01, 0xbc, 0x13, 0x95,
-		0xaa, 0x0e, 0x9f, 0x81, 0xc3, 0x82, 0xef, 0xef, 0xd0, 0xa6, 0xca, 0x1f,
-		0x29, 0xa9, 0x48, 0xc9, 0xbb, 0xb0, 0xc3, 0x18, 0xd7, 0x33, 0xb2, 0x96,
-		0xde, 0x06, 0x70, 0x8b, 0x26, 0x5d, 0x67, 0x8e, 0x4b, 0x0a, 0x14, 0x3b,
-		0x4a, 0x1b, 0xf7, 0x2d, 0x32, 0xb7, 0x7e, 0x6c, 0x7f, 0x0a, 0x53, 0xff,
-		0xf1, 0x95, 0xab, 0xa8, 0xf4, 0x5f, 0x01, 0xab, 0x01, 0x5c, 0x9d, 0xc0,
-		0xf5, 0x4d, 0x62, 0x14, 0x91, 0x1c, 0xf7, 0xa9, 0xb8, 0x15, 0x60, 0x14,
-		0x22, 0xbd, 0xfe, 0xd5, 0x48, 0xfc, 0x37, 0xeb, 0x15, 0x76, 0x62, 0xfc,
-		0xf2, 0x82, 0x27, 0x6c, 0x38, 0xf3, 0xf3, 0xd2, 0x7f, 0x59, 0xb6, 0x39,
-		0xf5, 0xe3, 0xce, 0x2d, 0xb2, 0xf6, 0x3b, 0x1a, 0xa2, 0x7c, 0xd5, 0xe0,
-		0xc8, 0xa0, 0x61, 0x88, 0xed, 0xca, 0x89, 0x4b, 0xbf, 0x7f, 0xf4, 0x9f,
-		0x86, 0xff, 0xf2, 0xee, 0xae, 0xb3, 0xda, 0x3f, 0x8e, 0xc5, 0xd7, 0x51,
-		0x8c, 0x37, 0xa6, 0xae, 0x8e, 0x97, 0xdd, 0xd3, 0xf2, 0x5a, 0x68, 0xf3,
-		0x7a, 0x37, 0x2c, 0x3e, 0xe9, 0xd9, 0x8c, 0xdc, 0x11, 0x6d, 0x4b, 0x50,
-		0x33, 0x91, 0x82, 0xf7, 0x2a, 0xc2, 0xf2, 0x0f, 0x86, 0xef, 0x7b, 0x99,
-		0x27, 0x6f, 0xab, 0x27, 0xe6, 0x18, 0x9f, 0xb5, 0xf4, 0x0c, 0x63, 0x82,
-		0x45, 0xa7, 0x1b, 0xc6, 0xd9, 0x48, 0xc1, 0xfb, 0xae, 0xf8, 0x4d, 0x13,
-		0x0b, 0x2f, 0x32, 0xb7, 0xda, 0x8c, 0x63, 0x9b, 0x56, 0x88, 0xfa, 0x8f,
-		0xaf, 0x5c, 0x45, 0xa5, 0xff, 0x87, 0xf8, 0x3d, 0xe9, 0x09, 0xea, 0xff,
-		0xfe, 0x60, 0x8c, 0xbd, 0x2f, 0xf1, 0x17, 0x7b, 0x24, 0xbd, 0xfe, 0xdf,
-		0xc5, 0xb4, 0x60, 0xac, 0x7d, 0xfd, 0x15, 0xaa, 0xda, 0xfa, 0x38, 0xe4,
-		0x7d, 0x23, 0x46, 0x0e, 0xf1, 0xd2, 0xbf, 0x13, 0xa1, 0xae, 0x43, 0xdc,
-		0xb9, 0x45, 0xd6, 0xbe, 0x13, 0x33, 0x3c, 0x5d, 0x63, 0xfb, 0x0a, 0xef,
-		0x2d, 0x3a, 0xe0, 0x07, 0x4c, 0xdc, 0x4f, 0xfa, 0xaf, 0xc5, 0x88, 0x78,
-		0xb9, 0x78, 0xca, 0xe3, 0xfc, 0xba, 0xee, 0xbe, 0x63, 0xb5, 0x14, 0xcc,
-		0x99, 0x7e, 0x65, 0x0f, 0x3e, 0xd2, 0xb3, 0x0c, 0x37, 0x47, 0xc4, 0x93,
-		0x2d, 0xf8, 0xc6, 0xf9, 0xee, 0xe8, 0xe4, 0x1d, 0x6c, 0xa4, 0x65, 0xc2,
-		0xf4, 0x8d, 0x6a, 0xa6, 0x50, 0x07, 0xa3, 0x01, 0x0c, 0xf3, 0x59, 0x4b,
-		0x6a, 0x04, 0x76, 0x85, 0x26, 0xdd, 0xad, 0xbe, 0x22, 0x78, 0x45, 0xe6,
-		0x66, 0x8a, 0x80, 0x9f, 0x3c, 0xfd, 0xc7, 0x57, 0xae, 0xa2, 0xd1, 0x7f,
-		0x13, 0xec, 0x31, 0xce, 0x74, 0x63, 0xd1, 0x7f, 0x3f, 0xe4, 0xe0, 0x09,
-		0xae, 0x9a, 0xec, 0xc6, 0x38, 0xc6, 0x06, 0xd6, 0xeb, 0x7f, 0x2a, 0x2e,
-		0x06, 0x70, 0x8f, 0xe5, 0x0a, 0x6f, 0xf5, 0x19, 0xa1, 0x3c, 0x52, 0xff,
-		0x7f, 0x6b, 0xa3, 0x81, 0xfa, 0xcd, 0x2d, 0xb2, 0xf6, 0x6b, 0xf1, 0xf9,
-		0x4f, 0xd1, 0xd8, 0x12, 0x81, 0x2d, 0x31, 0x9c, 0xb2, 0x58, 0x98, 0xfa,
-		0xef, 0xce, 0x58, 0x64, 0x6d, 0x7d, 0xac, 0xd5, 0x35, 0x8c, 0xa2, 0x8e,
-		0xe7, 0xfa, 0xc6, 0x9d, 0x3e, 0xca, 0x92, 0xc6, 0x68, 0xf3, 0x37, 0x1b,
-		0xf5, 0x9f, 0x8a, 0x1f, 0x69, 0x2b, 0xd9, 0x64, 0xcc, 0xab, 0x0a, 0xf2,
-		0xb0, 0x1e, 0x01, 0x9c, 0x67, 0x88, 0xe5, 0x1c, 0x5d, 0x4b, 0xc7, 0x30,
-		0xc6, 0x5d, 0x6d, 0x4d, 0xba, 0x91, 0x96, 0x3c, 0xf6, 0xa7, 0xfe, 0xe3,
-		0x2b, 0x57, 0xd1, 0xe8, 0x5f, 0xb5, 0xa5, 0xaf, 0x25, 0x78, 0x7d, 0x93,
-		0x98, 0xd3, 0x77, 0x58, 0x44, 0x4b, 0x14, 0x70, 0x16, 0xe3, 0x10, 0xe9,
-		0xf5, 0x3f, 0x03, 0x87, 0x62, 0x0f, 0x7e, 0xb7, 0x5c, 0x61, 0x64, 0x6d,
-		0x99, 0xee, 0x4f, 0xb8, 0xfe, 0x0f, 0xe5, 0xea, 0xca, 0x11, 0x71, 0xe7,
-		0x16, 0x59, 0xfb, 0x3d, 0x01, 0xac, 0xd2, 0xae, 0x0a, 0x6f, 0x8b, 0x29,
-		0x4e, 0x5c, 0x61, 0xea, 0xbf, 0x2b, 0xc7, 0x28, 0xaf, 0x14, 0x4a, 0x5c,
-		0xbf, 0x7e, 0x8c, 0xe3, 0xf5, 0xb3, 0x47, 0xaa, 0x3b, 0x0c, 0x91, 0xce,
-		0xf3, 0xf5, 0xdf, 0x86, 0xad, 0x65, 0xad, 0x90, 0xf1, 0x40, 0x24, 0x27,
-		0xbb, 0xe3, 0x87, 0x46, 0x8c, 0xf2, 0x69, 0xae, 0xa5, 0xbf, 0xd1, 0x1b,
-		0xbd, 0x71, 0x1a, 0xee, 0xe5, 0x6a, 0xc1, 0xcd, 0x49, 0xd4, 0x99, 0x5d,
-		0xff, 0x83, 0x70, 0x4a, 0x90, 0x9a, 0x06, 0x7d, 0xfc, 0xe8, 0x91, 0xc6,
-		0x7f, 0xb9, 0x56, 0xa1, 0x6b, 0x90, 0x11, 0x45, 0xa0, 0xff, 0xb1, 0xb4,
-		0x4c, 0x64, 0x26, 0x41, 0xff, 0xbd, 0x70, 0x17, 0x80, 0x5a, 0x78, 0x04,
-		0xb9, 0xa8, 0xca, 0x18, 0x98, 0x7a, 0xfd, 0xab, 0xb9, 0xe2, 0x47, 0xee,
-		0x5c, 0xef, 0xe4, 0x24, 0xea, 0xff, 0x3e, 0x43, 0x8d, 0xc4, 0xab, 0xff,
-		0xf7, 0x8c, 0x51, 0x7e, 0x9f, 0xe0, 0xdc, 0xb6, 0x41, 0x31, 0xd0, 0x7f,
-		0x0a, 0x86, 0x70, 0x6d, 0x6d, 0x33, 0x86, 0x25, 0x35, 0x6a, 0x68, 0x1d,
-		0xbc, 0xcf, 0x5a, 0x9a, 0x8c, 0x7a, 0xd6, 0x74, 0x03, 0xd8, 0xe6, 0xde,
-		0x6d, 0xb8, 0xae, 0xf9, 0xae, 0x75, 0xe0, 0x8b, 0xb0, 0xf9, 0x40, 0xb4,
-		0xef, 0x0f, 0xb8, 0x82, 0x9d, 0x82, 0x2d, 0xc8, 0x0b, 0xb1, 0x18, 0xda,
-		0xe6, 0x2f, 0x77, 0x24, 0xb5, 0x9f, 0xb5, 0xeb, 0x3f, 0xf4, 0x67, 0x80,
-		0x41, 0x1f, 0x5e, 0x69, 0xfc, 0x97, 0xcb, 0xef, 0x2c, 0x2d, 0x59, 0xfa,
-		0xdf, 0x47, 0xab, 0x79, 0xa9, 0x24, 0xe8, 0xbf, 0x3f, 0xad, 0x9c, 0x17,
-		0xe1, 0x17, 0xfc, 0x88, 0x00, 0x66, 0x1a, 0xf5, 0xaf, 0x7a, 0x94, 0xc1,
-		0xb4, 0xf8, 0x06, 0x70, 0x52, 0xc2, 0xfa, 0xbf, 0x84, 0x63, 0xd9, 0xb6,
-		0x78, 0x8c, 0x16, 0xab, 0x73, 0x12, 0xd4, 0xff, 0x32, 0x77, 0x6c, 0xdc,
-		0x01, 0x2f, 0xb1, 0x5f, 0x6b, 0xad, 0xbd, 0xda, 0x8a, 0x5c, 0x51, 0xd8,
-		0x84, 0xcb, 0x8c, 0x36, 0x93, 0xa2, 0xb4, 0xff, 0x57, 0xc1, 0x73, 0x54,
-		0xe1, 0xec, 0x24, 0x45, 0x7e, 0x28, 0x85, 0x9b, 0xd8, 0xc3, 0xfe, 0x8d,
-		0x33, 0x3c, 0xd7, 0x1d, 0x36, 0x73, 0x3c, 0x57, 0xca, 0xa2, 0x7f, 0x75,
-		0xa7, 0x3f, 0xb5, 0xea, 0x7f, 0x1a, 0x9f, 0x9d, 0x80, 0x1b, 0x37, 0xb9,
-		0x8f, 0xb1, 0x96, 0xb6, 0xe0, 0x05, 0xbc, 0x80, 0x09, 0x98, 0xc5, 0xd1,
-		0xff, 0xbd, 0x45, 0xa6, 0xff, 0x17, 0xf0, 0x54, 0x90, 0x96, 0x06, 0x7d,
-		0xac, 0xf4, 0x48, 0x53, 0x50, 0xae, 0xd6, 0x58, 0xec, 0xa2, 0xb7, 0xff,
-		0xff, 0x8b, 0x57, 0x83, 0x7c, 0x59, 0x04, 0xfa, 0x77, 0x7e, 0x2e, 0x49,
-		0x82, 0xfe, 0x4f, 0x43, 0x69, 0x6c, 0xc3, 0x67, 0xc8, 0xc3, 0x03, 0x08,
-		0xd0, 0x47, 0x43, 0xaf, 0xff, 0x85, 0x5c, 0x71, 0xd8, 0x89, 0xe5, 0x48,
-		0x41, 0xb7, 0x84, 0xf5, 0x5f, 0xf0, 0x93, 0x87, 0xbb, 0x7c, 0x3d, 0x13,
-		0x36, 0xfd, 0x87, 0xfe, 0xec, 0xb2, 0x44, 0x83, 0x3c, 0x1c, 0x73, 0x99,
-		0xe6, 0x57, 0x1f, 0xf3, 0x80, 0xa2, 0x58, 0xff, 0xef, 0x80, 0xf9, 0x6c,
-		0xcb, 0xc7, 0xba, 0x2b, 0xcc, 0xf1, 0xd3, 0x09, 0x0b, 0x98, 0xd3, 0x98,
-		0x90, 0x15, 0x13, 0xb3, 0x77, 0x99, 0x5a, 0x77, 0xa8, 0x61, 0xbc, 0x2e,
-		0x3f, 0xfa, 0x4f, 0x65, 0x1b, 0x72, 0x38, 0x5f, 0x3f, 0x08, 0x18, 0xee,
-		0x61, 0x78, 0x2d, 0xb5, 0xa6, 0xb7, 0xc0, 0x35, 0x25, 0x72, 0xfe, 0xdf,
-		0xde, 0xd2, 0xb3, 0xef, 0x8f, 0xf9, 0x3f, 0xf0, 0x26, 0x80, 0x3f, 0x2d,
-		0x3d, 0x99, 0x5f, 0xfd, 0x9f, 0x85, 0x00, 0x3e, 0x66, 0x8e, 0x3d, 0x10,
-		0xa0, 0x3e, 0xf4, 0xfa, 0x5f, 0xc4, 0x57, 0xef, 0xd2, 0x56, 0x7f, 0x42,
-		0xc2, 0xfa, 0x9f, 0xcf, 0xb5, 0xac, 0x8f, 0x31, 0xda, 0xb8, 0x76, 0x14,
-		0x8b, 0xfe, 0x77, 0x32, 0xb7, 0x2d, 0xb4, 0x52, 0x1e, 0xe1, 0xd1, 0x4b,
-		0xde, 0xce, 0x5e, 0x32, 0x0f, 0xa3, 0x3d, 0x46, 0xde, 0x45, 0xe3, 0xff,
-		0x93, 0xdf, 0x6b, 0xaf, 0xc5, 0x79, 0x71, 0x6b, 0xbf, 0x1a, 0xc6, 0x73,
-		0x14, 0x35, 0xc7, 0xd7, 0x48, 0x22, 0x83, 0x9e, 0x1c, 0x83, 0x2d, 0xd7,
-		0xe5, 0x47, 0xff, 0xcd, 0x00, 0xac, 0x41, 0x05, 0x72, 0x81, 0x9b, 0xd6,
-		0xbb, 0x96, 0x7a, 0x70, 0x7c, 0x92, 0x5e, 0x02, 0xf5, 0x9f, 0xc6, 0x2b,
-		0x3d, 0xa3, 0xd8, 0xe8, 0x7f, 0x22, 0x0e, 0x61, 0x6b, 0x7a, 0x41, 0xc2,
-		0xfa, 0x1f, 0x84, 0x00, 0xae, 0xa5, 0x86, 0x94, 0x3f, 0xec, 0x3c, 0xa3,
-		0xfe, 0x9d, 0x2b, 0x3c, 0x0b, 0xc0, 0x18, 0xb4, 0x4d, 0xe2, 0xfc, 0x3f,
-		0x90, 0x04, 0xfd, 0x3b, 0x65, 0xbb, 0x81, 0x51, 0x54, 0x53, 0x7d, 0xf8,
-		0xdd, 0x4c, 0x60, 0x5e, 0xe3, 0x8a, 0x81, 0xfe, 0x15, 0x75, 0x69, 0x57,
-		0xd9, 0x13, 0xe2, 0x9b, 0x10, 0x1b, 0x8f, 0x72, 0xfc, 0x79, 0x95, 0xcf,
-		0x18, 0xf8, 0x8e, 0x1f, 0x50, 0x99, 0x04, 0xf5, 0x7f, 0x71, 0xc4, 0xa8,
-		0x6b, 0x8b, 0xb6, 0xde, 0x23, 0x6b, 0x29, 0x85, 0xa3, 0x86, 0xa3, 0x4a,
-		0xac, 0xfd, 0xbf, 0x4f, 0xb1, 0xd1, 0x7f, 0x0f, 0xee, 0xd3, 0x50, 0x96,
-		0xd7, 0xb4, 0x04, 0xf5, 0xaf, 0x5a, 0x90, 0xe6, 0xc1, 0x16, 0x7c, 0xbe,
-		0x87, 0xfe, 0xcb, 0x62, 0x3b, 0xd6, 0xe0, 0xe8, 0x62, 0xa9, 0xff, 0xf2,
-		0xd8, 0x08, 0x60, 0xa0, 0xaf, 0x9a, 0x3d, 0x9f, 0x73, 0xef, 0x3e, 0xc5,
-		0x42, 0xff, 0x8a, 0x81, 0xc6, 0x35, 0x74, 0x6f, 0x2a, 0xe0, 0xc9, 0x18,
-		0xa2, 0x60, 0x76, 0xa5, 0xbd, 0x24, 0xe0, 0x53, 0xff, 0x3d, 0x0c, 0xd7,
-		0xf5, 0x1c, 0xe7, 0x10, 0xf9, 0x73, 0xe2, 0x3d, 0x21, 0xbe, 0xe1, 0xb6,
-		0x5a, 0x0a, 0x60, 0xb9, 0xd6, 0xd7, 0x23, 0x3e, 0xfd, 0xd7, 0xa2, 0x0f,
-		0x45, 0xfa, 0x01, 0xac, 0x7f, 0xe5, 0xf3, 0xda, 0xdc, 0xe8, 0xff, 0x93,
-		0xc1, 0x95, 0xf3, 0xc1, 0x09, 0xea, 0xff, 0x52, 0x77, 0x3e, 0xe7, 0xac,
-		0x8c, 0xff, 0xe6, 0xa1, 0x7f, 0x27, 0x56, 0xf1, 0x85, 0xc5, 0x52, 0xff,
-		0x01, 0xdc, 0xc6, 0x35, 0x1d, 0x7f, 0x6b, 0xfc, 0x4f, 0x44, 0xf8, 0x76,
-		0xc5, 0xae, 0xff, 0xd0, 0x55, 0xaf, 0xbe, 0x00, 0x7e, 0x29, 0x21, 0x7b,
-		0x8d, 0x53, 0x2d, 0x35, 0x94, 0xaf, 0xff, 0xd3, 0x5c, 0xbf, 0x3f, 0xe5,
-		0xff, 0xf7, 0xbd, 0x26, 0xdd, 0x2f, 0x61, 0xf7, 0x50, 0xd9, 0x02, 0x2f,
-		0xf6, 0xa1, 0x58, 0x67, 0xee, 0xd1, 0x30, 0x49, 0x7e, 0x36, 0xbd, 0xb8,
-		0x2f, 0x2c, 0x50, 0xc8, 0xfe, 0x3f, 0x13, 0x22, 0xee, 0x72, 0x61, 0xea,
-		0xff, 0x11, 0xcc, 0x0a, 0xe9, 0xbf, 0x4a, 0xd1, 0xca, 0x5f, 0xdb, 0xe2,
-		0xff, 0x7f, 0x35, 0xe7, 0xe5, 0xa9, 0x09, 0xe9, 0xff, 0xf2, 0x28, 0x9f,
-		0x2e, 0xbb, 0xfe, 0x4f, 0xa5, 0x2f, 0xa0, 0xc9, 0xff, 0x67, 0x42, 0x1c,
-		0xfe, 0x3f, 0xfe, 0xea, 0xbe, 0xaa, 0x0f, 0xfd, 0x57, 0xe6, 0x88, 0xa9,
-		0x8f, 0x2f, 0x15, 0x1c, 0xcb, 0x51, 0x73, 0xbc, 0xfa, 0x6f, 0xc3, 0xfe,
-		0xaf, 0xe0, 0xfd, 0x79, 0xb4, 0xa8, 0x97, 0xfc, 0x73, 0x08, 0xf2, 0xf5,
-		0x5f, 0x87, 0xd6, 0xfa, 0xcb, 0xa9, 0xec, 0xb1, 0x9a, 0x11, 0x87, 0x7a,
-		0x32, 0x0b, 0xf6, 0x1a, 0xdd, 0x6b, 0x58, 0x73, 0x8d, 0x54, 0xc6, 0x15,
-		0x5c, 0x29, 0x8f, 0x7e, 0x5e, 0xff, 0x1b, 0xe1, 0x8b, 0xdd, 0x11, 0xb3,
-		0xf0, 0xba, 0x47, 0x6e, 0x29, 0x98, 0x0c, 0x68, 0x23, 0x03, 0x27, 0x4f,
-		0xff, 0xd7, 0x00, 0xf8, 0x30, 0xe2, 0x2e, 0x17, 0xa6, 0xfe, 0x9f, 0x0b,
-		0xab, 0xc7, 0x2e, 0x5c, 0x21, 0x4e, 0xb7, 0xe8, 0xbf, 0x0c, 0xd6, 0x18,
-		0x56, 0xcf, 0xfc, 0xeb, 0x3f, 0x7c, 0xdc, 0xf9, 0x87, 0xa7, 0xfe, 0x33,
-		0xb0, 0x85, 0x91, 0xd7, 0xe7, 0x6b, 0xef, 0x62, 0x68, 0x6d, 0x35, 0xe0,
-		0x4c, 0x33, 0x10, 0xa7, 0xfe, 0xaf, 0xd6, 0xe4, 0x96, 0xe3, 0xb9, 0xfb,
-		0xf2, 0x1e, 0xee, 0x68, 0xd0, 0xe5, 0x37, 0x18, 0x53, 0x30, 0x3c, 0x62,
-		0xf4, 0xb8, 0xcf, 0x32, 0x67, 0xb6, 0xdf, 0xa9, 0xca, 0xdc, 0x4b, 0xdb,
-		0x38, 0xf8, 0xfe, 0x79, 0xa3, 0xd7, 0x41, 0x71, 0xa3, 0x15, 0x46, 0x63,
-		0xb8, 0x61, 0xef, 0x73, 0x80, 0x2b, 0x3b, 0x0b, 0x83, 0xfb, 0xa8, 0x40,
-		0x2f, 0x93, 0xa3, 0xb4, 0xa9, 0xfe, 0x0a, 0x9b, 0xbd, 0xe8, 0x47, 0x3f,
-		0xa1, 0xf7, 0xa6, 0x12, 0xae, 0xe7, 0x5e, 0xcf, 0x1b, 0x35, 0xe9, 0x7a,
-		0x70, 0x5d, 0xb6, 0x7c, 0xd8, 0x5d, 0xfc, 0xc4, 0x9a, 0x5b, 0x7d, 0xbc,
-		0x46, 0xff, 0xc4, 0xac, 0x42, 0xd5, 0xbf, 0xda, 0x61, 0xb4, 0x3e, 0xa4,
-		0x07, 0x7b, 0xbe, 0x90, 0xf5, 0x7f, 0x12, 0xed, 0x40, 0xbd, 0xdc, 0xf5,
-		0xe1, 0xb9, 0x86, 0xbd, 0xbd, 0xa1, 0xfb, 0xff, 0xaf, 0xe3, 0xfd, 0x4a,
-		0x2d, 0x42, 0xfd, 0x3b, 0xfb, 0x3e, 0x74, 0x57, 0xd8, 0x8d, 0xb5, 0x95,
-		0x11, 0xd6, 0xda, 0xcf, 0x8d, 0x5b, 0xff, 0x3d, 0x35, 0xb9, 0x2d, 0xf0,
-		0xec, 0x63, 0xaa, 0xd2, 0x9a, 0xde, 0x5d, 0x93, 0xee, 0x52, 0x3e, 0xa3,
-		0x05, 0xed, 0xc7, 0x39, 0x00, 0xfe, 0x88, 0xbb, 0xff, 0x0f, 0x70, 0xff,
-		0xf9, 0xe7, 0x28, 0xe7, 0x96, 0x61, 0xb7, 0xb6, 0xde, 0x8a, 0x1f, 0xa5,
-		0xe8, 0x77, 0x64, 0xf6, 0xc4, 0xc9, 0x0a, 0xee, 0x9e, 0x4a, 0xc5, 0x60,
-		0x3c, 0x83, 0x87, 0xb5, 0xf3, 0x7a, 0x35, 0x36, 0x7b, 0x3b, 0xaa, 0x2d,
-		0xad, 0xa0, 0xbd, 0x37, 0x39, 0x58, 0x8d, 0xd5, 0xd8, 0xc0, 0x11, 0x83,
-		0x5a, 0x95, 0x4f, 0xd1, 0xfa, 0x2c, 0xaf, 0xe1, 0x0c, 0x20, 0xc3, 0x5d,
-		0xcb, 0xdc, 0xce, 0x39, 0xa6, 0x39, 0xb7, 0xcd, 0xcc, 0x6b, 0x27, 0x86,
-		0x58, 0xce, 0xff, 0x58, 0xcb, 0x94, 0xf9, 0x7c, 0x1e, 0x97, 0x3e, 0x2a,
-		0x61, 0x2b, 0x80, 0x97, 0xdd, 0x13, 0x10, 0x7a, 0x72, 0x34, 0x14, 0xaf,
-		0xfe, 0xff, 0x64, 0x39, 0x36, 0x06, 0xaf, 0x61, 0x35, 0x46, 0x68, 0xbe,
-		0xf1, 0x6d, 0xae, 0x4d, 0xcd, 0xc3, 0x34, 0xce, 0xfd, 0x37, 0x68, 0x57,
-		0xb3, 0x42, 0xf5, 0x5f, 0x16, 0xeb, 0x00, 0xad, 0xc7, 0xc7, 0x50, 0xb6,
-		0x8f, 0xa1, 0x75, 0xb0, 0x32, 0x49, 0xfa, 0xef, 0x63, 0xd0, 0x7f, 0x29,
-		0xda, 0x23, 0x5e, 0x70, 0xfd, 0x4a, 0x5a, 0xf2, 0x49, 0xbb, 0x39, 0x6e,
-		0xfd, 0x67, 0x60, 0x55, 0x54, 0x6e, 0xb7, 0xfa, 0x18, 0x63, 0x3e, 0xec,
-		0x7a, 0xae, 0x45, 0xef, 0x8e, 0xdb, 0xcd, 0xdd, 0x67, 0xf9, 0xf9, 0xad,
-		0x34, 0xae, 0x5a, 0xfb, 0xd3, 0x7f, 0x63, 0xce, 0x35, 0x36, 0x61, 0x2a,
-		0x66, 0x73, 0xf5, 0xed, 0xb5, 0x12, 0xd1, 0xfb, 0x57, 0x75, 0x7b, 0xf5,
-		0x37, 0x8c, 0x67, 0x67, 0xa9, 0x5a, 0x6a, 0xe7, 0xa3, 0xdf, 0x08, 0xbf,
-		0xb3, 0x6b, 0xad, 0xe7, 0x46, 0xa8, 0x67, 0x7e, 0x3d, 0xde, 0x47, 0x3f,
-		0x4b, 0x4f, 0x9b, 0xc3, 0xf6, 0x7e, 0x3a, 0x7e, 0x62, 0x6d, 0xea, 0xce,
-		0x7a, 0x28, 0xc8, 0x6d, 0x3b, 0x7e, 0xc7, 0x93, 0x68, 0x62, 0xc8, 0xab,
-		0xbc, 0x2f, 0x7f, 0x3c, 0x7f, 0xe7, 0x7f, 0x8c, 0x70, 0xcf, 0x2d, 0x9a,
-		0x82, 0x39, 0xd8, 0x85, 0x13, 0x13, 0xd0, 0xff, 0xce, 0xa8, 0x32, 0xdd,
-		0xa7, 0x6d, 0x09, 0x47, 0x51, 0xf9, 0xca, 0xb2, 0x39, 0x55, 0xb3, 0x2b,
-		0x36, 0x52, 0xff, 0xea, 0xf4, 0x17, 0xe5, 0x9b, 0x97, 0xe2, 0xe9, 0xdf,
-		0xa8, 0x5a, 0xe8, 0xe4, 0xe8, 0xbf, 0x94, 0x71, 0x57, 0x48, 0x5f, 0xde,
-		0xc5, 0x35, 0x98, 0x8c, 0x19, 0x6c, 0xef, 0x67, 0x6b, 0xcf, 0xec, 0xf1,
-		0xa7, 0x7f, 0xe5, 0xa5, 0xba, 0x37, 0x2c, 0xb7, 0xb9, 0xda, 0x33, 0x32,
-		0xa2, 0xf7, 0xff, 0xa9, 0x51, 0x66, 0x47, 0x4d, 0xca, 0xeb, 0x58, 0x0b,
-		0xab, 0x30, 0x0d, 0x73, 0x58, 0xce, 0xf9, 0x6e, 0xef, 0x1d, 0xaf, 0xa5,
-		0xb6, 0x39, 0xbe, 0x70, 0x4f, 0x1c, 0xda, 0x84, 0x3b, 0x7d, 0xae, 0xbe,
-		0xed, 0x7f, 0xa6, 0x72, 0x8c, 0xd9, 0xdf, 0xf8, 0xf9, 0x9b, 0xf4, 0x8f,
-		0x6a, 0x52, 0xe4, 0xe5, 0xea, 0xe6, 0xfa, 0x66, 0xa9, 0x39, 0xef, 0xc3,
-		0xc6, 0xf5, 0xc9, 0xa2, 0xe7, 0x16, 0xb6, 0xf3, 0x6a, 0xcd, 0xa4, 0x1f,
-		0x5b, 0x96, 0xf9, 0x85, 0xfe, 0x8d, 0x19, 0x68, 0x8a, 0x56, 0x06, 0x8f,
-		0xea, 0xe2, 0x4e, 0xd7, 0xe0, 0x5d, 0xdc, 0x8a, 0xe7, 0x42, 0x66, 0x74,
-		0xf1, 0xe6, 0x36, 0xdb, 0x55, 0xd8, 0x76, 0x3c, 0x8b, 0x2a, 0x09, 0x97,
-		0xee, 0x1c, 0xae, 0x6f, 0x80, 0x96, 0xbf, 0xa7, 0x12, 0xf6, 0xb9, 0x73,
-		0xfa, 0xd3, 0x56, 0x68, 0x64, 0x3c, 0x21, 0xab, 0x78, 0x5a, 0xff, 0x9b,
-		0x5b, 0xf7, 0x1d, 0x65, 0x72, 0x3f, 0xb6, 0x9a, 0xdf, 0xcf, 0x23, 0x93,
-		0x8b, 0xb0, 0x6c, 0x35, 0x91, 0x85, 0xc6, 0x56, 0xaf, 0xf6, 0xfd, 0x41,
-		0x19, 0x34, 0x45, 0xbd, 0xa4, 0xee, 0xd3, 0x38, 0xb0, 0xa9, 0x8e, 0xd6,
-		0x68, 0x64, 0xb4, 0x30, 0xc5, 0x7e, 0x36, 0xa6, 0x1a, 0x0b, 0x55, 0x48,
-		0x5a, 0xe9, 0x0e, 0x47, 0x16, 0x9a, 0x24, 0xad, 0x74, 0x07, 0x22, 0x35,
-		0xf1, 0x82, 0x3b, 0x06, 0x45, 0x84, 0x9d, 0x4f, 0x10, 0x8a, 0xde, 0x62,
-		0xa5, 0xac, 0x3d, 0xe7, 0x4a, 0x4d, 0x14, 0x31, 0x95, 0x50, 0x9d, 0x54,
-		0x95, 0xba, 0x10, 0xf6, 0x2b, 0x0f, 0x70, 0xc6, 0xfa, 0x34, 0xae, 0xd6,
-		0xda, 0xa2, 0x05, 0x41, 0x38, 0x90, 0x29, 0xed, 0x9e, 0x93, 0x69, 0xdf,
-		0xef, 0x28, 0x08, 0xc2, 0x81, 0x4a, 0x16, 0x86, 0x61, 0x04, 0x5a, 0x49,
-		0x4d, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82,
-		0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82,
-		0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82,
-		0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x50, 0x48, 0xbc, 0x89, 0x6c, 0x5c,
-		0x15, 0xf6, 0x9b, 0xdf, 0x90, 0x8d, 0x2e, 0x51, 0xe9, 0x0e, 0x43, 0x36,
-		0x36, 0x45, 0x9c, 0x87, 0x75, 0x15, 0xb2, 0xf1, 0x4c, 0x54, 0xca, 0x1b,
-		0x91, 0x8d, 0xaf, 0x42, 0xde, 0x77, 0x44, 0x36, 0xd6, 0x6a, 0xce, 0x90,
-		0x7b, 0x0c, 0xd9, 0x61, 0xe7, 0x94, 0x57, 0xc7, 0x3f, 0xc8, 0x0e, 0x39,
-		0xc7, 0x3c, 0x9f, 0x2e, 0xc8, 0x8e, 0x62, 0x66, 0x54, 0xaa, 0x76, 0x18,
-		0x18, 0x42, 0xf4, 0xa9, 0xcb, 0xb5, 0xb4, 0xbf, 0x8d, 0xa4, 0x5a, 0x58,
-		0x2e, 0x03, 0x2d, 0xe7, 0xbc, 0x5d, 0x8a, 0x09, 0x78, 0x59, 0x13, 0x11,
-		0x23, 0x1f, 0xbf, 0x91, 0xb8, 0xb3, 0xf0, 0x5f, 0x8f, 0x32, 0x95, 0x42,
-		0x3b, 0xf4, 0x43, 0x57, 0xe3, 0x49, 0x69, 0xaa, 0x7e, 0x66, 0xfb, 0xbe,
-		0xdf, 0x29, 0x68, 0x81, 0x93, 0xd1, 0x09, 0x95, 0x7d, 0xa6, 0xef, 0xa9,
-		0xad, 0xed, 0xfc, 0xbc, 0x9a, 0xa1, 0x37, 0x3a, 0xf9, 0x3c, 0x1f, 0xf0,
-		0x10, 0xd4, 0xf6, 0x88, 0x76, 0x5d, 0x0d, 0x5d, 0xd1, 0x99, 0xe7, 0x6b,
-		0x65, 0x20, 0x33, 0x24, 0xa6, 0x43, 0x3c, 0x57, 0x9a, 0x85, 0xef, 0x31,
-		0x03, 0x4d, 0x7d, 0xa4, 0x3c, 0x02, 0x9f, 0xe2, 0x27, 0xcd, 0x49, 0xa3,
-		0xb3, 0x90, 0x8d, 0x4e, 0x9e, 0x7f, 0x3d, 0x2a, 0xe4, 0xa9, 0x2c, 0x6d,
-		0x48, 0x53, 0x05, 0x99, 0x28, 0x87, 0xba, 0xe8, 0xc5, 0x5a, 0x2f, 0x85,
-		0x6e, 0x9a, 0xa7, 0xdc, 0xa9, 0xa1, 0x4c, 0x54, 0xe7, 0xab, 0x46, 0xe8,
-		0x8d, 0xd6, 0xd6, 0x73, 0xde, 0x62, 0xab, 0x7b, 0x33, 0xff, 0x17, 0x71,
-		0x02, 0x6f, 0x4d, 0x9e, 0x71, 0x56, 0x49, 0xf3, 0x7d, 0xea, 0xd4, 0xd8,
-		0x9a, 0x61, 0xbf, 0x7b, 0x40, 0x7b, 0x72, 0x6c, 0x4d, 0x9e, 0xdb, 0xdb,
-		0x3e, 0xf8, 0x7e, 0xa2, 0x21, 0x36, 0x86, 0x8a, 0xf5, 0xbe, 0x2d, 0xe4,
-		0xdc, 0xd3, 0x6b, 0x18, 0x31, 0x29, 0x3a, 0x5d, 0x57, 0xec, 0x0c, 0x63,
-		0x9f, 0x56, 0x49, 0x13, 0xc3, 0x94, 0x16, 0x1d, 0x01, 0xe0, 0x28, 0x9e,
-		0x41, 0xed, 0x75, 0x76, 0x5b, 0xa4, 0x6a, 0x8f, 0x37, 0xa4, 0xeb, 0xc0,
-		0x53, 0x5b, 0x81, 0xaf, 0x8d, 0x67, 0xad, 0x76, 0x0a, 0x3b, 0xef, 0xda,
-		0x74, 0xf2, 0xf7, 0x09, 0xd8, 0x83, 0x5c, 0xf7, 0x94, 0x7d, 0xfd, 0x5d,
-		0x1e, 0x8e, 0xec, 0x60, 0x74, 0xea, 0x4f, 0x50, 0xc7, 0x50, 0xe6, 0x25,
-		0x3e, 0xef, 0xf6, 0x29, 0x58, 0xea, 0xe6, 0xb6, 0x07, 0x13, 0x7c, 0xb5,
-		0x01, 0xe6, 0x08, 0x02, 0xfd, 0x79, 0x42, 0xaf, 0xfa, 0xd9, 0x8b, 0xb7,
-		0x3c, 0x62, 0x1c, 0x94, 0xc6, 0xb3, 0x3c, 0x0b, 0x77, 0x37, 0x9e, 0x35,
-		0x7c, 0x6b, 0x2a, 0x46, 0xf1, 0xb9, 0x01, 0xb2, 0x71, 0xbe, 0xcf, 0xe8,
-		0x66, 0x36, 0x26, 0xba, 0x67, 0xbc, 0x7b, 0xa7, 0xbc, 0x83, 0x29, 0xbf,
-		0x8b, 0xfa, 0xfd, 0x42, 0x5f, 0xe7, 0xe8, 0x3f, 0xc6, 0x67, 0x72, 0x17,
-		0xf3, 0x30, 0x9d, 0xbd, 0x39, 0x89, 0x31, 0x92, 0xf7, 0xf0, 0x24, 0xf8,
-		0x06, 0x98, 0x45, 0x85, 0x5d, 0x63, 0xbc, 0x93, 0x15, 0x18, 0x4d, 0x06,
-		0x54, 0x83, 0x29, 0x0e, 0x67, 0x2c, 0x75, 0x6f, 0xe7, 0xa4, 0x88, 0xd8,
-		0x03, 0xfd, 0x82, 0x51, 0x37, 0x22, 0x59, 0x12, 0x15, 0x01, 0x4e, 0x45,
-		0xef, 0xbe, 0x42, 0x93, 0x72, 0x3c, 0x10, 0x8c, 0x99, 0x53, 0x8b, 0x27,
-		0x27, 0xb7, 0xd6, 0x3e, 0xdb, 0x4b, 0xc3, 0x62, 0xc6, 0xfd, 0x08, 0x44,
-		0x8c, 0x44, 0xf4, 0xcf, 0xc9, 0xaf, 0x8c, 0xfb, 0xaa, 0xbb, 0xdf, 0x33,
-		0x31, 0xd6, 0xe5, 0x16, 0xcd, 0x5f, 0x2e, 0x74, 0x23, 0x4c, 0xdb, 0x68,
-		0x1c, 0xcc, 0x61, 0x2c, 0xb6, 0x19, 0xf5, 0x5f, 0x19, 0x7f, 0x01, 0x78,
-		0x88, 0xff, 0xde, 0x9e, 0x50, 0xeb, 0x9b, 0x8a, 0xf7, 0x78, 0xd6, 0xb8,
-		0x29, 0x66, 0xe2, 0xdd, 0xbc, 0xc7, 0xdf, 0xe2, 0x79, 0x7c, 0xc0, 0xf6,
-		0xf7, 0x0f, 0xcd, 0x88, 0xc4, 0xbf, 0x2a, 0x4e, 0x67, 0xa4, 0xc9, 0xf9,
-		0x78, 0x01, 0xd3, 0x78, 0x57, 0x66, 0xfb, 0x38, 0x2d, 0xd6, 0xa4, 0x7f,
-		0x27, 0xaf, 0xc5, 0x78, 0x11, 0xef, 0xb2, 0x64, 0x0b, 0xac, 0xe7, 0x58,
-		0x3e, 0xce, 0x73, 0xd7, 0x7f, 0xa6, 0x4e, 0x5e, 0xd7, 0xa6, 0xb8, 0x8b,
-		0x57, 0xba, 0x08, 0x2f, 0xe0, 0x03, 0xec, 0x62, 0x1c, 0xf7, 0xc4, 0xf4,
-		0xff, 0x38, 0xf3, 0xbb, 0xdb, 0x47, 0xca, 0xcb, 0x98, 0xf2, 0xbd, 0x38,
-		0xf5, 0x9f, 0x3f, 0x76, 0xf5, 0xd2, 0xff, 0x6e, 0xbc, 0xc1, 0xd3, 0x9b,
-		0x97, 0xe0, 0x5b, 0xcc, 0xe1, 0xa9, 0xbf, 0x19, 0x86, 0xeb, 0x7b, 0x17,
-		0x2b, 0xf0, 0x12, 0x3e, 0x66, 0x0f, 0xb3, 0x44, 0x9b, 0x67, 0x6c, 0x75,
-		0x6f, 0xa7, 0x32, 0x72, 0x91, 0x17, 0xd2, 0x82, 0xfc, 0xcf, 0xd8, 0x6a,
-		0x4e, 0x07, 0xd0, 0x39, 0xec, 0x37, 0xef, 0x03, 0xe8, 0xab, 0x49, 0xd9,
-		0x8a, 0xfd, 0x8b, 0x13, 0x91, 0xff, 0x1e, 0x43, 0x0c, 0x84, 0xfc, 0xb1,
-		0x47, 0x7e, 0xb4, 0xee, 0xe6, 0xfc, 0x1b, 0xef, 0x13, 0xfe, 0x06, 0x32,
-		0x5d, 0x1d, 0xad, 0xfe, 0x87, 0x5b, 0xff, 0xf2, 0x1e, 0xe3, 0xb3, 0xa7,
-		0x67, 0x95, 0x51, 0xff, 0x6f, 0x51, 0x3b, 0xe9, 0xe8, 0x8a, 0x5c, 0xe4,
-		0x68, 0xcf, 0x77, 0xf7, 0x4f, 0x39, 0xc6, 0xb9, 0xfe, 0x4a, 0x3b, 0x8e,
-		0x70, 0xe2, 0x44, 0x5c, 0xe4, 0xbe, 0xab, 0x8d, 0xd5, 0x80, 0x26, 0x52,
-		0x87, 0x5f, 0x55, 0x38, 0x91, 0x4d, 0x1e, 0x76, 0xcf, 0xe7, 0x6f, 0xc5,
-		0x71, 0xc5, 0xe5, 0x71, 0xea, 0xbf, 0x34, 0x63, 0x7d, 0x8c, 0x71, 0x47,
-		0xa8, 0x0d, 0x18, 0x6d, 0xe3, 0x76, 0xcb, 0x35, 0xaa, 0xbe, 0xaf, 0x3f,
-		0x23, 0xdd, 0xa9, 0xa7, 0xad, 0x66, 0x54, 0x8a, 0x4a, 0x6c, 0x6d, 0xf3,
-		0xf3, 0x6b, 0xcb, 0xb2, 0x25, 0xa6, 0xff, 0xf2, 0xb8, 0x06, 0xc3, 0x7c,
-		0x9d, 0xdd, 0x9e, 0x8e, 0x8b, 0x71, 0xa3, 0xe6, 0xc9, 0x4b, 0xae, 0xfe,
-		0x47, 0xb9, 0x51, 0x92, 0x37, 0xe3, 0x10, 0x94, 0x65, 0xd4, 0xb2, 0xd6,
-		0xda, 0xeb, 0xdb, 0x89, 0x8f, 0xdd, 0x79, 0x44, 0x7b, 0xb6, 0x96, 0x43,
-		0x12, 0xac, 0x7b, 0x6f, 0x7e, 0x75, 0x63, 0x38, 0x3b, 0xa8, 0xb1, 0xc7,
-		0x50, 0x6d, 0xba, 0x17, 0x01, 0x9c, 0x16, 0xf6, 0x9b, 0x6f, 0x00, 0xb4,
-		0xd4, 0xa6, 0xfd, 0x1c, 0xc0, 0x9d, 0x9c, 0xc7, 0x6d, 0x00, 0x30, 0xc0,
-		0xf0, 0xcd, 0x47, 0x32, 0xb2, 0x9f, 0x13, 0x57, 0xe6, 0x41, 0xc6, 0x72,
-		0xf4, 0x2e, 0xed, 0x6c, 0x00, 0x2f, 0x1a, 0xc6, 0x7b, 0x76, 0xfd, 0xb7,
-		0x65, 0x6c, 0xf0, 0xd2, 0x09, 0xeb, 0xff, 0x52, 0xde, 0xa5, 0xa6, 0xee,
-		0xe8, 0x0f, 0x58, 0x9e, 0xd0, 0xf8, 0x4b, 0xe9, 0x7a, 0xad, 0x21, 0xfe,
-		0x4b, 0x47, 0xac, 0x0c, 0x8b, 0x5a, 0x35, 0x1c, 0xc0, 0xf4, 0xb8, 0x55,
-		0xd1, 0x8d, 0xd1, 0x43, 0x0a, 0x9e, 0xd1, 0x5b, 0x3c, 0xa2, 0xce, 0xda,
-		0xf4, 0xdf, 0x83, 0xa3, 0x96, 0x82, 0xbc, 0x2e, 0xb1, 0x46, 0x23, 0x68,
-		0xcb, 0x91, 0xaf, 0xf3, 0xfa, 0x4b, 0x2c, 0xd5, 0xc4, 0x74, 0xe9, 0x1b,
-		0x91, 0xdf, 0xd3, 0x09, 0xeb, 0x3f, 0x71, 0x92, 0xab, 0xff, 0x2b, 0x11,
-		0x40, 0xef, 0x60, 0x1c, 0x0f, 0x35, 0xf2, 0xed, 0x6a, 0x98, 0x7d, 0x1e,
-		0x15, 0x56, 0x0b, 0x13, 0x12, 0xac, 0x7b, 0x6f, 0x5e, 0x08, 0xeb, 0x55,
-		0x54, 0xdb, 0x72, 0xb4, 0x36, 0xdd, 0x9d, 0x6e, 0xcb, 0x90, 0x89, 0x73,
-		0xdc, 0xe8, 0x39, 0x2a, 0x82, 0x41, 0x65, 0xc3, 0xfc, 0x44, 0xc5, 0x24,
-		0x3d, 0x84, 0xd1, 0x99, 0xff, 0xb0, 0xd8, 0x31, 0xbe, 0x00, 0x70, 0x13,
-		0x02, 0x48, 0xa3, 0xda, 0xfa, 0xfb, 0xb0, 0x46, 0xa9, 0xb9, 0x53, 0xe3,
-		0xb8, 0xf4, 0x9f, 0xc2, 0xef, 0x38, 0x29, 0x41, 0xfd, 0x37, 0x65, 0xdb,
-		0x7d, 0x9d, 0xfb, 0xae, 0x0c, 0x16, 0x03, 0x78, 0x27, 0xc1, 0x27, 0xed,
-		0x38, 0xec, 0x42, 0x6e, 0x48, 0x1b, 0x1c, 0x30, 0xce, 0xfa, 0x54, 0x7c,
-		0x1d, 0xb3, 0x2a, 0x94, 0xd5, 0x28, 0xcb, 0x68, 0x91, 0x50, 0xbd, 0xcf,
-		0xa4, 0x30, 0x8b, 0xe9, 0x34, 0x8c, 0xf3, 0xb4, 0xc4, 0xe9, 0xf5, 0x1f,
-		0x99, 0x57, 0x03, 0x8e, 0xca, 0x4c, 0xe5, 0x3e, 0x91, 0x71, 0x5c, 0x6c,
-		0x57, 0x76, 0x75, 0x44, 0x7e, 0x83, 0x3c, 0xf4, 0x6f, 0xb3, 0x8f, 0x55,
-		0x42, 0x66, 0x90, 0x14, 0x0f, 0x8b, 0x64, 0x41, 0xca, 0x8a, 0x1e, 0xfa,
-		0xaf, 0x8c, 0x4c, 0x77, 0x44, 0x1b, 0x9f, 0xfe, 0x87, 0x85, 0xc5, 0xf1,
-		0x31, 0xc7, 0x36, 0x5a, 0x1f, 0x51, 0x0b, 0xb3, 0x12, 0xac, 0x7b, 0x6f,
-		0x86, 0x86, 0x3c, 0xc1, 0x75, 0x38, 0x33, 0xd1, 0x3f, 0x41, 0xaa, 0x9d,
-		0x51, 0xf3, 0xea, 0x8b, 0xd9, 0x8f, 0xaa, 0xdf, 0xac, 0xc7, 0x56, 0xe3,
-		0xbc, 0x76, 0x09, 0xc7, 0x2e, 0x5e, 0x73, 0xfa, 0xf3, 0xdd, 0x48, 0x8a,
-		0x3d, 0xd8, 0x5e, 0x78, 0x47, 0xdb, 0x50, 0xed, 0xc5, 0x5b, 0x46, 0x7b,
-		0xcf, 0x70, 0x8f, 0xbf, 0x1e, 0x0b, 0xe0, 0xa9, 0x04, 0xf5, 0xff, 0x01,
-		0x47, 0xeb, 0xa9, 0x21, 0xda, 0x55, 0xf3, 0xb4, 0x13, 0x13, 0x6c, 0x01,
-		0xce, 0xc5, 0x6e, 0xad, 0x25, 0x25, 0x7f, 0x9c, 0x74, 0x22, 0xfa, 0xa2,
-		0x1f, 0xe7, 0x66, 0xf3, 0x3d, 0xad, 0x46, 0x8b, 0xd1, 0x41, 0x9b, 0xcb,
-		0xad, 0xda, 0xde, 0x24, 0x3e, 0x4b, 0x9c, 0xdf, 0xf8, 0xda, 0xf9, 0x16,
-		0x5c, 0x2f, 0xfd, 0xc7, 0x12, 0xdd, 0xdc, 0xcb, 0x3e, 0xf6, 0x54, 0x88,
-		0xfd, 0xf6, 0x10, 0xcf, 0x11, 0x51, 0xfe, 0xcf, 0x28, 0xab, 0xfe, 0xeb,
-		0x70, 0x1c, 0xfb, 0x60, 0x11, 0xe8, 0xdf, 0x3b, 0x92, 0x7f, 0x6c, 0x75,
-		0xef, 0x4d, 0x4b, 0x8e, 0x61, 0x9d, 0xd7, 0x2a, 0xd6, 0xfe, 0x67, 0x16,
-		0x4b, 0xe1, 0xc3, 0x41, 0x4b, 0xcd, 0xa1, 0x48, 0x41, 0x8e, 0xc1, 0x52,
-		0xa8, 0x18, 0xc6, 0x31, 0x9f, 0x9a, 0xef, 0x94, 0xb7, 0xce, 0x7e, 0x55,
-		0x54, 0xcb, 0x2c, 0x4c, 0x00, 0xf0, 0x88, 0x67, 0x49, 0x8f, 0xa7, 0x15,
-		0x3c, 0x2b, 0x6e, 0xfd, 0xab, 0x56, 0xe6, 0x6f, 0x8f, 0x3e, 0xc1, 0x4b,
-		0xff, 0xe5, 0xf0, 0x10, 0xea, 0x85, 0xfd, 0xe6, 0x9a, 0x18, 0xc6, 0x14,
-		0x66, 0x32, 0x8d, 0xad, 0xf3, 0x9f, 0x1e, 0x6b, 0x88, 0xf9, 0x56, 0xa3,
-		0xa5, 0x41, 0x7b, 0xd0, 0x66, 0xed, 0xba, 0xe4, 0x48, 0x9f, 0xfa, 0xf7,
-		0x63, 0x89, 0x1b, 0xa9, 0x59, 0xdd, 0x84, 0x36, 0x26, 0x9e, 0x3f, 0xfd,
-		0x47, 0x96, 0xad, 0x8f, 0xf5, 0x4a, 0xed, 0xf6, 0xb1, 0x9b, 0x31, 0x07,
-		0x73, 0xf0, 0xb3, 0x0f, 0xfd, 0xb7, 0x61, 0xca, 0x39, 0x8c, 0xe7, 0x69,
-		0xd3, 0x7f, 0x06, 0x2d, 0x76, 0x9f, 0x59, 0xe2, 0xea, 0x25, 0x4f, 0xff,
-		0xde, 0xd1, 0x1b, 0x23, 0xeb, 0xea, 0x30, 0x6b, 0xdd, 0x7b, 0x93, 0x46,
-		0x0d, 0x3a, 0xeb, 0x8e, 0xf7, 0x01, 0xb8, 0xc7, 0x90, 0xae, 0x89, 0xbb,
-		0x8e, 0x37, 0x81, 0xdf, 0x97, 0x85, 0x43, 0xad, 0x51, 0x2b, 0xcb, 0xb9,
-		0xeb, 0x56, 0xa3, 0x3c, 0xbe, 0x5d, 0x59, 0x15, 0xc6, 0xd1, 0xfa, 0xd3,
-		0xd2, 0xb3, 0xa4, 0x93, 0x2c, 0xdf, 0xe8, 0x47, 0xff, 0x4e, 0xfc, 0x96,
-		0xe3, 0x12, 0xb6, 0xff, 0x15, 0x1d, 0x4f, 0xb0, 0x0e, 0x97, 0x60, 0x22,
-		0x9e, 0xc3, 0xb3, 0x98, 0x62, 0x54, 0xc5, 0x4e, 0x4c, 0x72, 0xd7, 0xd6,
-		0x1d, 0x7b, 0xd0, 0x63, 0x71, 0xeb, 0xdf, 0x9f, 0x25, 0x6e, 0x24, 0xbf,
-		0x33, 0x72, 0x7d, 0x33, 0xba, 0x0f, 0x6a, 0x8f, 0x05, 0x58, 0x80, 0x65,
-		0xb4, 0x7f, 0x2f, 0x70, 0xe9, 0x9a, 0x90, 0xfe, 0xbd, 0xed, 0x63, 0x7e,
-		0x14, 0x19, 0xce, 0x18, 0x0f, 0xfd, 0xab, 0x19, 0xf2, 0x0a, 0xab, 0x6d,
-		0xba, 0x24, 0xeb, 0xdf, 0xb1, 0xd6, 0x39, 0x51, 0x50, 0x3f, 0xb5, 0xcc,
-		0xc2, 0xcb, 0x01, 0xf8, 0x88, 0x56, 0x3f, 0xf5, 0x4c, 0x0c, 0xe4, 0x8a,
-		0xfa, 0xb3, 0x96, 0x5c, 0x1f, 0xe0, 0x9a, 0x4f, 0x5d, 0x8f, 0xef, 0xee,
-		0xc2, 0x3e, 0x5d, 0xbf, 0xf2, 0x1f, 0xce, 0xd1, 0x4c, 0xd7, 0x29, 0x01,
-		0xfd, 0x07, 0xf0, 0xaa, 0x21, 0xd6, 0x6d, 0xf1, 0xd4, 0x7f, 0x0b, 0xe4,
-		0x61, 0x1f, 0x4e, 0xf7, 0xa1, 0x8a, 0x50, 0xab, 0xd1, 0x25, 0x06, 0x2b,
-		0xd9, 0x2d, 0x8c, 0x6b, 0xee, 0xf5, 0x9d, 0xfe, 0x2c, 0x71, 0xfe, 0xf2,
-		0xd2, 0x7b, 0x41, 0x9d, 0xe2, 0xa3, 0x6c, 0xfd, 0x7c, 0x5d, 0xe9, 0xd3,
-		0x96, 0x16, 0x2d, 0x79, 0xfa, 0x57, 0xeb, 0x83, 0xbb, 0xd0, 0x26, 0x41,
-		0xfb, 0x5f, 0xf2, 0xf4, 0x1f, 0x59, 0x57, 0x89, 0x8e, 0xff, 0x03, 0xb8,
-		0xd7, 0x5d, 0x41, 0x48, 0x61, 0x34, 0xe5, 0x6a, 0xc6, 0x74, 0x1b, 0xe9,
-		0x25, 0xb1, 0x92, 0x5a, 0xbb, 0x0e, 0xed, 0x01, 0xdc, 0xe6, 0xb1, 0xde,
-		0xb6, 0xdb, 0x1a, 0xdf, 0xd3, 0xb1, 0xca, 0x39, 0xe3, 0xdb, 0xab, 0x3d,
-		0x4b, 0xf9, 0x1a, 0x80, 0x19, 0x56, 0x7f, 0x0f, 0x6f, 0xfd, 0x9f, 0xe1,
-		0x19, 0x49, 0xb9, 0x38, 0xe9, 0xff, 0x3f, 0x11, 0x16, 0xfa, 0x21, 0x46,
-		0x55, 0xac, 0x8f, 0xb0, 0x07, 0xed, 0xd3, 0xcc, 0x72, 0xae, 0x00, 0xc2,
-		0x22, 0xa8, 0x76, 0xc1, 0x02, 0x7c, 0x10, 0xa7, 0x25, 0x2e, 0x32, 0x2f,
-		0xb3, 0x85, 0xed, 0x70, 0x1c, 0xce, 0x5a, 0x5f, 0x8c, 0x2a, 0x2e, 0xba,
-		0x15, 0x98, 0xab, 0x22, 0xf2, 0xf3, 0x77, 0xa5, 0x7a, 0xfb, 0x58, 0x72,
-		0xf5, 0xdf, 0x9e, 0x6b, 0x97, 0x17, 0x27, 0x6c, 0xff, 0x4f, 0x9e, 0xfe,
-		0x23, 0xeb, 0xbe, 0x31, 0x75, 0x96, 0xc8, 0x73, 0xa6, 0xec, 0xca, 0x1f,
-		0xba, 0x4f, 0xce, 0x52, 0x4b, 0xba, 0x79, 0xf8, 0x1d, 0xa5, 0xb0, 0x0f,
-		0x23, 0xb0, 0x0e, 0x63, 0xd8, 0x46, 0x9f, 0x6f, 0x4c, 0x5b, 0x06, 0xff,
-		0xb0, 0x4e, 0xee, 0xf4, 0xe5, 0x81, 0xe8, 0xbd, 0xf2, 0xdf, 0x80, 0x7e,
-		0x7f, 0x7d, 0x12, 0xd4, 0x7f, 0x79, 0x8e, 0x19, 0x1b, 0x97, 0x10, 0xfd,
-		0x2b, 0x2d, 0x7e, 0x1e, 0xb1, 0x52, 0x33, 0xdf, 0xd3, 0x6a, 0x54, 0xd5,
-		0x30, 0x1e, 0xec, 0x44, 0x8b, 0x5e, 0xf9, 0x30, 0xdf, 0xa2, 0x8f, 0xe2,
-		0xb4, 0xc4, 0x75, 0xa2, 0x95, 0xa1, 0x62, 0x88, 0x85, 0x7f, 0x2d, 0xe6,
-		0x19, 0xaf, 0xc3, 0x7b, 0xfe, 0xdf, 0x93, 0xf9, 0x55, 0x08, 0x9b, 0x15,
-		0xce, 0x8f, 0xd3, 0x3e, 0x96, 0x4c, 0xfd, 0x9f, 0xcb, 0xd9, 0xd4, 0xd3,
-		0x49, 0x58, 0xff, 0x4b, 0x9e, 0xfe, 0x3b, 0x45, 0xd4, 0x95, 0x7a, 0x4a,
-		0xe6, 0x26, 0xf4, 0x9c, 0xa9, 0xd2, 0xaf, 0x46, 0x00, 0x67, 0x03, 0x78,
-		0xd5, 0x92, 0xee, 0x43, 0x64, 0xb3, 0x8d, 0x38, 0x1d, 0x33, 0xf1, 0x21,
-		0x2e, 0xd0, 0xae, 0x61, 0x86, 0xae, 0x2a, 0x6c, 0x62, 0x7b, 0xed, 0xe5,
-		0x9b, 0xd4, 0xcb, 0x57, 0x9f, 0xfc, 0x2c, 0x80, 0x79, 0x16, 0xdb, 0x9d,
-		0x3f, 0xfd, 0x07, 0xf0, 0xb1, 0xbb, 0xe2, 0x58, 0x12, 0xf4, 0x7f, 0x32,
-		0x7b, 0xf2, 0x1e, 0xee, 0x38, 0x69, 0x10, 0xb6, 0xfb, 0x5a, 0x15, 0x37,
-		0xcd, 0x07, 0xd3, 0xe9, 0xaf, 0xf8, 0xb2, 0xdb, 0xff, 0x76, 0xe6, 0x3c,
-		0xff, 0x82, 0x38, 0x67, 0xe2, 0xe9, 0x58, 0x0e, 0x60, 0xa2, 0x7b, 0x6f,
-		0xab, 0xe2, 0x07, 0x83, 0x8f, 0xb7, 0x5f, 0xfd, 0x3b, 0xd6, 0xa2, 0x57,
-		0x5d, 0x05, 0xf5, 0xc6, 0x46, 0x5f, 0x57, 0xda, 0xc7, 0xb2, 0xf2, 0x9d,
-		0x1c, 0xfd, 0x6f, 0xe0, 0xec, 0xb4, 0x41, 0xb1, 0xd2, 0x7f, 0x3a, 0xa3,
-		0xe2, 0xe7, 0xd7, 0x55, 0x16, 0x55, 0x76, 0x43, 0x82, 0x4f, 0x9a, 0xf2,
-		0x47, 0xc8, 0xc4, 0xc3, 0x80, 0x75, 0x37, 0xca, 0x58, 0xe4, 0x72, 0x15,
-		0xa0, 0x15, 0x5e, 0xc2, 0x2f, 0xb8, 0x1e, 0x30, 0xd6, 0x4c, 0x0a, 0x6b,
-		0x6f, 0x28, 0xff, 0xbd, 0x24, 0x09, 0xfa, 0xcf, 0xe4, 0x8a, 0xd4, 0x59,
-		0x1e, 0xfe, 0xde, 0x7e, 0xf4, 0x7f, 0x29, 0xfd, 0x69, 0x4b, 0x86, 0xfe,
-		0xd3, 0x30, 0x9f, 0xcf, 0xdf, 0x77, 0x98, 0x82, 0xa5, 0xd8, 0x8d, 0xdb,
-		0x12, 0xd2, 0xbf, 0xaa, 0x69, 0xe5, 0xf5, 0xbb, 0x06, 0x53, 0xf0, 0x13,
-		0x6d, 0x29, 0x3a, 0x8b, 0xb6, 0x3f, 0xfd, 0xab, 0x6f, 0x55, 0x77, 0x64,
-		0x23, 0xa6, 0xe1, 0x2b, 0x8e, 0xa9, 0xd6, 0xe1, 0xc8, 0x04, 0xf4, 0x1f,
-		0xc0, 0xb5, 0x2c, 0xf5, 0x3a, 0x4c, 0xc1, 0x6c, 0xec, 0xa1, 0x4f, 0x7e,
-		0x71, 0xd0, 0xbf, 0xf3, 0x33, 0xa5, 0x58, 0xe9, 0x5f, 0xe5, 0xb3, 0x87,
-		0x6d, 0xd3, 0x54, 0x7c, 0x47, 0x4f, 0xe0, 0x6f, 0x7d, 0xac, 0x9c, 0x7b,
-		0xcf, 0xad, 0x07, 0x60, 0x06, 0x60, 0xb5, 0x73, 0xdc, 0x44, 0x4f, 0xa1,
-		0x3c, 0x94, 0xc7, 0x48, 0xfc, 0x8b, 0xfb, 0x90, 0x67, 0xbc, 0xe2, 0x5e,
-		0x7c, 0x36, 0xca, 0xd0, 0x76, 0xb2, 0xc0, 0x63, 0xc5, 0xcd, 0x8f, 0xfe,
-		0x1f, 0x61, 0xcd, 0xa4, 0x25, 0x41, 0xff, 0x35, 0x90, 0x8b, 0x5c, 0x8b,
-		0x27, 0x47, 0xf1, 0xb2, 0xff, 0x37, 0xa0, 0xd7, 0xb5, 0xfa, 0xf9, 0x09,
-		0x1d, 0x2d, 0xf6, 0xbf, 0xdf, 0x7d, 0xda, 0x83, 0xba, 0xd0, 0x7f, 0xd2,
-		0x59, 0xdb, 0x7f, 0x50, 0x9b, 0xc6, 0x9f, 0x25, 0xce, 0x59, 0x8d, 0x9d,
-		0xc5, 0x56, 0x44, 0xed, 0x41, 0xf9, 0xd0, 0xb8, 0x53, 0xc5, 0xaf, 0xfe,
-		0x03, 0xb8, 0x8e, 0x3d, 0x99, 0x5a, 0x8b, 0x1e, 0xe0, 0x73, 0xff, 0x4f,
-		0xe1, 0xeb, 0x7f, 0x2f, 0x06, 0xe1, 0xdf, 0x10, 0x1f, 0xec, 0xe2, 0xa1,
-		0x7f, 0xb5, 0xff, 0x6c, 0x96, 0x7b, 0x1f, 0xff, 0xc5, 0x98, 0x84, 0x6c,
-		0x7f, 0x05, 0xf6, 0x97, 0x7b, 0xb1, 0x03, 0x3b, 0xad, 0x2d, 0xc9, 0xb9,
-		0x00, 0xde, 0xc6, 0x1a, 0x77, 0xa6, 0xf0, 0x76, 0xd0, 0xa7, 0x33, 0x9a,
-		0x29, 0xae, 0xb7, 0x84, 0x33, 0xae, 0xeb, 0x99, 0xa0, 0xfe, 0x0f, 0xe3,
-		0x58, 0xf5, 0x12, 0xcf, 0xfd, 0x5e, 0xc3, 0x7d, 0x5d, 0xeb, 0x4c, 0x00,
-		0x97, 0x95, 0x10, 0xfd, 0x2b, 0x0e, 0x45, 0x2b, 0xa3, 0x77, 0x40, 0xfe,
-		0x53, 0xb3, 0x31, 0xc2, 0x1e, 0x94, 0x63, 0x49, 0x5f, 0x13, 0x59, 0x68,
-		0x6c, 0xf4, 0x83, 0xf6, 0x67, 0x89, 0x2b, 0x68, 0x6b, 0x5a, 0xa1, 0x45,
-		0xc8, 0x1e, 0xce, 0x44, 0xf4, 0xaf, 0x3c, 0xdb, 0x9b, 0xa0, 0x21, 0x5b,
-		0xf9, 0xfe, 0x9c, 0xed, 0xed, 0x7f, 0xfd, 0xdf, 0xe8, 0x5a, 0x61, 0x37,
-		0x5b, 0xef, 0x40, 0x6c, 0xdf, 0x96, 0x2c, 0xaa, 0xa3, 0x35, 0x1a, 0x25,
-		0xb0, 0xf3, 0x27, 0xd2, 0x43, 0xfb, 0x4f, 0xee, 0xa0, 0xb3, 0xa5, 0xea,
-		0x08, 0xe0, 0x2f, 0x7c, 0xcd, 0x7d, 0x1c, 0xea, 0x95, 0x69, 0x2f, 0x76,
-		0x53, 0xae, 0x5b, 0x39, 0x2b, 0x7f, 0x6a, 0x4e, 0xf1, 0x49, 0x82, 0xfa,
-		0x57, 0x7e, 0x6f, 0x2b, 0x3d, 0x3c, 0xf7, 0xfd, 0xeb, 0xff, 0x06, 0xcf,
-		0x12, 0x15, 0x2f, 0xfd, 0xfb, 0x5b, 0x63, 0x6b, 0x11, 0x66, 0x0f, 0x5a,
-		0x18, 0x77, 0x6e, 0x91, 0x96, 0xb8, 0xf1, 0x09, 0x7a, 0x97, 0xfb, 0xd3,
-		0x7f, 0x15, 0x74, 0xc2, 0x31, 0x11, 0x2b, 0x1f, 0x9f, 0x17, 0x03, 0xfd,
-		0x77, 0xe3, 0x5c, 0xf6, 0x33, 0xad, 0xa5, 0x74, 0x7f, 0xeb, 0x3f, 0x99,
-		0x94, 0xa6, 0xdf, 0x98, 0xe3, 0xdf, 0x67, 0xa6, 0x4e, 0x70, 0x4f, 0x75,
-		0x25, 0xbe, 0x32, 0xf9, 0xbd, 0x3f, 0x13, 0xb2, 0x97, 0xa7, 0x1e, 0xf6,
-		0x21, 0xcf, 0x7a, 0x0e, 0x83, 0x97, 0xfe, 0x2b, 0x70, 0x5c, 0x78, 0x8d,
-		0x8f, 0xfd, 0xde, 0xfe, 0xf4, 0xdf, 0x90, 0xeb, 0x25, 0x15, 0x0f, 0x28,
-		0xfd, 0x6f, 0xc3, 0x17, 0xae, 0x66, 0x1d, 0x7b, 0xd0, 0x03, 0x09, 0xec,
-		0x47, 0x0c, 0xb5, 0xc4, 0xf5, 0x37, 0x58, 0xe2, 0x92, 0xad, 0xff, 0x36,
-		0xbc, 0x86, 0x8c, 0xb0, 0xf1, 0xe3, 0xfd, 0xc5, 0x44, 0xff, 0xca, 0xff,
-		0x7a, 0x5b, 0xd8, 0x4e, 0xf5, 0x03, 0x4f, 0xff, 0xce, 0xa8, 0x18, 0x38,
-		0xc3, 0x63, 0xa7, 0x64, 0x8e, 0xbb, 0x07, 0x20, 0x40, 0x9f, 0xc9, 0xd1,
-		0x86, 0xd1, 0xfa, 0x8e, 0x30, 0x8f, 0x78, 0xe5, 0x31, 0xff, 0x4c, 0x02,
-		0xfa, 0x77, 0xfa, 0xb7, 0x0d, 0x1e, 0x27, 0x69, 0xf8, 0xd7, 0x7f, 0x00,
-		0x0b, 0x00, 0x9c, 0x7d, 0x40, 0xe9, 0x7f, 0x09, 0x5e, 0xc2, 0xa6, 0xa0,
-		0x3d, 0x68, 0xb5, 0xc5, 0x87, 0xc3, 0x9b, 0x02, 0x4b, 0xdc, 0x1c, 0xa3,
-		0x25, 0x2e, 0xd9, 0xfa, 0x77, 0xd6, 0x26, 0xde, 0xe4, 0x69, 0x36, 0xa5,
-		0x69, 0x83, 0xdc, 0x8b, 0x66, 0x71, 0xea, 0xff, 0x4f, 0x3e, 0x21, 0x6b,
-		0x79, 0x15, 0x6b, 0xf8, 0x7a, 0x44, 0x82, 0xfa, 0x77, 0xf6, 0xdc, 0x6c,
-		0xd2, 0xec, 0x5b, 0x8e, 0xe7, 0xdb, 0x8a, 0x27, 0x0f, 0xf3, 0x0a, 0x6a,
-		0x79, 0xa4, 0x5a, 0x09, 0xe0, 0x4c, 0xf7, 0x74, 0xa4, 0x82, 0x5d, 0x70,
-		0xd1, 0x2b, 0xc8, 0xbf, 0x44, 0xdc, 0xb5, 0x1d, 0x96, 0x73, 0x8a, 0xfc,
-		0xe9, 0xdf, 0xeb, 0x24, 0xad, 0x58, 0xf4, 0xef, 0xef, 0x24, 0x80, 0x92,
-		0xa5, 0xff, 0x0c, 0xbc, 0x14, 0x3c, 0x93, 0xa8, 0x59, 0x82, 0x39, 0x7a,
-		0x5b, 0xe2, 0x92, 0xad, 0x7f, 0xb5, 0x37, 0x63, 0x0f, 0xfd, 0x40, 0x56,
-		0xb0, 0xaf, 0xcd, 0xe3, 0xcc, 0x3b, 0x3e, 0xfd, 0xef, 0x8c, 0x7a, 0x5a,
-		0xee, 0x4b, 0x58, 0xff, 0x29, 0xf8, 0x4a, 0x7b, 0x46, 0x48, 0x3c, 0xdf,
-		0x26, 0x14, 0x06, 0xb1, 0xe8, 0xbf, 0x8d, 0xaf, 0x93, 0x00, 0x4a, 0x8a,
-		0xfe, 0x43, 0xcf, 0x72, 0x69, 0xe9, 0xe9, 0x6f, 0xe9, 0x77, 0x3e, 0x98,
-		0x6f, 0x89, 0x4b, 0x06, 0xfe, 0xec, 0x7f, 0xad, 0xf1, 0x3e, 0x77, 0xa2,
-		0xec, 0xc2, 0x37, 0x18, 0x58, 0xe4, 0xbb, 0x2c, 0x1e, 0x12, 0x0d, 0x1d,
-		0x34, 0xfa, 0x4f, 0xe1, 0x38, 0xa6, 0xd7, 0x01, 0xa7, 0xff, 0x03, 0x81,
-		0xa2, 0x99, 0x43, 0xb7, 0xc7, 0x5d, 0x38, 0x2f, 0xf8, 0xee, 0x0d, 0x0f,
-		0x4f, 0x76, 0xe1, 0xc0, 0xd2, 0xbf, 0x73, 0x12, 0xc0, 0xd3, 0xa2, 0xff,
-		0x83, 0x16, 0x67, 0x47, 0x42, 0x8a, 0xdb, 0x1b, 0x28, 0xdb, 0xc3, 0xa9,
-		0x52, 0x2b, 0x07, 0x91, 0xfe, 0x7b, 0xd0, 0x4a, 0x96, 0x22, 0xfa, 0x3f,
-		0x48, 0xa9, 0x44, 0x1b, 0xf5, 0xad, 0x48, 0x41, 0x1a, 0x77, 0xbf, 0x6d,
-		0xf0, 0x3c, 0x19, 0x5a, 0x28, 0xfe, 0xfa, 0xbf, 0x09, 0xa5, 0x5c, 0xd2,
-		0x3d, 0x4f, 0x02, 0xc8, 0xd6, 0x9e, 0x04, 0x90, 0x12, 0xcc, 0xa1, 0x14,
-		0x77, 0x7e, 0x88, 0xfe, 0x0f, 0x54, 0xae, 0x72, 0xbd, 0xe7, 0xb2, 0x69,
-		0x6d, 0x1c, 0x24, 0x35, 0x72, 0x00, 0xe8, 0xdf, 0x76, 0xfe, 0x7f, 0x24,
-		0xaf, 0x18, 0x57, 0x98, 0xfd, 0x9c, 0xff, 0x2f, 0x94, 0x7c, 0x86, 0xe0,
-		0x17, 0xec, 0xc3, 0x1e, 0xcc, 0x89, 0x38, 0xd5, 0x56, 0x28, 0x89, 0x3c,
-		0x89, 0xe5, 0x21, 0x78, 0x9f, 0x6b, 0x3b, 0x40, 0x9b, 0xaa, 0x43, 0x58,
-		0x2e, 0xcb, 0xc3, 0x7c, 0xd2, 0x84, 0x03, 0x8f, 0xb4, 0xa4, 0xad, 0x71,
-		0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20,
-		0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20,
-		0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20,
-		0x08, 0x82, 0x20, 0x24, 0x9b, 0x43, 0x90, 0xe9, 0xc6, 0xfe, 0x6f, 0x84,
-		0xde, 0xc8, 0xf2, 0xd8, 0x0f, 0x55, 0x0d, 0x5d, 0xd1, 0x99, 0x67, 0x25,
-		0x64, 0x20, 0x53, 0x73, 0xca, 0xec, 0xa1, 0xc8, 0x64, 0x84, 0xc9, 0x32,
-		0xe8, 0x88, 0x4e, 0xd6, 0xb3, 0x9c, 0xd2, 0x90, 0x85, 0xbe, 0xe8, 0xe9,
-		0x71, 0xe2, 0xe8, 0x4d, 0xc8, 0xc6, 0x13, 0x3e, 0xcb, 0xef, 0xa0, 0x2f,
-		0x57, 0x35, 0x64, 0x46, 0x44, 0xa9, 0xa8, 0x81, 0x4c, 0x4d, 0xdc, 0x94,
-		0x34, 0x64, 0x46, 0x45, 0x7a, 0x28, 0x8f, 0x4c, 0x54, 0x89, 0x4a, 0x59,
-		0x11, 0x99, 0x61, 0xe7, 0xc1, 0x96, 0xe5, 0x5f, 0xa6, 0x46, 0xa5, 0xab,
-		0x8c, 0x4c, 0x54, 0x0a, 0x3b, 0x61, 0x40, 0xa5, 0x4b, 0xd7, 0x5e, 0x47,
-		0x24, 0xb6, 0x53, 0x7c, 0xcb, 0xe2, 0x64, 0x8c, 0xd4, 0x9c, 0x92, 0x59,
-		0x03, 0x03, 0xdd, 0x88, 0x81, 0xa1, 0x34, 0xc6, 0x03, 0xb8, 0x22, 0x24,
-		0x46, 0x40, 0xc0, 0x9a, 0x73, 0xaa, 0xe8, 0xe2, 0xa0, 0xc1, 0x39, 0x53,
-		0xb5, 0x02, 0x26, 0xbb, 0x3b, 0xde, 0x17, 0xa3, 0x83, 0x21, 0x65, 0x2a,
-		0x46, 0x31, 0xe6, 0x9b, 0x8a, 0x1d, 0x75, 0xbe, 0xe1, 0xec, 0xd5, 0x57,
-		0x78, 0xaa, 0x4a, 0x5b, 0x46, 0x87, 0x54, 0x27, 0xec, 0xb4, 0x34, 0xe4,
-		0x35, 0x14, 0xeb, 0x82, 0x7b, 0xec, 0xbf, 0x40, 0x23, 0x63, 0xe9, 0xee,
-		0x70, 0xe3, 0x0d, 0x78, 0x95, 0xbf, 0xe0, 0xbd, 0xbe, 0x5c, 0x2f, 0x46,
-		0x9c, 0xf7, 0x55, 0x91, 0xa7, 0xcd, 0xb6, 0xd4, 0x3c, 0xfb, 0xea, 0xfc,
-		0xec, 0xf0, 0xb3, 0x8a, 0xef, 0xd6, 0x9e, 0x15, 0xd6, 0x8e, 0x29, 0xc3,
-		0x4f, 0x39, 0xff, 0x46, 0x73, 0xa2, 0x90, 0x3a, 0x4d, 0xfb, 0xab, 0x90,
-		0xf7, 0x59, 0x3c, 0x0d, 0xb9, 0x8c, 0xe7, 0xc9, 0x03, 0xb0, 0x9e, 0xbb,
-		0x7b, 0xb1, 0x5b, 0x7f, 0xd1, 0xe7, 0x1c, 0xe8, 0x4f, 0x53, 0xce, 0xcf,
-		0x7d, 0xba, 0x1b, 0x95, 0x25, 0x60, 0xbc, 0xc7, 0x4f, 0x20, 0x07, 0x1b,
-		0x70, 0x92, 0xfb, 0x7e, 0x10, 0xbe, 0x97, 0xb3, 0x31, 0x0e, 0x02, 0xfd,
-		0xbf, 0x8b, 0xa5, 0x78, 0x11, 0xef, 0xf2, 0x34, 0xe3, 0xcd, 0xa8, 0xad,
-		0x4d, 0x79, 0x17, 0x9f, 0xa0, 0x45, 0x78, 0x01, 0x1f, 0x60, 0x17, 0x1e,
-		0x34, 0xea, 0xff, 0x3e, 0xac, 0xc0, 0x7c, 0xbc, 0xca, 0xf8, 0xdf, 0xfa,
-		0x08, 0x41, 0x17, 0x31, 0xa7, 0xb9, 0x18, 0x87, 0xd7, 0x18, 0x5f, 0x62,
-		0x9d, 0xf1, 0x74, 0xf0, 0x64, 0xe9, 0xff, 0x14, 0x9e, 0x66, 0x5d, 0xf0,
-		0x7e, 0x20, 0x80, 0x65, 0xda, 0xfc, 0x96, 0x45, 0xb5, 0x0b, 0xaa, 0xed,
-		0xb8, 0x5a, 0x93, 0xf2, 0x05, 0x46, 0xe5, 0x73, 0xfa, 0xca, 0x6e, 0x8c,
-		0xd4, 0xdb, 0x4a, 0x93, 0xaa, 0x21, 0xcf, 0xb2, 0x2f, 0x18, 0x01, 0xdc,
-		0x62, 0x88, 0x25, 0xd3, 0x0e, 0x73, 0xc2, 0xd8, 0xc6, 0xdc, 0xf5, 0xd7,
-		0xec, 0x9c, 0x5d, 0xf3, 0x25, 0xae, 0xd5, 0x44, 0x56, 0xd3, 0xeb, 0xbf,
-		0x1a, 0x06, 0xe3, 0x11, 0xde, 0x91, 0x55, 0xda, 0x53, 0xec, 0xf3, 0xf9,
-		0x3f, 0x96, 0x16, 0xd8, 0x8a, 0x7a, 0x7c, 0x3f, 0x8b, 0xed, 0xb9, 0xa8,
-		0xe4, 0xc0, 0xd6, 0xff, 0x4e, 0x4c, 0x72, 0x47, 0xa4, 0x0d, 0x78, 0xea,
-		0xd5, 0x63, 0x9a, 0x74, 0x95, 0xf8, 0x44, 0x8e, 0x71, 0x9f, 0xf7, 0xb6,
-		0x3c, 0x37, 0x49, 0xaf, 0xff, 0x3f, 0xf1, 0x38, 0x53, 0x65, 0xf1, 0x29,
-		0xcd, 0x34, 0x68, 0xec, 0x7f, 0xc1, 0x19, 0xc3, 0x62, 0x4b, 0x44, 0xee,
-		0x64, 0xe9, 0xbf, 0x2c, 0xcf, 0x7b, 0x6b, 0x1e, 0x7c, 0x3f, 0xce, 0x18,
-		0xbd, 0x44, 0xc5, 0x07, 0x3f, 0x39, 0xec, 0x37, 0xd3, 0x00, 0xcd, 0x88,
-		0x5a, 0xc5, 0x7c, 0xd9, 0xec, 0x46, 0x25, 0x4c, 0xc3, 0xcf, 0x00, 0xc6,
-		0x1a, 0x4a, 0xb8, 0x88, 0x11, 0xd3, 0xf3, 0xdf, 0x7d, 0x03, 0xe0, 0x72,
-		0xcf, 0xbb, 0xd2, 0x11, 0x39, 0xc8, 0xc3, 0x29, 0xda, 0xcf, 0xaa, 0x30,
-		0x22, 0xe5, 0xb5, 0x86, 0xbf, 0xb4, 0x45, 0x53, 0xa8, 0x86, 0x5f, 0x00,
-		0xcb, 0x7c, 0xaa, 0x16, 0xdb, 0xff, 0xfe, 0xac, 0x83, 0x0f, 0x11, 0xc0,
-		0x09, 0x3c, 0x8d, 0xbb, 0xba, 0xa8, 0xe4, 0x00, 0xd7, 0x3f, 0x70, 0x54,
-		0xf0, 0xfd, 0x25, 0x11, 0x7a, 0xca, 0xa7, 0x2f, 0x63, 0xf9, 0x17, 0xcc,
-		0xe8, 0x9f, 0x36, 0xea, 0x3f, 0x3b, 0x18, 0x7b, 0x7a, 0x16, 0x16, 0x6a,
-		0xe6, 0x9c, 0xe9, 0x8c, 0x1a, 0x5b, 0x30, 0xc6, 0x38, 0x1d, 0xcf, 0x1b,
-		0xe3, 0xab, 0x26, 0x4b, 0xff, 0xce, 0xf8, 0xfc, 0x86, 0xe0, 0x1c, 0xfc,
-		0xef, 0xb0, 0xb1, 0x7b, 0x28, 0xa3, 0x00, 0x5c, 0xca, 0x38, 0x58, 0x0d,
-		0xdd, 0xb1, 0xf2, 0x42, 0x43, 0x2b, 0xe6, 0xf4, 0xc3, 0x6b, 0x51, 0x81,
-		0xd1, 0xea, 0xfe, 0xc1, 0xa1, 0x86, 0x12, 0xaa, 0x1c, 0x9f, 0x0f, 0xb6,
-		0xa2, 0x4a, 0xd7, 0xb5, 0x3d, 0xee, 0xc9, 0xa1, 0x8c, 0xf0, 0xfe, 0xb8,
-		0xe1, 0xd3, 0xde, 0x1c, 0xbb, 0xa4, 0xc4, 0xa1, 0x7f, 0x67, 0xdc, 0xb3,
-		0xc8, 0xf8, 0xe9, 0x28, 0xce, 0xc6, 0x54, 0xcc, 0x36, 0x15, 0xd1, 0xfb,
-		0x5c, 0xc6, 0x0a, 0x7e, 0x52, 0x34, 0x72, 0xc0, 0xeb, 0x7f, 0x7d, 0xc8,
-		0xfb, 0x06, 0x1c, 0xc9, 0x46, 0x3f, 0x5d, 0x2a, 0xaa, 0xe4, 0xa4, 0x90,
-		0xf7, 0x83, 0x8c, 0xfa, 0x7f, 0xcb, 0xf3, 0x3b, 0xff, 0xf6, 0x11, 0x81,
-		0xd7, 0xb1, 0xc4, 0xa9, 0xa8, 0x44, 0x6f, 0x04, 0xed, 0x61, 0x65, 0x13,
-		0xd0, 0xff, 0x45, 0x21, 0x11, 0x25, 0x5b, 0x31, 0x62, 0x6e, 0xba, 0x71,
-		0x6e, 0x72, 0x07, 0x02, 0xb8, 0x94, 0xa7, 0x43, 0xaa, 0x7a, 0xd8, 0x8c,
-		0xcd, 0x86, 0x32, 0xa6, 0x33, 0x3e, 0xff, 0x58, 0xc6, 0x42, 0x1b, 0x6a,
-		0xbc, 0x92, 0x13, 0x01, 0xfc, 0xed, 0xd6, 0xa8, 0x3a, 0x77, 0xfa, 0x67,
-		0xcf, 0xfa, 0x79, 0x8f, 0xd1, 0x6f, 0x4d, 0xd6, 0xd3, 0xf3, 0xac, 0x71,
-		0x5a, 0xed, 0xfa, 0x6f, 0xcf, 0x16, 0x4b, 0xff, 0x59, 0x06, 0xc7, 0x74,
-		0xce, 0xcc, 0xff, 0x76, 0xd7, 0x5e, 0xb0, 0xda, 0x12, 0xb7, 0x49, 0x38,
-		0x50, 0xf4, 0x1f, 0x1d, 0x3d, 0x3e, 0x5a, 0x69, 0x2a, 0xaa, 0xd7, 0x84,
-		0x88, 0xf1, 0x80, 0x5e, 0xff, 0xf7, 0x78, 0x7e, 0xe7, 0xcd, 0x8c, 0xf4,
-		0x34, 0x1a, 0x1d, 0x2d, 0x31, 0x78, 0x32, 0x35, 0xf6, 0xb0, 0x4b, 0x12,
-		0xd0, 0x7f, 0x35, 0x9e, 0xf5, 0xe8, 0x44, 0xfd, 0x1c, 0x01, 0xe0, 0x65,
-		0xc3, 0xf7, 0x1e, 0x07, 0xe0, 0x39, 0x37, 0x26, 0x14, 0x50, 0x0f, 0xe5,
-		0x00, 0x7c, 0x6b, 0x2c, 0x65, 0x17, 0x37, 0x02, 0xfe, 0x1c, 0x8b, 0xcd,
-		0x3c, 0x9d, 0xba, 0x72, 0x6c, 0x03, 0xcf, 0x33, 0xce, 0xba, 0xbd, 0x76,
-		0x86, 0x31, 0x16, 0x66, 0x63, 0xe3, 0xe7, 0xaa, 0x84, 0xdb, 0x8d, 0xf1,
-		0x4b, 0xed, 0xfa, 0xbf, 0x29, 0xc2, 0x1a, 0x19, 0x3e, 0xc3, 0xbb, 0x03,
-		0x93, 0xdd, 0x76, 0x2a, 0x0d, 0x8f, 0x63, 0x2b, 0x7e, 0x32, 0xda, 0x6f,
-		0x85, 0x03, 0xcb, 0xfe, 0x57, 0xf0, 0xfe, 0x30, 0x83, 0xfe, 0x47, 0x46,
-		0xe8, 0xdf, 0x6c, 0xff, 0x1f, 0xe9, 0xf9, 0x9d, 0xe9, 0xb4, 0x9d, 0x81,
-		0xcf, 0xf1, 0x3b, 0xe8, 0x68, 0x98, 0xab, 0x2a, 0x2b, 0xd8, 0x6a, 0x8e,
-		0xac, 0xf3, 0x6d, 0x62, 0xa7, 0x24, 0xa0, 0xff, 0x00, 0x66, 0x00, 0x6e,
-		0x5c, 0x29, 0x35, 0x07, 0x37, 0x9d, 0xf9, 0x5a, 0x11, 0x79, 0x8c, 0x7f,
-		0xff, 0x25, 0xb6, 0x00, 0x18, 0x80, 0x46, 0x21, 0xa3, 0x77, 0x1d, 0x6f,
-		0xf0, 0xfc, 0xe8, 0xf6, 0xd6, 0xeb, 0x7d, 0xc3, 0x8d, 0x9a, 0xea, 0xcc,
-		0x3b, 0x3a, 0x58, 0xd3, 0xb6, 0xe2, 0xd8, 0xfb, 0x7c, 0xab, 0x8d, 0x7e,
-		0xb9, 0xc1, 0x22, 0xe9, 0xa5, 0xff, 0x34, 0xce, 0x2b, 0xae, 0x95, 0xa7,
-		0x5e, 0x28, 0x44, 0xfd, 0xdf, 0xea, 0xf3, 0x7b, 0xdf, 0xa4, 0xfd, 0x0c,
-		0xc8, 0xb5, 0xb4, 0x18, 0xc9, 0x9b, 0xff, 0x3b, 0x71, 0xff, 0xc7, 0x71,
-		0x45, 0x3e, 0x07, 0xbb, 0xe8, 0xa5, 0xa0, 0x67, 0x15, 0x47, 0xe8, 0x1b,
-		0xf1, 0x2c, 0xf6, 0xe2, 0x36, 0xc6, 0xae, 0xbb, 0xde, 0xf2, 0xfd, 0x9f,
-		0xf0, 0x1a, 0x7a, 0x5a, 0xcb, 0x38, 0x88, 0x6b, 0x83, 0x01, 0x1c, 0xcd,
-		0xd6, 0xcc, 0xe6, 0x61, 0x51, 0x8e, 0xd6, 0xc2, 0x09, 0x1e, 0x75, 0xa7,
-		0xc6, 0x2f, 0x3f, 0xc4, 0xa1, 0xff, 0x13, 0x39, 0xb2, 0xa8, 0x24, 0x4f,
-		0xbd, 0xe0, 0x31, 0xfe, 0x8f, 0x5e, 0x9f, 0x56, 0xeb, 0x56, 0xaf, 0x84,
-		0xbc, 0xef, 0x97, 0xa0, 0xfe, 0x9d, 0x9e, 0xac, 0x2d, 0x2d, 0xf1, 0x40,
-		0xef, 0xb8, 0xf5, 0xdf, 0x2d, 0xa2, 0xfc, 0xfd, 0x8c, 0xfa, 0x3f, 0xca,
-		0x9d, 0x87, 0x9f, 0x65, 0x58, 0x81, 0x2b, 0xb0, 0xf7, 0xff, 0xc3, 0xd9,
-		0xc7, 0xf9, 0xf8, 0x09, 0x13, 0x31, 0x38, 0x6a, 0x3d, 0x20, 0x94, 0x01,
-		0xee, 0x38, 0x66, 0x91, 0x35, 0x9a, 0xe8, 0x61, 0xd8, 0x87, 0x1c, 0x54,
-		0x66, 0x0b, 0x64, 0xd7, 0xf6, 0x8b, 0xae, 0x37, 0x86, 0xbd, 0xde, 0x5a,
-		0xd3, 0x2e, 0x1f, 0xbb, 0xfe, 0xaf, 0x00, 0xf0, 0x99, 0x3c, 0xf3, 0x42,
-		0x84, 0xfe, 0x37, 0x86, 0x79, 0x8a, 0x01, 0x39, 0x06, 0x5b, 0xf7, 0xe4,
-		0x90, 0xf7, 0x43, 0x92, 0xa0, 0xff, 0x82, 0x95, 0x84, 0x77, 0xe2, 0xd6,
-		0x7f, 0x87, 0x88, 0xf2, 0x0f, 0xb1, 0xf8, 0xcd, 0xfc, 0xca, 0x79, 0xf8,
-		0x78, 0xd7, 0xc2, 0x6f, 0x62, 0x34, 0x57, 0xde, 0xd4, 0x6a, 0xe1, 0x38,
-		0xfc, 0x46, 0x5b, 0x45, 0x5d, 0xa3, 0xc5, 0xec, 0x4f, 0xae, 0x64, 0x2e,
-		0x0f, 0x59, 0x5b, 0x08, 0x18, 0xe7, 0x1e, 0x67, 0x62, 0x3a, 0x80, 0xb3,
-		0x2d, 0xa9, 0x94, 0x65, 0x6f, 0xb7, 0x8f, 0x98, 0x03, 0xad, 0x22, 0xae,
-		0xd9, 0xaf, 0xfe, 0x55, 0xdd, 0x4c, 0x93, 0x67, 0x5e, 0x88, 0x5a, 0xff,
-		0x6b, 0x11, 0x66, 0xe7, 0x5f, 0xa8, 0x49, 0xd7, 0x93, 0x9e, 0x41, 0x15,
-		0xc2, 0x7a, 0xaa, 0xf8, 0xf4, 0xdf, 0x16, 0x33, 0xf1, 0x41, 0xc4, 0xe8,
-		0xf8, 0xbb, 0xb8, 0xf5, 0x5f, 0x9d, 0xe5, 0x3f, 0x3a, 0xf8, 0x7e, 0xbc,
-		0x45, 0xff, 0xf7, 0x71, 0x1e, 0xbe, 0x16, 0xb9, 0xd6, 0x28, 0xd9, 0xff,
-		0xa1, 0xbf, 0xdf, 0x76, 0xa4, 0xe1, 0x72, 0xe4, 0xe0, 0x39, 0x6c, 0x33,
-		0xae, 0xb5, 0xdd, 0xce, 0x95, 0xb8, 0x0c, 0x9c, 0x4d, 0x8f, 0x99, 0x4c,
-		0x0f, 0x8b, 0xe7, 0x9b, 0xd8, 0x8d, 0xbd, 0xa8, 0x6c, 0x4c, 0xd3, 0x90,
-		0xd1, 0xaf, 0xaf, 0xf1, 0x71, 0xcf, 0xd4, 0x98, 0xe9, 0xdd, 0x38, 0xf4,
-		0x5f, 0x9f, 0x36, 0xd0, 0x66, 0xf2, 0xd4, 0x0b, 0x61, 0xfa, 0xdf, 0x86,
-		0x2f, 0x5c, 0x65, 0x67, 0x61, 0x13, 0x80, 0x07, 0xb4, 0x33, 0x53, 0x65,
-		0xc5, 0x7e, 0xd5, 0x5d, 0x95, 0xea, 0x4d, 0xbf, 0xbd, 0xf8, 0xf4, 0x9f,
-		0x89, 0x9c, 0x90, 0xf5, 0xb2, 0x2a, 0x5c, 0x65, 0x7e, 0x26, 0x6e, 0xfd,
-		0x07, 0x30, 0x87, 0xeb, 0x61, 0x8e, 0xae, 0xfa, 0x1b, 0xca, 0x55, 0x60,
-		0x39, 0x57, 0x16, 0xb8, 0x59, 0xd6, 0xfc, 0x94, 0xd7, 0xcb, 0x5f, 0x98,
-		0x81, 0x00, 0xda, 0xf0, 0xd5, 0x1c, 0x43, 0xba, 0xba, 0xf4, 0x29, 0x3a,
-		0x83, 0x76, 0xbd, 0x99, 0xac, 0x1b, 0x73, 0x9e, 0xcd, 0x69, 0xe7, 0x50,
-		0x3e, 0x7b, 0xa6, 0x14, 0xa5, 0x31, 0x97, 0x2b, 0xac, 0xf6, 0x98, 0xa4,
-		0x47, 0xe1, 0x14, 0xbc, 0xcb, 0x78, 0x95, 0x4d, 0xe3, 0xb2, 0xff, 0xdf,
-		0x47, 0x0b, 0xc4, 0x2d, 0x38, 0xc1, 0xb8, 0x7e, 0x20, 0x1c, 0x8c, 0xf6,
-		0xbf, 0x97, 0xb0, 0x09, 0x53, 0xf1, 0x1d, 0x9f, 0xd1, 0xd5, 0x86, 0x7d,
-		0x27, 0xd7, 0xb2, 0xa7, 0x5d, 0x87, 0x29, 0x98, 0x8d, 0x3d, 0x54, 0x66,
-		0xbc, 0xe3, 0xff, 0xd1, 0xcc, 0x69, 0x09, 0x3e, 0xc6, 0x57, 0xf4, 0x38,
-		0xdb, 0x84, 0xfa, 0x09, 0xe8, 0xbf, 0x37, 0x4b, 0x9d, 0x8d, 0xa9, 0xf8,
-		0x01, 0xbb, 0x70, 0x9b, 0x45, 0xff, 0x29, 0x5c, 0x4f, 0x30, 0x7b, 0x1b,
-		0x86, 0x5a, 0x40, 0x1f, 0xe3, 0x9e, 0x9c, 0x3d, 0x96, 0x95, 0xc2, 0x77,
-		0x00, 0x7c, 0x1d, 0x1c, 0xd3, 0xe4, 0x22, 0x0f, 0x27, 0x58, 0x72, 0x5d,
-		0xc6, 0x5c, 0x6f, 0xb0, 0xda, 0x31, 0x54, 0x4d, 0xac, 0x0e, 0xe1, 0xf3,
-		0xa8, 0x54, 0x5f, 0x32, 0xd5, 0x57, 0x68, 0x10, 0xe7, 0xfa, 0xbf, 0xda,
-		0x39, 0xb0, 0x83, 0x79, 0x9c, 0x22, 0xcf, 0xbe, 0x10, 0xd4, 0x7f, 0x06,
-		0x5e, 0x62, 0xaf, 0xac, 0x9e, 0x68, 0xf3, 0xf8, 0xf0, 0x3a, 0x8e, 0x0e,
-		0x94, 0x27, 0xfd, 0x80, 0x84, 0xec, 0xff, 0x29, 0xb8, 0x8a, 0xfd, 0x30,
-		0x68, 0x6b, 0xf8, 0xc8, 0xb2, 0xd6, 0xed, 0x47, 0xff, 0x01, 0x5c, 0x48,
-		0x0f, 0x1c, 0x35, 0x16, 0xef, 0x6d, 0xb1, 0xff, 0x2b, 0x9e, 0x61, 0xba,
-		0xc6, 0x1e, 0xf9, 0xa9, 0xbd, 0x35, 0x83, 0xf9, 0xea, 0x47, 0x00, 0x37,
-		0x6b, 0xd3, 0xf4, 0x60, 0x8f, 0x5e, 0x30, 0x57, 0x7f, 0x99, 0x3e, 0x3b,
-		0x66, 0xdb, 0xfe, 0x13, 0xfc, 0xe6, 0x26, 0x1e, 0xf3, 0x30, 0xaf, 0xfd,
-		0x3f, 0x8f, 0xb1, 0x1d, 0xd9, 0x6d, 0xa9, 0x63, 0xbb, 0xfe, 0x6b, 0x73,
-		0xb4, 0xb4, 0x0b, 0x73, 0x3c, 0x56, 0x21, 0x85, 0x83, 0x6f, 0xfd, 0xaf,
-		0x32, 0x5a, 0x5a, 0xe7, 0xc5, 0xce, 0x28, 0xb5, 0x09, 0x1a, 0xf2, 0x29,
-		0xb7, 0xeb, 0x2c, 0xe0, 0xa3, 0x0d, 0xa8, 0x87, 0x36, 0x68, 0x65, 0x59,
-		0x87, 0xcb, 0x5f, 0x75, 0x7c, 0x39, 0xb8, 0x87, 0x67, 0xa2, 0x71, 0x76,
-		0x5c, 0x0a, 0x8d, 0x70, 0x54, 0xb1, 0x8e, 0xe5, 0xa8, 0xfc, 0x0a, 0x97,
-		0x26, 0x25, 0xa7, 0xae, 0x6c, 0xed, 0xfe, 0x13, 0x87, 0xfe, 0x53, 0xe9,
-		0xcb, 0xfc, 0x9a, 0x66, 0x37, 0xb3, 0x20, 0xfa, 0x8f, 0x8d, 0x44, 0xf5,
-		0xef, 0x8f, 0xcb, 0xdc, 0x95, 0xf3, 0x00, 0x23, 0xfc, 0xc2, 0xe3, 0x2c,
-		0x80, 0xe2, 0xcc, 0x78, 0xee, 0x9e, 0x4a, 0x4e, 0x5e, 0x6a, 0x4d, 0x72,
-		0x41, 0x1c, 0xfa, 0xef, 0xc1, 0xb1, 0x5b, 0xba, 0x3c, 0xf5, 0x42, 0x09,
-		0xd1, 0x7f, 0x73, 0xce, 0x10, 0x5a, 0xd2, 0xce, 0xbf, 0xde, 0x63, 0xf5,
-		0xac, 0x38, 0x93, 0xca, 0x39, 0x45, 0xcf, 0x24, 0xe5, 0x56, 0x3f, 0x81,
-		0xf5, 0xff, 0xf7, 0xe5, 0x99, 0x17, 0x4a, 0x8c, 0xfe, 0x03, 0x78, 0x9b,
-		0xeb, 0x13, 0x9f, 0x62, 0x03, 0x9f, 0xeb, 0xd2, 0x25, 0xb4, 0x96, 0xdb,
-		0x72, 0x85, 0xf0, 0x90, 0x24, 0xe5, 0xd6, 0x87, 0x2b, 0x00, 0xb1, 0xeb,
-		0xdf, 0x36, 0x6e, 0x10, 0x44, 0xff, 0xc5, 0x51, 0xff, 0xe5, 0xf1, 0x36,
-		0xed, 0xfb, 0xc0, 0xf7, 0x38, 0xb2, 0xc4, 0xd6, 0xf2, 0x9d, 0x00, 0xde,
-		0x4b, 0x5a, 0x6e, 0xaf, 0x73, 0x57, 0x64, 0xec, 0xfa, 0xaf, 0xc7, 0xdd,
-		0x4a, 0xc7, 0xca, 0x53, 0x2f, 0x84, 0xec, 0x08, 0x5d, 0x88, 0x8f, 0xe3,
-		0xf8, 0xbb, 0xce, 0x58, 0x98, 0xc4, 0x27, 0xda, 0x4e, 0x35, 0x64, 0xa1,
-		0x4e, 0x89, 0xae, 0xe5, 0xd7, 0xb0, 0x10, 0xe7, 0x24, 0x29, 0xaf, 0xca,
-		0x3c, 0x85, 0xed, 0xc4, 0xb8, 0xec, 0xff, 0x1f, 0x59, 0xce, 0x29, 0x11,
-		0x04, 0xa1, 0xf8, 0xd3, 0x97, 0x5e, 0x49, 0xf1, 0x9d, 0xff, 0x71, 0x26,
-		0x80, 0x5f, 0xa5, 0x0e, 0x05, 0xa1, 0xc4, 0x72, 0x9e, 0xd5, 0x83, 0xd1,
-		0xae, 0xff, 0x76, 0xf4, 0xe0, 0x92, 0x3a, 0x14, 0x84, 0x92, 0x4a, 0x5b,
-		0x5a, 0x44, 0xab, 0xc7, 0xa5, 0xff, 0xdb, 0xac, 0x67, 0x07, 0x09, 0x82,
-		0x50, 0xdc, 0x49, 0xa1, 0x0f, 0xdf, 0x0f, 0x21, 0x7b, 0x9e, 0xfc, 0xe9,
-		0x3f, 0x03, 0x57, 0xd1, 0x9f, 0x79, 0xb0, 0xd4, 0xa1, 0x20, 0x94, 0x60,
-		0x9a, 0xb8, 0xf1, 0x15, 0x56, 0x68, 0x4e, 0x13, 0xd0, 0xeb, 0xff, 0x18,
-		0xcc, 0x75, 0xfd, 0xfe, 0x9f, 0x94, 0xe8, 0x1e, 0x82, 0x50, 0xc2, 0xa9,
-		0x82, 0xbb, 0xf0, 0x87, 0x36, 0xfe, 0x47, 0x67, 0x2c, 0xc7, 0x74, 0xed,
-		0x2a, 0xef, 0x2e, 0x4c, 0x47, 0x5f, 0xa9, 0x3b, 0x41, 0x38, 0x40, 0xa8,
-		0x6c, 0x3d, 0x73, 0x20, 0x94, 0x32, 0x38, 0xa2, 0xc4, 0xfa, 0x4e, 0x09,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,
-		0x82, 0x20, 0x08, 0x82, 0x1f, 0x9c, 0x1f, 0xa9, 0x07, 0x41, 0x10, 0xfd,
-		0x0b, 0x82, 0x70, 0xd0, 0xe9, 0xff, 0xff, 0x01};
+#define IOSEVKA_BASE_SIZE 32
+#define IOSEVKA_GLYPH_COUNT 65
+#define IOSEVKA_GLYPH_PADDING 2
+#define IOSEVKA_WIDTH 256
+#define IOSEVKA_HEIGHT 112
+#define IOSEVKA_FORMAT 1
+#define IOSEVKA_SIZE 28672
+// zero when the data is not compressed
+#define IOSEVKA_COMPRESSED_SIZE 6485
 
-// Font characters rectangles data
-static const Rectangle fontRecs_Iosevka[95] = {
-		{4, 4, 13, 32},			{25, 4, 5, 21},			{38, 4, 9, 10},
-		{55, 4, 13, 20},		{76, 4, 12, 26},		{96, 4, 13, 22},
-		{117, 4, 13, 22},		{138, 4, 3, 10},		{149, 4, 9, 28},
-		{166, 4, 9, 28},		{183, 4, 12, 12},		{203, 4, 11, 12},
-		{222, 4, 5, 11},		{235, 4, 11, 3},		{254, 4, 5, 6},
-		{267, 4, 11, 27},		{286, 4, 12, 22},		{306, 4, 8, 20},
-		{322, 4, 11, 21},		{341, 4, 12, 22},		{361, 4, 11, 20},
-		{380, 4, 12, 21},		{400, 4, 12, 21},		{420, 4, 11, 20},
-		{439, 4, 12, 22},		{459, 4, 12, 21},		{479, 4, 5, 16},
-		{492, 4, 5, 21},		{4, 44, 12, 15},		{24, 44, 11, 8},
-		{43, 44, 11, 15},		{62, 44, 11, 22},		{81, 44, 11, 24},
-		{100, 44, 12, 20},	{120, 44, 12, 20},	{140, 44, 11, 22},
-		{159, 44, 12, 20},	{179, 44, 11, 20},	{198, 44, 10, 20},
-		{216, 44, 11, 22},	{235, 44, 11, 20},	{254, 44, 10, 20},
-		{272, 44, 11, 21},	{291, 44, 11, 20},	{310, 44, 10, 20},
-		{328, 44, 12, 20},	{348, 44, 11, 20},	{367, 44, 12, 22},
-		{387, 44, 11, 20},	{406, 44, 12, 26},	{426, 44, 12, 20},
-		{446, 44, 12, 22},	{466, 44, 11, 20},	{485, 44, 11, 21},
-		{4, 84, 12, 20},		{24, 84, 13, 20},		{45, 84, 12, 20},
-		{65, 84, 12, 20},		{85, 84, 11, 20},		{104, 84, 8, 27},
-		{120, 84, 11, 27},	{139, 84, 9, 27},		{156, 84, 12, 8},
-		{176, 84, 11, 2},		{195, 84, 7, 8},		{210, 84, 11, 16},
-		{229, 84, 12, 21},	{249, 84, 11, 16},	{268, 84, 11, 21},
-		{287, 84, 12, 16},	{307, 84, 12, 21},	{327, 84, 11, 22},
-		{346, 84, 11, 20},	{365, 84, 10, 20},	{383, 84, 10, 27},
-		{401, 84, 11, 20},	{420, 84, 10, 20},	{438, 84, 12, 15},
-		{458, 84, 11, 15},	{477, 84, 12, 16},	{4, 124, 12, 21},
-		{24, 124, 11, 21},	{43, 124, 10, 15},	{61, 124, 11, 16},
-		{80, 124, 12, 21},	{100, 124, 11, 16}, {119, 124, 12, 15},
-		{139, 124, 13, 15}, {160, 124, 12, 15}, {180, 124, 12, 21},
-		{200, 124, 11, 15}, {219, 124, 9, 28},	{236, 124, 3, 27},
-		{247, 124, 10, 28}, {265, 124, 13, 7},
+static const unsigned char IOSEVKA_DATA[6485] = {
+	0xed, 0x9c, 0x77, 0x7c, 0x14, 0xd5, 0xda, 0xc7, 0xcf, 0xa6, 0x93, 0x46, 0x6f, 0x4b, 0x97, 0xd0,
+	0x91, 0x10, 0x04, 0x04, 0x22, 0x20, 0x01, 0xa4, 0x83, 0x02, 0x2a, 0xd2, 0x14, 0x15, 0x0b, 0x0a,
+	0x58, 0x91, 0x7a, 0x11, 0x15, 0x94, 0xe2, 0x8b, 0xa0, 0x57, 0x05, 0x44, 0x11, 0x44, 0xe0, 0x22,
+	0x88, 0xb4, 0x50, 0x04, 0xa9, 0x82, 0x04, 0x08, 0x90, 0x08, 0x84, 0x4e, 0x48, 0x48, 0x21, 0xd9,
+	0x34, 0xb2, 0xd9, 0xcd, 0x96, 0xdf, 0x3b, 0x33, 0xe7, 0x9c, 0xd9, 0x99, 0xd9, 0xd9, 0x25, 0x04,
+	0xee, 0x7b, 0xdf, 0x0f, 0x37, 0xe7, 0x8f, 0x4c, 0x9e, 0x9d, 0x99, 0x73, 0xe6, 0x3b, 0x73, 0xca,
+	0x73, 0x9e, 0xe7, 0x39, 0x87, 0x90, 0xb2, 0x54, 0x96, 0x74, 0x52, 0xad, 0x5d, 0x27, 0x63, 0xc4,
+	0x63, 0xf5, 0xa7, 0x7a, 0xf0, 0x9f, 0x82, 0xea, 0x56, 0x35, 0x28, 0x2f, 0xf1, 0xab, 0x53, 0x49,
+	0x75, 0x8b, 0x5f, 0x6d, 0xf5, 0xf9, 0xa0, 0x7a, 0xd5, 0x54, 0x72, 0xb9, 0x7a, 0xaa, 0xf3, 0x1a,
+	0x51, 0x9b, 0x7b, 0x40, 0x9d, 0xea, 0x3e, 0x0a, 0xb1, 0x6a, 0xb7, 0x2e, 0x61, 0x24, 0xc8, 0x58,
+	0x55, 0x12, 0x62, 0x4c, 0x47, 0xf4, 0xb2, 0xa9, 0x64, 0xe2, 0xa9, 0x8f, 0xeb, 0xc6, 0xc9, 0xa6,
+	0x83, 0xca, 0x7c, 0x7d, 0x6b, 0x87, 0x95, 0x88, 0x7f, 0x26, 0x20, 0x95, 0xd1, 0x0b, 0x67, 0xe9,
+	0x0f, 0xad, 0xb7, 0xdb, 0x80, 0xd4, 0x8f, 0x03, 0xf8, 0x05, 0x2d, 0x7f, 0xb3, 0x02, 0xc9, 0x33,
+	0xfd, 0xb8, 0x6c, 0xfc, 0xf9, 0xb6, 0x70, 0x7e, 0xba, 0x2f, 0x97, 0x9b, 0x6c, 0x17, 0xce, 0xa7,
+	0x4c, 0x96, 0xe5, 0x76, 0xbb, 0x1d, 0xc2, 0xf5, 0xd3, 0xfc, 0xf5, 0x45, 0x6d, 0xee, 0x0d, 0x7e,
+	0x29, 0x02, 0xd2, 0xe6, 0x04, 0x31, 0xd1, 0x67, 0xbe, 0x05, 0x30, 0x8d, 0xee, 0x8b, 0x33, 0x44,
+	0xf5, 0x50, 0xa4, 0xe5, 0x0e, 0xf1, 0xbe, 0x7f, 0xd0, 0xa7, 0xa8, 0x0c, 0x14, 0x99, 0xa5, 0xd4,
+	0x5f, 0xe6, 0x08, 0xcf, 0xc6, 0xd3, 0x2e, 0xaa, 0x06, 0xab, 0x84, 0x6c, 0xcf, 0x8f, 0x28, 0x01,
+	0xff, 0xab, 0xc0, 0x46, 0x65, 0x51, 0x5d, 0xcd, 0x28, 0xf8, 0x2b, 0x09, 0xd8, 0xc3, 0x80, 0x3a,
+	0x16, 0xe0, 0xf6, 0x5f, 0xe7, 0x81, 0xad, 0xec, 0x23, 0x55, 0x4b, 0x45, 0xf1, 0xe9, 0x6b, 0xc0,
+	0x2a, 0x8e, 0x9f, 0x83, 0xc2, 0xe3, 0x97, 0x81, 0x1f, 0x98, 0x1c, 0x53, 0x04, 0xcb, 0xc9, 0xab,
+	0xc0, 0x26, 0x83, 0x9e, 0xa8, 0xcd, 0xbd, 0x51, 0x0e, 0x2c, 0xf1, 0x97, 0x80, 0xdd, 0x4c, 0xfe,
+	0x08, 0x38, 0xb7, 0x7c, 0x53, 0xd1, 0x5c, 0x2d, 0xff, 0x23, 0x66, 0x14, 0x9e, 0x48, 0x05, 0x36,
+	0x18, 0x18, 0x7f, 0xb0, 0x96, 0x63, 0x1a, 0xce, 0xb8, 0xaa, 0x51, 0xe3, 0x9b, 0xb0, 0x9c, 0x10,
+	0x1e, 0xf2, 0xdd, 0x3b, 0xf3, 0xfb, 0xbd, 0xf8, 0x7e, 0x15, 0x45, 0x51, 0x3e, 0x17, 0xb1, 0x51,
+	0xa8, 0x38, 0x5d, 0xf2, 0xf0, 0x06, 0xfd, 0x20, 0xe7, 0xb0, 0xa5, 0x22, 0x21, 0x3d, 0xf3, 0xf1,
+	0x2a, 0xbd, 0x7e, 0x19, 0x12, 0x1a, 0x12, 0x32, 0xd4, 0x82, 0x27, 0xa8, 0xbc, 0x09, 0x47, 0xab,
+	0x0b, 0xb2, 0x03, 0x1d, 0x68, 0x76, 0x57, 0xb1, 0xb9, 0x3c, 0x21, 0x03, 0x2c, 0x18, 0xa6, 0x23,
+	0x6a, 0x73, 0x27, 0xbb, 0x70, 0xb8, 0x16, 0x21, 0x3d, 0x0a, 0x30, 0x46, 0x12, 0xcb, 0x17, 0x60,
+	0x91, 0x40, 0xd1, 0xce, 0xa4, 0xe5, 0x8f, 0xc7, 0x36, 0xe1, 0x29, 0x9f, 0x35, 0x63, 0xb8, 0x07,
+	0xfe, 0xb0, 0x6c, 0x0c, 0x71, 0x49, 0xdb, 0x70, 0xd8, 0x48, 0xc8, 0x70, 0x9b, 0xbd, 0x71, 0x89,
+	0xfb, 0x01, 0x56, 0x54, 0x67, 0x98, 0xc2, 0xc5, 0xe3, 0xbb, 0xb4, 0x55, 0x90, 0x0e, 0xc8, 0xaf,
+	0x28, 0x1e, 0x27, 0xe1, 0x4f, 0x49, 0x36, 0xe4, 0xa1, 0x3b, 0x7d, 0x0d, 0xf4, 0x83, 0x1b, 0x2c,
+	0x88, 0x16, 0x8f, 0xeb, 0xf1, 0x89, 0x24, 0x77, 0x61, 0xd7, 0xcf, 0xc7, 0x66, 0x1d, 0x51, 0x9b,
+	0x7b, 0x75, 0x87, 0x33, 0x42, 0x3c, 0xce, 0xc2, 0x76, 0x49, 0xee, 0x87, 0x8c, 0x40, 0xf1, 0xf8,
+	0x8d, 0x86, 0xbf, 0x39, 0x8a, 0x6b, 0x88, 0xc7, 0xc5, 0xd8, 0xea, 0x81, 0x7f, 0x2a, 0x4e, 0xb9,
+	0x5a, 0x7f, 0x5d, 0xd8, 0xeb, 0x89, 0xc7, 0x45, 0xf8, 0xca, 0x3b, 0x74, 0xa0, 0x51, 0x4c, 0xe1,
+	0x8a, 0xa2, 0xc6, 0xd1, 0x12, 0x48, 0x63, 0x14, 0x4a, 0xc7, 0xd7, 0xb0, 0x43, 0x3a, 0x36, 0x43,
+	0x11, 0x6d, 0x66, 0xf1, 0xf1, 0x52, 0xbf, 0x32, 0x92, 0xbd, 0x8f, 0x60, 0xa0, 0xba, 0x78, 0xfc,
+	0x0c, 0x5f, 0x13, 0x7a, 0x3f, 0xbd, 0xbe, 0xdb, 0xd9, 0x2d, 0xba, 0xa2, 0x3a, 0xf7, 0x8e, 0x48,
+	0x96, 0x8e, 0x9d, 0xfe, 0x5a, 0x27, 0x1d, 0x27, 0xd0, 0xd7, 0x44, 0x46, 0x68, 0xf8, 0xa3, 0xe3,
+	0xe9, 0xef, 0xbd, 0x71, 0x45, 0x9f, 0x5f, 0x68, 0xfd, 0x4f, 0xba, 0xa4, 0xe1, 0x38, 0x46, 0x6f,
+	0x63, 0xd9, 0x78, 0x4c, 0x31, 0x10, 0xd3, 0x7c, 0x45, 0x51, 0x53, 0x59, 0xc3, 0xae, 0x02, 0x94,
+	0x93, 0x7a, 0x55, 0x26, 0x57, 0x05, 0x82, 0x94, 0x77, 0x3e, 0x8b, 0x7d, 0xf4, 0x9f, 0x54, 0xf4,
+	0x12, 0x0f, 0xb1, 0x78, 0x8b, 0x28, 0xef, 0x97, 0x3f, 0x8b, 0xae, 0xc8, 0x73, 0x6f, 0x8d, 0x5c,
+	0x83, 0xfa, 0xfc, 0x4a, 0x56, 0x0f, 0xb4, 0xfd, 0x1f, 0xeb, 0x8c, 0x90, 0xaa, 0xcf, 0x3f, 0x1d,
+	0xc7, 0x14, 0x19, 0xbd, 0x0d, 0xfa, 0x3a, 0x8d, 0xec, 0xa3, 0x79, 0x4c, 0x6d, 0xe3, 0xe2, 0xe2,
+	0x32, 0x54, 0xfc, 0xd3, 0xd8, 0x13, 0xf0, 0x22, 0xb8, 0xfc, 0xb4, 0xa6, 0xc8, 0x85, 0xbc, 0x6a,
+	0x2d, 0xc6, 0x1f, 0x42, 0xc9, 0x6d, 0x1d, 0xb6, 0x06, 0x44, 0x79, 0xbd, 0xdc, 0x2b, 0xe9, 0x8a,
+	0x3c, 0xf7, 0x90, 0x02, 0xf4, 0xd4, 0x3b, 0xdf, 0xd7, 0x03, 0xff, 0x68, 0x1c, 0x65, 0xb7, 0xbf,
+	0xf7, 0x57, 0xe6, 0xb5, 0x8d, 0xd1, 0xf2, 0xd8, 0x98, 0x89, 0x98, 0x1a, 0xae, 0xe7, 0x7b, 0x0f,
+	0x6b, 0xa5, 0x63, 0x4d, 0xc0, 0xff, 0x8e, 0x0d, 0x7f, 0x51, 0x09, 0xf8, 0x7d, 0x66, 0x39, 0xd4,
+	0xfc, 0x11, 0xf9, 0xce, 0xf6, 0xf4, 0xbf, 0x3a, 0x39, 0x58, 0x68, 0xa8, 0x77, 0x1d, 0x4b, 0x48,
+	0x29, 0xf8, 0xc9, 0x97, 0xb8, 0xda, 0xf0, 0x2e, 0xf8, 0x77, 0xe1, 0x23, 0x76, 0x3b, 0x50, 0xec,
+	0x84, 0xf3, 0x05, 0xf6, 0xfb, 0xcb, 0xb0, 0x66, 0xc3, 0x99, 0xf4, 0x06, 0xab, 0x03, 0x63, 0x58,
+	0xe3, 0x8c, 0x46, 0x1e, 0xb9, 0x1f, 0xfc, 0xe5, 0x37, 0x23, 0x57, 0xc1, 0x5f, 0xbe, 0xdf, 0x8c,
+	0x6c, 0xfa, 0x20, 0x52, 0x9b, 0xb4, 0x62, 0x53, 0x1a, 0x0e, 0x05, 0x95, 0x8a, 0x3f, 0xfc, 0x22,
+	0xb2, 0x5f, 0x95, 0x55, 0x0b, 0x32, 0x85, 0xb5, 0x8f, 0xfe, 0xfa, 0xfc, 0xa3, 0x9c, 0xf9, 0x75,
+	0xd9, 0xed, 0x99, 0x4f, 0x06, 0x84, 0xcf, 0x83, 0x8d, 0xbd, 0xbc, 0x7d, 0xc2, 0xeb, 0x48, 0x14,
+	0x86, 0xc7, 0x2f, 0xd9, 0x98, 0x8c, 0xe2, 0x5a, 0xb4, 0x92, 0x9e, 0xbd, 0x1f, 0xfc, 0xcd, 0x93,
+	0x10, 0x17, 0xa5, 0xe0, 0xef, 0x28, 0xbc, 0xfd, 0x09, 0xae, 0x0c, 0xba, 0xdb, 0x81, 0x03, 0x21,
+	0x5e, 0x80, 0x5b, 0x9f, 0x17, 0xd2, 0x66, 0x5d, 0x7e, 0x52, 0xf3, 0x38, 0xf0, 0xb7, 0xdc, 0x06,
+	0xc6, 0x63, 0x1b, 0x05, 0xd5, 0xe5, 0x1f, 0x57, 0xec, 0x1c, 0xc5, 0x6f, 0x1f, 0x45, 0x3b, 0x9d,
+	0x45, 0x92, 0x5c, 0xa1, 0x18, 0x27, 0xeb, 0x13, 0xc3, 0x48, 0x3b, 0x7a, 0xf0, 0xf7, 0xb1, 0x57,
+	0x50, 0x59, 0xfb, 0x5a, 0xf1, 0xfd, 0x7d, 0xe0, 0x7f, 0x2a, 0x1f, 0x3f, 0x04, 0x29, 0xbb, 0x9c,
+	0x46, 0x9b, 0x93, 0x61, 0x1a, 0xcc, 0xa5, 0x90, 0x4d, 0xc2, 0xeb, 0x28, 0x7c, 0xda, 0x0b, 0x7f,
+	0x07, 0xb1, 0xba, 0x9e, 0xd1, 0xe7, 0x27, 0xfe, 0x33, 0x6e, 0xc3, 0xb9, 0x90, 0xa9, 0x2e, 0x3d,
+	0x91, 0x23, 0x8d, 0x2e, 0xdf, 0xeb, 0xf0, 0x87, 0xae, 0x86, 0x83, 0x69, 0x0d, 0xe1, 0xbb, 0x76,
+	0x49, 0xfa, 0xf1, 0x10, 0x9c, 0x62, 0xb7, 0x39, 0xa4, 0x81, 0xfe, 0x2b, 0xfc, 0xca, 0xb4, 0xc5,
+	0x2c, 0xe4, 0xee, 0x3b, 0x2d, 0x94, 0xfa, 0xd4, 0xbd, 0xf3, 0x67, 0x38, 0x8b, 0xdf, 0x74, 0xeb,
+	0x72, 0x47, 0x59, 0x2d, 0x9d, 0xd8, 0xf3, 0xef, 0x44, 0x4a, 0xd7, 0x85, 0xb0, 0x0f, 0xf0, 0xcc,
+	0xef, 0x1b, 0x16, 0x36, 0xd4, 0x23, 0xbf, 0xd0, 0x4b, 0xaf, 0x04, 0x96, 0xb1, 0x77, 0x69, 0xc2,
+	0x4f, 0x82, 0x02, 0xd0, 0x3b, 0x8b, 0xf1, 0x77, 0xcf, 0x8f, 0xe3, 0x57, 0xd5, 0x3e, 0x85, 0x9c,
+	0xbe, 0x9a, 0x47, 0xe7, 0xc3, 0xe8, 0x18, 0xd0, 0xcb, 0x3a, 0x23, 0x9d, 0x9d, 0x69, 0xbe, 0xcd,
+	0x09, 0xe4, 0x23, 0x3b, 0xf8, 0xde, 0xf9, 0x91, 0xde, 0x59, 0x67, 0xc8, 0x79, 0x17, 0x7b, 0xe9,
+	0x3f, 0x1f, 0xe3, 0xc6, 0x43, 0x84, 0xcc, 0x40, 0x41, 0x4d, 0x6f, 0x0d, 0xbe, 0xaf, 0x17, 0x7e,
+	0xa1, 0x5b, 0x77, 0x80, 0xa1, 0xbd, 0x25, 0x14, 0x17, 0x7b, 0xcc, 0x3a, 0xd3, 0x6d, 0xe0, 0xae,
+	0x9c, 0x84, 0x8b, 0x4d, 0xb4, 0x8f, 0x5e, 0x0d, 0x08, 0xa0, 0xca, 0x19, 0x1d, 0xef, 0x6a, 0xc1,
+	0x21, 0x4f, 0x43, 0xc2, 0x9b, 0xd6, 0xfd, 0x19, 0xf3, 0xc8, 0xbd, 0xf3, 0x9f, 0xad, 0xad, 0x37,
+	0xe4, 0x96, 0xb7, 0x3b, 0x25, 0xb5, 0xb9, 0x52, 0x3e, 0x55, 0x84, 0xf7, 0x60, 0x71, 0xe9, 0xf9,
+	0x85, 0x61, 0x60, 0x07, 0x1f, 0xba, 0xb3, 0x81, 0x6b, 0x03, 0xfb, 0xba, 0xf1, 0x6f, 0xc2, 0x95,
+	0xda, 0x6e, 0x8f, 0x5e, 0x1f, 0xc5, 0x4c, 0x6d, 0xe2, 0xe3, 0x9d, 0xd3, 0x57, 0x31, 0xb8, 0x3b,
+	0xad, 0x75, 0xef, 0x9a, 0x9f, 0x6b, 0x20, 0x55, 0xd8, 0x13, 0x4e, 0xd1, 0x68, 0x2c, 0x72, 0x4a,
+	0x81, 0x34, 0x00, 0x0e, 0x40, 0x22, 0xd3, 0x58, 0x2e, 0xe9, 0x2b, 0x3c, 0x2a, 0x85, 0x46, 0x91,
+	0xbb, 0x2a, 0xb7, 0x47, 0x5c, 0x03, 0x55, 0x40, 0xd3, 0x08, 0x5f, 0x21, 0xd7, 0x78, 0xf5, 0x43,
+	0xf6, 0x80, 0xbd, 0xa3, 0x4b, 0x7a, 0x38, 0x76, 0x25, 0xfb, 0xf5, 0xb2, 0x74, 0x1c, 0x88, 0xc3,
+	0xd2, 0xf1, 0x51, 0xdc, 0x52, 0xdc, 0x13, 0x7b, 0x27, 0xed, 0x57, 0x8f, 0x7f, 0x02, 0x7e, 0x93,
+	0x7e, 0x6d, 0x08, 0x9b, 0x34, 0x98, 0xbe, 0xce, 0x7a, 0xe4, 0x26, 0xb0, 0xd0, 0xe9, 0x62, 0xc2,
+	0x5c, 0xaa, 0xf7, 0x17, 0xe2, 0x61, 0xaa, 0x6a, 0x6d, 0xa4, 0x13, 0x4e, 0x56, 0xf5, 0xde, 0x64,
+	0x9a, 0x7c, 0xf4, 0xe1, 0x9f, 0xc5, 0xc3, 0x44, 0x96, 0xdd, 0x70, 0xca, 0xff, 0xa6, 0x9c, 0xbb,
+	0x59, 0x3a, 0x8e, 0x8c, 0xa5, 0x33, 0xb4, 0xda, 0xb0, 0x4b, 0x77, 0x57, 0xea, 0xdc, 0x46, 0x92,
+	0x5f, 0xc1, 0x1e, 0xe9, 0x18, 0xb9, 0xf0, 0xdd, 0x20, 0xf6, 0xf9, 0x7f, 0x52, 0xda, 0x08, 0x1c,
+	0x68, 0x2a, 0x1e, 0x97, 0xb0, 0xd7, 0x59, 0xd5, 0x6e, 0x95, 0x5a, 0xdf, 0xa7, 0x4c, 0x7d, 0xa6,
+	0x3a, 0x35, 0x8a, 0x8c, 0x77, 0xcf, 0xdf, 0x13, 0x19, 0x41, 0x94, 0x3b, 0x81, 0x75, 0x29, 0xb4,
+	0x47, 0x9e, 0x80, 0xe3, 0x4c, 0x33, 0xbf, 0xe4, 0x4f, 0x5f, 0x7d, 0x61, 0x30, 0x95, 0xcf, 0x49,
+	0xef, 0x69, 0x10, 0x32, 0xd9, 0x27, 0xc9, 0x0e, 0x15, 0x8f, 0x9f, 0xd0, 0xf7, 0xd0, 0x1f, 0x19,
+	0xd2, 0x87, 0xfe, 0x8e, 0xf2, 0xc7, 0xc8, 0xb9, 0x1f, 0x67, 0x7a, 0xcb, 0x69, 0xe9, 0xee, 0x61,
+	0xb8, 0x48, 0xab, 0x2c, 0x0a, 0x82, 0xe8, 0xa7, 0xfb, 0x54, 0xea, 0x5b, 0x33, 0x80, 0x99, 0xd2,
+	0x34, 0xb2, 0x00, 0x5d, 0x95, 0xcf, 0xbc, 0x19, 0xfb, 0x85, 0xd6, 0x37, 0xd8, 0x8e, 0x47, 0xa9,
+	0xbc, 0x1a, 0x3b, 0x85, 0x59, 0x66, 0x2f, 0x0b, 0x06, 0x2a, 0x75, 0xa5, 0xc5, 0xe4, 0xee, 0xf9,
+	0x83, 0x6e, 0x60, 0xb9, 0x00, 0xd8, 0x2a, 0x03, 0x53, 0xe9, 0x7c, 0xf6, 0xba, 0xd4, 0x23, 0x47,
+	0x65, 0xe3, 0x3d, 0x3a, 0xcf, 0xcc, 0xc3, 0x37, 0x02, 0x78, 0x8b, 0xf3, 0xf8, 0x91, 0xb6, 0x64,
+	0x33, 0x66, 0x0a, 0x9f, 0xae, 0xde, 0x05, 0xa6, 0x00, 0x06, 0xdc, 0xc4, 0x2a, 0x01, 0xa1, 0xf3,
+	0x6d, 0x48, 0xba, 0x59, 0xf9, 0x7c, 0xfc, 0x28, 0xdc, 0xde, 0x73, 0x27, 0xe5, 0xf7, 0x4f, 0xe1,
+	0xb9, 0x7f, 0x40, 0x3b, 0x30, 0x0b, 0x66, 0x8b, 0x72, 0x32, 0x53, 0xa7, 0x84, 0xe9, 0xf2, 0xda,
+	0xca, 0x24, 0x60, 0x1a, 0x8a, 0x9b, 0xb3, 0x66, 0x82, 0x35, 0xd2, 0x88, 0x0b, 0x9b, 0xaa, 0xbd,
+	0x34, 0xc8, 0x46, 0xde, 0xde, 0x78, 0xc8, 0x84, 0xb5, 0xaf, 0x23, 0x7b, 0xe7, 0x31, 0xe0, 0x67,
+	0xd7, 0x25, 0x8f, 0xa1, 0xa8, 0x56, 0x29, 0xf8, 0xc9, 0xc0, 0x62, 0xdc, 0xdc, 0x76, 0xd0, 0x8e,
+	0xe3, 0xac, 0x83, 0xea, 0x65, 0x45, 0xe6, 0x8e, 0x23, 0x0e, 0xfc, 0xc9, 0x34, 0xe9, 0x61, 0x4e,
+	0x64, 0xfe, 0x7e, 0xbc, 0x18, 0xd7, 0xaa, 0x50, 0xf9, 0x75, 0xe0, 0x7a, 0xec, 0x41, 0x0b, 0xae,
+	0xd5, 0xa0, 0x72, 0x7f, 0x1b, 0x32, 0x76, 0x9f, 0x74, 0x72, 0x0b, 0xc7, 0x64, 0x41, 0x55, 0x8b,
+	0x8d, 0x2b, 0x7a, 0x9c, 0x75, 0x68, 0xfd, 0x6c, 0x34, 0xf7, 0x63, 0x01, 0x7c, 0xa6, 0x82, 0x1b,
+	0x3b, 0xe3, 0x6c, 0x38, 0xc3, 0xf4, 0xa7, 0x1e, 0x56, 0x58, 0xaf, 0x17, 0xc0, 0xf9, 0x3e, 0x15,
+	0x77, 0xc0, 0x3a, 0x80, 0xd6, 0x65, 0x47, 0x2a, 0x4d, 0x7b, 0x98, 0xfe, 0xbd, 0x53, 0x50, 0xc8,
+	0xb3, 0xa6, 0xc8, 0x16, 0x8f, 0x87, 0xfe, 0x25, 0xc8, 0xd9, 0x1f, 0x29, 0x7a, 0xbf, 0x3d, 0x25,
+	0x6b, 0xfd, 0x62, 0xdf, 0x3b, 0x4f, 0xa5, 0x6a, 0x74, 0x3b, 0x26, 0x0c, 0x9d, 0xb7, 0x97, 0xc8,
+	0x26, 0xbf, 0x4e, 0x87, 0x85, 0xaf, 0x90, 0xb7, 0x48, 0x7e, 0xff, 0x3d, 0x4f, 0x8a, 0xfa, 0xce,
+	0xca, 0x2a, 0x5c, 0x1e, 0x72, 0x5e, 0x90, 0x8b, 0x56, 0xcb, 0x6d, 0x2d, 0x46, 0xd0, 0xe8, 0x90,
+	0xb3, 0x80, 0x5f, 0x3f, 0x45, 0xd0, 0x9c, 0xaf, 0xf4, 0x0f, 0xe5, 0x1d, 0x7a, 0x37, 0xf1, 0x6c,
+	0xfe, 0xd2, 0x50, 0x7e, 0xf5, 0xb0, 0xb3, 0x62, 0xee, 0x5f, 0x97, 0xe7, 0x72, 0xeb, 0x5f, 0xf3,
+	0x51, 0x74, 0x80, 0xab, 0x2d, 0x3e, 0x2d, 0xaa, 0xd3, 0xbb, 0xc0, 0x93, 0x3c, 0x2e, 0x54, 0x6e,
+	0xfd, 0x90, 0x6a, 0x6e, 0x13, 0xda, 0x32, 0x22, 0x40, 0x21, 0x76, 0x85, 0xa5, 0xf6, 0x1d, 0xc0,
+	0x3b, 0x7c, 0x24, 0x19, 0x53, 0xd6, 0x60, 0xba, 0x46, 0xd5, 0x6a, 0x0e, 0x87, 0xca, 0x76, 0x58,
+	0xad, 0x75, 0x63, 0xd5, 0xdc, 0xb7, 0x7a, 0xeb, 0xa6, 0xaa, 0xda, 0x58, 0xa7, 0x4d, 0xcb, 0x10,
+	0xa5, 0x5c, 0x23, 0xaa, 0x89, 0xe2, 0xd1, 0xca, 0x35, 0x6b, 0xe0, 0xe3, 0x2d, 0xb7, 0x9a, 0x51,
+	0x4d, 0x83, 0xd4, 0x46, 0x89, 0xff, 0x23, 0xcb, 0xef, 0x50, 0x9c, 0x17, 0x3a, 0x1f, 0xc3, 0x55,
+	0x6a, 0x39, 0x50, 0xf0, 0xfb, 0xe7, 0xe0, 0xb9, 0xff, 0x02, 0xcb, 0x77, 0xf9, 0x42, 0x4c, 0x35,
+	0xf8, 0xce, 0x46, 0x66, 0x98, 0x56, 0xd5, 0xfe, 0x0c, 0xd6, 0x6f, 0x26, 0x34, 0x7f, 0xe0, 0x5f,
+	0xc0, 0x78, 0xa1, 0xe5, 0x99, 0xe0, 0x1c, 0xe1, 0x36, 0xd5, 0x08, 0x58, 0x27, 0xb4, 0xb4, 0x97,
+	0x1e, 0xfc, 0x1a, 0x30, 0xea, 0xb4, 0xdd, 0x1a, 0x37, 0x98, 0xe8, 0x4c, 0x35, 0xa3, 0xc6, 0x4d,
+	0x8e, 0xfc, 0x6f, 0xf0, 0xfe, 0xf8, 0xca, 0x23, 0x46, 0x97, 0x6b, 0xbb, 0xcb, 0x9c, 0x61, 0x65,
+	0xa9, 0x2c, 0x95, 0xa5, 0xb2, 0x54, 0x96, 0xca, 0x52, 0x59, 0x2a, 0x4b, 0x0f, 0x5a, 0xfa, 0x5a,
+	0x0a, 0x9a, 0x69, 0x26, 0x4d, 0x90, 0x4d, 0xd4, 0x47, 0xdc, 0xd3, 0x74, 0x48, 0x29, 0x6a, 0x13,
+	0x3b, 0xcd, 0x66, 0xa6, 0x75, 0xb8, 0xab, 0x2a, 0xd0, 0x58, 0x8d, 0x90, 0xc6, 0xbd, 0xa3, 0x14,
+	0x06, 0x07, 0x55, 0xe0, 0x0e, 0x21, 0x93, 0x4c, 0x5f, 0xba, 0xce, 0x55, 0x30, 0xd2, 0x09, 0xbe,
+	0xc1, 0x68, 0x94, 0x9d, 0x5d, 0xed, 0x12, 0x4c, 0xcb, 0x5c, 0x57, 0x3c, 0x6b, 0x3a, 0x4f, 0xe7,
+	0xbd, 0x5d, 0xe5, 0xd8, 0x1e, 0xb9, 0xe0, 0x59, 0x26, 0x53, 0x0d, 0x79, 0x5e, 0x2f, 0x9e, 0x49,
+	0x3f, 0x39, 0xd7, 0xa8, 0x94, 0x6f, 0x1c, 0x9d, 0xc9, 0xe5, 0x10, 0xf7, 0xdb, 0x15, 0x69, 0x99,
+	0xd9, 0x6c, 0x06, 0x5a, 0x8a, 0xff, 0x76, 0x47, 0x92, 0xf4, 0x13, 0x33, 0x35, 0x73, 0x51, 0x9b,
+	0x14, 0x96, 0xe8, 0x80, 0x25, 0x45, 0xb0, 0x2c, 0xa9, 0x40, 0xd8, 0xe5, 0x61, 0xdb, 0x84, 0x49,
+	0xd2, 0xf9, 0x4e, 0xdc, 0x52, 0xa1, 0x0e, 0xdc, 0x11, 0xe3, 0x8a, 0x96, 0xbb, 0x72, 0x79, 0x8b,
+	0x79, 0xcb, 0xa3, 0x50, 0xc8, 0x2c, 0x07, 0x3e, 0x93, 0x8a, 0x95, 0xe6, 0x2a, 0x9f, 0xb3, 0x60,
+	0x26, 0x9f, 0x6e, 0x34, 0xb0, 0xc7, 0x5c, 0xec, 0x2a, 0x78, 0x1f, 0x5c, 0xce, 0xfd, 0xee, 0x70,
+	0x9a, 0xcd, 0x36, 0x20, 0xb3, 0x8d, 0x42, 0x76, 0x02, 0x39, 0xec, 0x8a, 0x50, 0x39, 0x34, 0x28,
+	0xce, 0x43, 0x1d, 0xc8, 0x2d, 0x2d, 0xff, 0x62, 0xd8, 0x4e, 0x15, 0xb1, 0x67, 0x16, 0x2e, 0xdf,
+	0x70, 0xe9, 0xfb, 0x0d, 0x66, 0xe4, 0xd4, 0xa1, 0x27, 0x35, 0x81, 0x3b, 0x1a, 0xfe, 0x08, 0x14,
+	0x4b, 0x15, 0x60, 0x0a, 0xb6, 0xd0, 0x1f, 0x8c, 0xbb, 0x61, 0x4f, 0x50, 0xf0, 0x0f, 0x43, 0x66,
+	0x88, 0xba, 0xe0, 0x79, 0xd4, 0xf2, 0x27, 0x24, 0xbf, 0xdb, 0xc0, 0x5c, 0x17, 0xbf, 0xf0, 0x9c,
+	0xfe, 0xed, 0x8e, 0x32, 0x33, 0x2c, 0x95, 0x03, 0x3a, 0xee, 0xc0, 0xed, 0xe6, 0x9c, 0xbf, 0xa2,
+	0xf7, 0x36, 0x50, 0x5a, 0xfe, 0x10, 0x2b, 0x06, 0x90, 0x47, 0x1c, 0xce, 0x1a, 0xf4, 0x72, 0xf3,
+	0x66, 0xa1, 0x26, 0x37, 0x4c, 0xc1, 0x17, 0xd4, 0x96, 0xa0, 0x09, 0xdc, 0xd1, 0xf0, 0x93, 0x73,
+	0x34, 0x3a, 0xe7, 0x00, 0x5e, 0x93, 0xc4, 0x16, 0xb7, 0x90, 0xdc, 0x65, 0x92, 0x8b, 0xdf, 0x27,
+	0x11, 0x93, 0x34, 0x05, 0x5f, 0xc0, 0xb3, 0x7c, 0x2e, 0x8a, 0x64, 0xec, 0x57, 0xf1, 0x13, 0x52,
+	0x39, 0x97, 0x86, 0x5d, 0x70, 0xd9, 0x67, 0x1f, 0x96, 0xfe, 0x9b, 0xf9, 0xdb, 0x21, 0x4d, 0xf8,
+	0xfb, 0xc7, 0xa5, 0xf6, 0xf4, 0x72, 0x34, 0x12, 0x8f, 0x2f, 0xb1, 0xdb, 0xb4, 0x81, 0x3b, 0x5a,
+	0xfe, 0xf9, 0xf8, 0x4e, 0x7c, 0x4b, 0x36, 0x27, 0xad, 0x2e, 0x7e, 0x7b, 0x36, 0x54, 0x22, 0x0a,
+	0xfe, 0x67, 0x70, 0x2b, 0x54, 0x5d, 0x6e, 0x0b, 0x58, 0xb8, 0x0d, 0xee, 0x75, 0xcc, 0x2b, 0x2a,
+	0xf4, 0x53, 0xf3, 0x93, 0xf5, 0x98, 0xa2, 0x92, 0xfb, 0xb3, 0x48, 0x9a, 0x7b, 0xe2, 0xd7, 0xe9,
+	0xd0, 0x5c, 0xfc, 0x8f, 0xe3, 0x6f, 0xd7, 0xb9, 0xee, 0xc8, 0x90, 0x8e, 0x0d, 0x61, 0x97, 0x0c,
+	0xf8, 0x9a, 0xc0, 0x1d, 0x5f, 0xa3, 0x71, 0x01, 0xd6, 0x88, 0xb1, 0x45, 0xc1, 0xfc, 0xe6, 0x14,
+	0x83, 0x68, 0x71, 0x3b, 0xc5, 0xee, 0x17, 0x7f, 0x76, 0xf1, 0xfb, 0x24, 0x60, 0xb2, 0xe6, 0x29,
+	0xa7, 0xb1, 0x48, 0x21, 0x21, 0xfd, 0x88, 0xc1, 0x47, 0xd0, 0x46, 0xc3, 0xff, 0x2d, 0x66, 0xab,
+	0xe4, 0x3a, 0xcc, 0x83, 0x72, 0x0f, 0xfc, 0x77, 0xe8, 0xd0, 0xba, 0xa9, 0xf9, 0x2f, 0x48, 0x47,
+	0xee, 0x26, 0xd3, 0xf8, 0xb9, 0x8c, 0xb2, 0xbd, 0x96, 0x59, 0x91, 0xfc, 0x4c, 0x88, 0x14, 0xbd,
+	0x20, 0xb3, 0x15, 0x0f, 0xe2, 0xe2, 0x1f, 0x8a, 0x2c, 0x6d, 0xb0, 0x66, 0x1c, 0x5e, 0xe6, 0xff,
+	0x26, 0xa1, 0xee, 0x42, 0x8c, 0xd3, 0xf0, 0xef, 0xc2, 0xeb, 0x2a, 0x99, 0x7b, 0x14, 0xef, 0x81,
+	0xff, 0x0e, 0x1d, 0x9a, 0x86, 0x5f, 0x5d, 0xac, 0xc6, 0xcf, 0x59, 0x35, 0x2e, 0x2e, 0x15, 0xb7,
+	0xe2, 0x84, 0x34, 0x88, 0xdd, 0xb0, 0x46, 0xa8, 0xaf, 0x86, 0x14, 0x74, 0xd2, 0xe3, 0x37, 0x9c,
+	0xc1, 0x54, 0x12, 0x1c, 0xac, 0x8c, 0x84, 0xaa, 0xe3, 0xb4, 0x57, 0x63, 0xff, 0x56, 0x72, 0x66,
+	0x90, 0xe1, 0xb2, 0x57, 0x95, 0x15, 0xdc, 0xc6, 0x61, 0xaf, 0x73, 0x9f, 0xf9, 0xbd, 0x76, 0x68,
+	0x1d, 0x12, 0x12, 0xae, 0xc0, 0x92, 0x20, 0xa4, 0x6e, 0x25, 0xe1, 0x77, 0x6b, 0xff, 0x42, 0xc3,
+	0x38, 0x40, 0x1e, 0xc6, 0x2d, 0x5f, 0x3d, 0xfe, 0x21, 0xc8, 0x0e, 0x0b, 0x04, 0xaa, 0xa9, 0x4c,
+	0x93, 0x07, 0xf8, 0xbf, 0x7d, 0xb0, 0x8d, 0x34, 0x66, 0xd5, 0x4d, 0x2c, 0x38, 0xa5, 0x77, 0xef,
+	0xc1, 0xb3, 0x6f, 0x33, 0x07, 0x92, 0x1e, 0xff, 0x88, 0x41, 0x62, 0xaa, 0x71, 0xb7, 0xfc, 0x5e,
+	0x3b, 0xb4, 0xee, 0x72, 0x85, 0x1e, 0xa4, 0xad, 0xff, 0xe5, 0xe8, 0xc0, 0xa6, 0x0e, 0xdc, 0x71,
+	0xe3, 0xaf, 0x6c, 0xb7, 0x55, 0x78, 0x4f, 0xed, 0x1b, 0xe7, 0xfc, 0x86, 0x53, 0x98, 0x46, 0x34,
+	0xfc, 0x7b, 0xf0, 0xb6, 0xac, 0xfd, 0x60, 0x16, 0x31, 0xe4, 0x3a, 0x2b, 0x73, 0x5e, 0x9a, 0x66,
+	0x12, 0x8f, 0xfc, 0x34, 0x0d, 0xbc, 0x5b, 0x7e, 0xaf, 0x1d, 0x5a, 0x60, 0xcd, 0x9a, 0x43, 0x71,
+	0xbe, 0x92, 0x90, 0x02, 0x58, 0xb1, 0x59, 0xd2, 0xb1, 0x09, 0x6c, 0xec, 0x7b, 0xa9, 0x03, 0x77,
+	0xdc, 0xf8, 0xc9, 0x41, 0x3c, 0xbd, 0x5b, 0x1e, 0xd2, 0x54, 0xfc, 0x4f, 0x21, 0x3b, 0x5c, 0xc3,
+	0x5f, 0xc9, 0x86, 0x06, 0xfc, 0xff, 0x9d, 0xc2, 0xb0, 0x2b, 0xbc, 0x8f, 0xbe, 0x9c, 0x37, 0x77,
+	0xf9, 0xf2, 0x95, 0x87, 0x1d, 0xf6, 0xd9, 0x1e, 0xf9, 0x97, 0x7f, 0x2d, 0xa6, 0x56, 0x77, 0xcb,
+	0xef, 0xb5, 0x43, 0x73, 0x6f, 0xff, 0x34, 0x97, 0x09, 0xcc, 0xfd, 0xaf, 0x0d, 0xdc, 0x71, 0xe7,
+	0xff, 0x00, 0x6b, 0x2d, 0xc5, 0x15, 0x74, 0xf8, 0x0d, 0xf1, 0x98, 0x41, 0x34, 0xfc, 0xa3, 0x5d,
+	0xfe, 0x7f, 0x9f, 0x1c, 0xd4, 0x24, 0x64, 0x2e, 0x8f, 0x37, 0x63, 0x8f, 0xdd, 0x3a, 0x19, 0x13,
+	0xef, 0x77, 0xff, 0x77, 0x87, 0x06, 0xad, 0xe1, 0x2f, 0xd8, 0x1b, 0x26, 0xb9, 0x85, 0x3f, 0x63,
+	0x6a, 0xb7, 0x3a, 0x70, 0xc7, 0x9d, 0xbf, 0x05, 0x1c, 0xf8, 0x83, 0xe8, 0xf0, 0x0f, 0x44, 0x51,
+	0x87, 0x66, 0xcd, 0x5a, 0x01, 0x8f, 0xc9, 0x9f, 0x9c, 0x6c, 0x94, 0xeb, 0x37, 0x69, 0x8e, 0x9b,
+	0x61, 0x61, 0x61, 0xcf, 0x63, 0x97, 0xfa, 0x7b, 0xf7, 0x40, 0x8a, 0xdf, 0x7f, 0x94, 0x3f, 0x69,
+	0x45, 0xb6, 0xe8, 0x16, 0x4e, 0xad, 0xca, 0x35, 0x7c, 0x4d, 0xe0, 0x8e, 0x96, 0x9f, 0x5c, 0x01,
+	0x73, 0xa1, 0x6b, 0xf8, 0xa7, 0xb9, 0xfb, 0x36, 0x83, 0x0b, 0x21, 0x57, 0xdf, 0x17, 0xd9, 0xc9,
+	0x5c, 0x1f, 0x15, 0xbf, 0x21, 0x87, 0xf6, 0x57, 0x77, 0xcf, 0x9f, 0x87, 0x16, 0xca, 0x0a, 0xdf,
+	0x0f, 0xa7, 0x4b, 0xd6, 0xa1, 0x69, 0xf9, 0x83, 0x56, 0x08, 0xd3, 0x90, 0xfd, 0xb2, 0x97, 0x4c,
+	0x1b, 0xb8, 0xe3, 0xc6, 0xff, 0x25, 0x68, 0xd0, 0x86, 0x96, 0x7f, 0xc4, 0xef, 0x62, 0xda, 0x0b,
+	0x1c, 0x90, 0xa7, 0x83, 0x4f, 0xb2, 0xb8, 0x16, 0x31, 0x2d, 0x45, 0xba, 0x18, 0x3e, 0x68, 0x45,
+	0x73, 0x15, 0x3f, 0xb9, 0x46, 0xc7, 0x52, 0x2e, 0xd7, 0x86, 0xc3, 0xcf, 0x3b, 0xff, 0xe7, 0x87,
+	0x25, 0xaf, 0xb2, 0xbf, 0x1d, 0xd2, 0xc8, 0xd9, 0x96, 0xc5, 0x8a, 0x0d, 0xc7, 0xc1, 0x92, 0x75,
+	0x68, 0xee, 0xe3, 0x7f, 0x85, 0x56, 0xd5, 0x15, 0xf9, 0x4b, 0x81, 0x3b, 0x2e, 0xfe, 0x69, 0x52,
+	0x80, 0xc4, 0xa0, 0x75, 0x13, 0xf9, 0xf9, 0x31, 0x2c, 0x42, 0x48, 0x47, 0xff, 0x21, 0x9a, 0xf6,
+	0xbf, 0x02, 0x0b, 0xe4, 0xff, 0x4f, 0xa3, 0x0f, 0xed, 0x05, 0x5f, 0x54, 0xf1, 0x07, 0x99, 0x11,
+	0xa1, 0x94, 0x7b, 0xd1, 0xc8, 0x68, 0x2f, 0xfc, 0x4b, 0x69, 0x84, 0x46, 0x57, 0xe4, 0x48, 0x2f,
+	0xaa, 0x82, 0x0d, 0x52, 0x3c, 0xd9, 0x77, 0xf4, 0x67, 0x4f, 0x1d, 0xda, 0x0f, 0xde, 0xf5, 0x1f,
+	0xcf, 0xd3, 0x85, 0x57, 0xa5, 0x11, 0xfc, 0x9f, 0x90, 0xad, 0x00, 0x3f, 0xb0, 0x60, 0xcd, 0x3b,
+	0xf3, 0xfb, 0x65, 0xe1, 0x31, 0xfe, 0x7f, 0x98, 0x1d, 0x52, 0x0b, 0x9b, 0xcd, 0xe2, 0x4b, 0x78,
+	0xc1, 0xaf, 0xe3, 0x86, 0x8f, 0x42, 0x36, 0x6c, 0xc3, 0x8a, 0x3b, 0xf0, 0x3f, 0x01, 0xab, 0x30,
+	0x65, 0xaa, 0x74, 0x9c, 0xaf, 0x54, 0xd9, 0x81, 0x3d, 0xc2, 0x94, 0xb3, 0xbb, 0x05, 0x31, 0x5e,
+	0x3a, 0xb4, 0x01, 0x59, 0xa5, 0xe5, 0x6f, 0x01, 0x5b, 0x2b, 0x52, 0x2d, 0x43, 0x1e, 0xf2, 0x7c,
+	0xd2, 0xd5, 0xa1, 0xde, 0x5e, 0xf8, 0xbb, 0x21, 0x5d, 0x8e, 0x18, 0x88, 0xc1, 0x55, 0x36, 0x48,
+	0x9e, 0x56, 0x14, 0x5c, 0xfe, 0x9d, 0x22, 0x66, 0x2f, 0xa0, 0xf2, 0x43, 0xab, 0x61, 0x89, 0xba,
+	0xd3, 0xfc, 0x67, 0x3d, 0x9c, 0xf1, 0x3b, 0xf3, 0x90, 0xc9, 0xc2, 0x62, 0x9a, 0xe4, 0x22, 0x7b,
+	0xc7, 0x31, 0x27, 0x56, 0x7b, 0xe9, 0xd0, 0xe2, 0x14, 0x1d, 0xda, 0x5d, 0xf2, 0x0b, 0xc5, 0x15,
+	0xec, 0xca, 0xc4, 0xd9, 0x00, 0x79, 0xfa, 0x98, 0x1f, 0x58, 0x42, 0xfe, 0x45, 0x6c, 0x2e, 0x4b,
+	0xc7, 0xe1, 0xf5, 0xac, 0x7d, 0xdb, 0xc3, 0x68, 0xc1, 0xb6, 0xd4, 0xd4, 0x4c, 0xbb, 0x30, 0xca,
+	0x1b, 0x88, 0x2c, 0xe7, 0x00, 0xe6, 0x51, 0xb2, 0xfd, 0x23, 0x4d, 0x15, 0x29, 0xa3, 0x68, 0xa0,
+	0xf3, 0xf3, 0x00, 0xc7, 0x8e, 0x87, 0xe4, 0x11, 0x69, 0xaf, 0x13, 0xc8, 0x9e, 0xe5, 0x5b, 0xc2,
+	0x0e, 0xed, 0x6e, 0xf9, 0x43, 0xd7, 0x3b, 0x80, 0xa3, 0xf5, 0x5d, 0x6a, 0xdc, 0x46, 0x52, 0x32,
+	0x7e, 0xc3, 0x75, 0xb8, 0x96, 0xb5, 0x6d, 0xe6, 0x8a, 0x6e, 0x1a, 0xaf, 0xa7, 0x42, 0xb2, 0x65,
+	0xfc, 0xda, 0x9f, 0x28, 0xf4, 0xc1, 0xdb, 0x17, 0xfe, 0xc9, 0xbb, 0xd6, 0x50, 0xf7, 0xd1, 0xc4,
+	0x95, 0x82, 0x9a, 0x45, 0x56, 0x56, 0xca, 0x55, 0x22, 0x1b, 0xab, 0xbe, 0x89, 0x4e, 0x87, 0xe6,
+	0x4a, 0x2a, 0xfe, 0x0e, 0x89, 0x5b, 0x75, 0xf9, 0xbb, 0x24, 0x2a, 0x28, 0xab, 0x46, 0x29, 0xe2,
+	0x2f, 0x57, 0x27, 0x0e, 0x2b, 0xb3, 0xbf, 0x96, 0xa5, 0xb2, 0x54, 0x96, 0xfe, 0x33, 0x69, 0xb4,
+	0xca, 0x31, 0xa0, 0x71, 0x7f, 0xdc, 0xe4, 0x27, 0x67, 0x88, 0xd2, 0x61, 0x93, 0x18, 0xf2, 0x4f,
+	0xfe, 0xc7, 0xb4, 0xdb, 0x40, 0xef, 0x5c, 0xaf, 0xc8, 0xe7, 0x67, 0xd3, 0x0d, 0xc9, 0xf4, 0xfc,
+	0x92, 0x89, 0x5e, 0xd5, 0xd5, 0x64, 0x9a, 0xa4, 0xc8, 0xe9, 0xb0, 0x98, 0xcb, 0x95, 0xed, 0x23,
+	0x0d, 0x0a, 0xff, 0x84, 0xe9, 0xca, 0xe6, 0xde, 0xec, 0xee, 0x57, 0x64, 0xff, 0x84, 0x14, 0x2f,
+	0xbc, 0xd6, 0x34, 0x9e, 0xfe, 0x7e, 0xd6, 0x24, 0x05, 0xf8, 0x56, 0x36, 0x65, 0xb3, 0xd0, 0xc1,
+	0xf1, 0xa6, 0x6f, 0xc5, 0xc3, 0xfb, 0x26, 0xea, 0x39, 0x88, 0x36, 0xa5, 0x49, 0x5d, 0xf7, 0x17,
+	0x26, 0xaa, 0x07, 0x55, 0xbb, 0x65, 0x6a, 0xa2, 0xe3, 0x2e, 0xf1, 0xe4, 0xc6, 0x11, 0xd2, 0x58,
+	0x38, 0x14, 0x8e, 0x01, 0xcd, 0xf4, 0xc7, 0x64, 0x36, 0x5b, 0x45, 0x4f, 0x82, 0x79, 0x96, 0x28,
+	0x25, 0x4a, 0x63, 0x4d, 0xa4, 0xcd, 0xd9, 0x91, 0xdd, 0x19, 0xab, 0xc8, 0x67, 0x33, 0xa8, 0x76,
+	0xf6, 0x0b, 0xe4, 0x11, 0xe9, 0x8c, 0x22, 0xa7, 0x44, 0x58, 0x25, 0x87, 0xc4, 0x3a, 0x5f, 0x97,
+	0x7f, 0x42, 0x94, 0x3f, 0x64, 0xc6, 0x5c, 0x33, 0x2f, 0xa9, 0x40, 0x14, 0xff, 0xc1, 0xac, 0xfc,
+	0x35, 0xe0, 0x90, 0x1c, 0x04, 0x06, 0x33, 0x98, 0xe1, 0xe6, 0x33, 0xcc, 0x91, 0x4e, 0x58, 0xe8,
+	0xc2, 0xda, 0x75, 0x4c, 0xbf, 0xeb, 0x82, 0x02, 0xc9, 0x51, 0x30, 0x11, 0x27, 0x54, 0xee, 0x12,
+	0xbb, 0x77, 0x33, 0xb6, 0x1b, 0x85, 0x86, 0x9f, 0xa8, 0x02, 0xc0, 0x24, 0x7e, 0xc3, 0x01, 0xae,
+	0x29, 0xba, 0xf1, 0x8b, 0x2c, 0xbe, 0x26, 0x17, 0xbf, 0x34, 0x37, 0x91, 0xf9, 0x85, 0xc1, 0x3b,
+	0x6c, 0x6c, 0x91, 0x6a, 0x7e, 0x1e, 0x3e, 0xd9, 0xe1, 0x74, 0x05, 0x70, 0x2b, 0x4a, 0x7a, 0x82,
+	0x05, 0x7e, 0xf7, 0x67, 0x6a, 0x37, 0x49, 0xa2, 0xb3, 0x33, 0x71, 0x81, 0xed, 0xeb, 0x4c, 0x6d,
+	0x16, 0xb5, 0x84, 0xda, 0xc5, 0x68, 0x4d, 0x95, 0x83, 0x4b, 0x18, 0x29, 0x1e, 0x4f, 0x60, 0xbc,
+	0x12, 0xce, 0xe7, 0x6f, 0xaa, 0x5d, 0xdf, 0x47, 0xfe, 0x11, 0xc8, 0xa9, 0xae, 0xcf, 0x5f, 0x2c,
+	0xae, 0x36, 0x68, 0x8f, 0x62, 0xce, 0x6f, 0x96, 0x5e, 0x88, 0x92, 0x5f, 0x5c, 0xe9, 0x7a, 0x5d,
+	0x55, 0xce, 0x3f, 0x15, 0xea, 0x8f, 0xa2, 0xa4, 0x0a, 0x0e, 0xa7, 0xa4, 0xae, 0x7e, 0xc8, 0x67,
+	0x8b, 0xbb, 0xd1, 0x85, 0xfe, 0xf3, 0x2b, 0xfa, 0x49, 0xc7, 0x48, 0x88, 0xb1, 0xfd, 0x9f, 0xf0,
+	0xe5, 0x36, 0x42, 0x8d, 0xd9, 0x25, 0x69, 0xd7, 0xd6, 0x2a, 0x4a, 0xb8, 0xa7, 0x40, 0xd7, 0x7a,
+	0xdc, 0x3f, 0xfe, 0xb0, 0x54, 0x79, 0x8d, 0x9b, 0x96, 0xff, 0x4f, 0x5b, 0xb8, 0xa8, 0x98, 0x1e,
+	0xe1, 0xfc, 0xdb, 0x6d, 0x67, 0xdd, 0xf8, 0x83, 0x8b, 0xf1, 0x90, 0xb2, 0x9c, 0x68, 0xb6, 0x3e,
+	0x40, 0x53, 0x12, 0xf9, 0x9b, 0x2e, 0x59, 0xdb, 0x86, 0xb1, 0x54, 0xfe, 0x1e, 0x2c, 0x1e, 0xf1,
+	0x00, 0x37, 0x01, 0xec, 0xc1, 0x2c, 0x12, 0x94, 0x29, 0xdb, 0xf3, 0xea, 0x3b, 0xec, 0xb5, 0x44,
+	0x7b, 0xd0, 0x06, 0x15, 0xdc, 0x31, 0xb6, 0xd2, 0xed, 0xfe, 0xf1, 0xcf, 0xc3, 0x19, 0x3f, 0x0f,
+	0xfc, 0x9f, 0x8a, 0x0f, 0xf3, 0xc7, 0xd5, 0x75, 0x9c, 0x7f, 0xc3, 0x4e, 0xf1, 0x59, 0xd5, 0xfc,
+	0xe4, 0xba, 0x7a, 0x7e, 0x5e, 0x13, 0x4e, 0x3f, 0x3d, 0xfe, 0xe5, 0xd4, 0xf3, 0x91, 0x4e, 0x57,
+	0x93, 0x88, 0x6a, 0xf2, 0x58, 0x62, 0x1c, 0x26, 0x68, 0xb7, 0x67, 0xc1, 0x8c, 0x65, 0x03, 0x90,
+	0x1e, 0xf8, 0x02, 0x2e, 0xca, 0x33, 0xa2, 0xbd, 0x98, 0x44, 0x7c, 0x6f, 0x60, 0x80, 0x92, 0xad,
+	0x27, 0x1c, 0x4d, 0x88, 0xc2, 0x8d, 0xd3, 0xda, 0xe7, 0x5e, 0xf9, 0x9b, 0x5a, 0x5d, 0x0d, 0x56,
+	0xcb, 0xdf, 0xdf, 0xf6, 0x25, 0x09, 0xb1, 0x2c, 0xdb, 0xc4, 0xf9, 0x77, 0xbc, 0x28, 0x2e, 0x7e,
+	0xd7, 0xf0, 0xa7, 0xd0, 0xb5, 0x19, 0x2e, 0xfb, 0x44, 0xb1, 0x41, 0x8f, 0x7f, 0x2c, 0x7e, 0x21,
+	0xe2, 0x82, 0xf5, 0x3c, 0xa6, 0x6a, 0xbf, 0x84, 0x29, 0xe4, 0x45, 0xe4, 0x12, 0x92, 0x91, 0xcf,
+	0x9b, 0x76, 0x12, 0x46, 0x29, 0x5b, 0xfb, 0x68, 0x24, 0x90, 0x1e, 0x48, 0x57, 0x05, 0xbf, 0xef,
+	0xc5, 0xbf, 0x64, 0x2c, 0xc9, 0x8d, 0x73, 0x22, 0xe2, 0x1e, 0xf9, 0x77, 0xb1, 0x79, 0xa1, 0x1e,
+	0x7f, 0xcc, 0x91, 0x73, 0xa4, 0x37, 0x9e, 0x89, 0xe5, 0xfc, 0x07, 0x2b, 0x5a, 0x2f, 0x68, 0xf9,
+	0x2b, 0x3a, 0x50, 0x4b, 0x59, 0x4e, 0x4f, 0xdc, 0xd0, 0xad, 0xff, 0xad, 0x70, 0x4d, 0xf8, 0x3b,
+	0x18, 0xbf, 0xcb, 0x1d, 0xe2, 0x02, 0xd1, 0xf5, 0x52, 0xd1, 0x60, 0x4b, 0xe4, 0x97, 0x8c, 0x43,
+	0x1a, 0x72, 0x5c, 0xee, 0xc1, 0x90, 0x7c, 0x44, 0xad, 0xc4, 0xe7, 0x4a, 0xb4, 0x8e, 0x70, 0x46,
+	0xc9, 0x58, 0x1b, 0xae, 0xaf, 0xd8, 0x6a, 0x43, 0x52, 0xa0, 0x3b, 0xff, 0x09, 0x85, 0x63, 0xa0,
+	0x3b, 0x6e, 0x74, 0x13, 0xd3, 0x64, 0x7d, 0xfe, 0xaf, 0x90, 0x6f, 0xf4, 0xc8, 0xdf, 0xeb, 0x23,
+	0xd4, 0xfe, 0xdc, 0x51, 0x65, 0x0f, 0xe7, 0x3f, 0x46, 0xb6, 0xa0, 0x0d, 0xe9, 0xa3, 0xe2, 0x9f,
+	0xc3, 0x72, 0xe3, 0xfc, 0x1b, 0xf9, 0x02, 0x69, 0x0d, 0xbf, 0x6f, 0xbe, 0x38, 0xef, 0x9b, 0xc3,
+	0x76, 0x4f, 0x20, 0xa4, 0xa9, 0x30, 0xce, 0xad, 0x04, 0xa2, 0x2a, 0xba, 0xca, 0x0c, 0x31, 0xb1,
+	0x25, 0xfa, 0x84, 0x77, 0x11, 0xcb, 0x0a, 0xa0, 0x32, 0x6f, 0x6f, 0x96, 0x2f, 0x16, 0x3a, 0xe3,
+	0xad, 0xc2, 0x8c, 0xbb, 0x43, 0x11, 0x46, 0xb9, 0xf3, 0x2b, 0x1d, 0x03, 0xdd, 0xdd, 0xe6, 0x89,
+	0x2a, 0x7e, 0x3b, 0xae, 0xfb, 0x7b, 0xe4, 0x1f, 0xd0, 0x05, 0x63, 0x4e, 0x9f, 0x20, 0x87, 0x38,
+	0xff, 0x29, 0x32, 0x12, 0xf3, 0x84, 0x2f, 0xc7, 0xf8, 0x5f, 0x8a, 0x88, 0x68, 0xf7, 0x85, 0x93,
+	0x6e, 0x78, 0x21, 0x9c, 0xbd, 0x12, 0x11, 0x11, 0xd1, 0x69, 0x05, 0x8a, 0x5a, 0xeb, 0xf2, 0x0b,
+	0xdd, 0x5b, 0x1f, 0xd1, 0x9b, 0xc7, 0x9b, 0x73, 0x08, 0xb6, 0x90, 0x03, 0x26, 0x3c, 0xd5, 0x48,
+	0xf1, 0xbe, 0x3e, 0x83, 0xad, 0x9e, 0xe2, 0x01, 0xba, 0xc2, 0xc9, 0x06, 0x7f, 0x96, 0x1e, 0x76,
+	0xa2, 0xb3, 0x6b, 0x3a, 0xdc, 0x88, 0xba, 0x6d, 0x56, 0xba, 0xf3, 0x27, 0x2b, 0x1c, 0x03, 0xdd,
+	0x91, 0xf7, 0x93, 0x98, 0xfe, 0xd0, 0xe7, 0x57, 0xc5, 0xbf, 0x6b, 0xf9, 0x07, 0x07, 0x14, 0xfc,
+	0xee, 0xfc, 0x8c, 0x1c, 0xe5, 0xfc, 0x89, 0x24, 0xcc, 0x7c, 0xcd, 0x10, 0xc3, 0xf9, 0xa5, 0xe4,
+	0xfc, 0x48, 0xed, 0xaf, 0x29, 0x1a, 0x4c, 0xf4, 0xf9, 0x67, 0x63, 0x06, 0x31, 0x64, 0x83, 0x87,
+	0xcd, 0x90, 0xac, 0x23, 0x24, 0x79, 0x1d, 0xde, 0xee, 0x40, 0x57, 0xa5, 0x48, 0xe9, 0x13, 0x58,
+	0x94, 0xf3, 0x72, 0xc3, 0x65, 0xd5, 0xf2, 0x6b, 0x71, 0xf5, 0xd7, 0x41, 0xad, 0x5f, 0x7a, 0x04,
+	0x5b, 0x11, 0x58, 0xda, 0xf6, 0x8f, 0xb5, 0xb8, 0xec, 0xe7, 0x89, 0xff, 0x19, 0xb2, 0x15, 0xc2,
+	0xb0, 0x75, 0x9c, 0xf3, 0x9f, 0x23, 0x64, 0x03, 0x3a, 0x3d, 0xc6, 0xf9, 0xcf, 0xec, 0xdf, 0xbf,
+	0x75, 0xa1, 0xcb, 0x5f, 0x6d, 0xde, 0xbf, 0x3f, 0x17, 0x3b, 0x94, 0x6b, 0xb1, 0x54, 0xfc, 0x03,
+	0xf0, 0x1b, 0x69, 0xa8, 0x30, 0x8d, 0xc6, 0x5f, 0xf0, 0xb7, 0x4f, 0x4e, 0x5f, 0xd4, 0x1f, 0xa3,
+	0xf9, 0x2f, 0xe5, 0x6e, 0x01, 0xb3, 0x94, 0x24, 0xff, 0x50, 0x0f, 0xfe, 0x0d, 0xed, 0xe8, 0xab,
+	0xf5, 0x4b, 0x33, 0xab, 0x76, 0xa9, 0xf9, 0xd7, 0x05, 0x26, 0xe3, 0x79, 0x4f, 0xfc, 0x23, 0xc8,
+	0x5b, 0x30, 0x07, 0x91, 0x78, 0xce, 0x9f, 0x24, 0x06, 0x30, 0x2c, 0x6a, 0xa7, 0xee, 0xff, 0x95,
+	0xe5, 0xbc, 0x87, 0x04, 0x1f, 0x4f, 0xfc, 0xd5, 0x90, 0x4a, 0x9e, 0x55, 0xac, 0x6e, 0xfc, 0xcd,
+	0xd4, 0x10, 0x43, 0x0e, 0xfd, 0xf6, 0x3c, 0xba, 0xb9, 0x8a, 0xcf, 0x66, 0xcb, 0x06, 0xf5, 0xee,
+	0x17, 0x57, 0x41, 0xc6, 0x1b, 0x3c, 0x63, 0x95, 0x8e, 0xbf, 0x07, 0x79, 0x03, 0x17, 0x7c, 0x3d,
+	0xf0, 0x3f, 0x2f, 0xa8, 0x5f, 0x82, 0x12, 0x76, 0x46, 0xc1, 0x1f, 0x7c, 0xfb, 0xe6, 0xc3, 0x9e,
+	0xf9, 0x43, 0xb3, 0x54, 0x0b, 0xd1, 0xd5, 0xcf, 0x7f, 0x09, 0xc6, 0x05, 0x78, 0x53, 0x16, 0xbf,
+	0x72, 0x3c, 0x81, 0xc8, 0x15, 0xa7, 0xdf, 0x01, 0xdf, 0x17, 0xc2, 0x90, 0x88, 0xb1, 0x89, 0xaa,
+	0xd5, 0x28, 0xea, 0xfb, 0x8d, 0x16, 0xa1, 0x42, 0xde, 0x6f, 0xfe, 0x18, 0x12, 0x94, 0x42, 0x15,
+	0x6d, 0x1d, 0xfe, 0x97, 0x85, 0x41, 0xd9, 0x20, 0x6a, 0x28, 0x2e, 0x7e, 0xb2, 0x06, 0x2f, 0x78,
+	0xe6, 0x27, 0xd3, 0x71, 0xc2, 0xe0, 0xe9, 0xf9, 0x57, 0x63, 0xe0, 0x41, 0xb4, 0x55, 0x58, 0x05,
+	0x27, 0x3b, 0x43, 0xa7, 0xe5, 0xcd, 0x71, 0x06, 0xca, 0x57, 0x67, 0x95, 0x7b, 0x15, 0x09, 0x1e,
+	0xef, 0xff, 0x1c, 0x49, 0xbe, 0xff, 0x06, 0x7e, 0x32, 0x01, 0xe7, 0x7c, 0xf4, 0xf9, 0x5f, 0xe3,
+	0x53, 0x15, 0x05, 0xff, 0x93, 0xd8, 0xe0, 0x85, 0xbf, 0x42, 0x2e, 0xfa, 0x7a, 0x7a, 0xfe, 0xf1,
+	0x98, 0x5d, 0x68, 0x76, 0x0d, 0x36, 0xcf, 0x61, 0xfd, 0x4d, 0xa1, 0x41, 0xac, 0x4f, 0xe3, 0x3f,
+	0xc4, 0x62, 0xae, 0x38, 0x04, 0xf6, 0xf4, 0x70, 0x7f, 0xe5, 0x02, 0x65, 0xdd, 0xb8, 0x8f, 0xfc,
+	0xe5, 0x6e, 0xb2, 0x21, 0xcc, 0x8d, 0x9f, 0xc5, 0xa2, 0x5c, 0x54, 0xf2, 0x07, 0xe5, 0x16, 0x7a,
+	0xe1, 0x17, 0xba, 0xf0, 0x3f, 0x3d, 0xf1, 0xb7, 0xc3, 0x65, 0x28, 0x62, 0x15, 0xa3, 0x71, 0x75,
+	0x3f, 0x79, 0x04, 0x57, 0xf9, 0x3c, 0xbe, 0x99, 0x53, 0xdc, 0xcb, 0x68, 0x01, 0x5b, 0x56, 0xed,
+	0x7e, 0xff, 0x87, 0x48, 0x0e, 0xf8, 0xb7, 0xf0, 0x93, 0xb7, 0x91, 0xe8, 0x53, 0x62, 0x7e, 0xf2,
+	0x23, 0xbc, 0xf1, 0x57, 0xb9, 0x4d, 0xb7, 0x8d, 0xd2, 0xe1, 0x0f, 0x30, 0x43, 0xe1, 0xee, 0x12,
+	0x54, 0x61, 0x61, 0x2a, 0x58, 0x1e, 0x92, 0x5a, 0x2c, 0xa6, 0x6f, 0xa5, 0x99, 0x4e, 0x03, 0xbb,
+	0xb3, 0x99, 0xee, 0xfd, 0x61, 0xd9, 0x98, 0x48, 0xee, 0x9d, 0xff, 0x72, 0x6a, 0x6a, 0x96, 0xe8,
+	0x49, 0x48, 0x9d, 0xec, 0xe2, 0x0f, 0x4e, 0xc7, 0x50, 0x76, 0xa7, 0x85, 0xba, 0x14, 0x92, 0xbd,
+	0xf0, 0xf7, 0xf5, 0xca, 0x2f, 0x7c, 0xc0, 0xbd, 0x9e, 0xfa, 0xef, 0x43, 0x60, 0xe5, 0x50, 0xe7,
+	0x97, 0x4d, 0x8c, 0x6c, 0xcb, 0xc0, 0x42, 0x56, 0xbd, 0x0b, 0xf1, 0xb8, 0x78, 0xdc, 0x84, 0x6f,
+	0x75, 0xef, 0x17, 0xf4, 0x8b, 0x4c, 0x85, 0xbf, 0xa3, 0xb4, 0xfc, 0x66, 0xae, 0x0d, 0xce, 0x71,
+	0xf1, 0x93, 0xf7, 0xd9, 0x9e, 0x5a, 0x5c, 0x73, 0x84, 0xdd, 0x0b, 0xbf, 0x7f, 0xb6, 0x57, 0xfe,
+	0x9a, 0x45, 0x88, 0xf6, 0xc0, 0xbf, 0x00, 0x50, 0x2e, 0xd5, 0x4d, 0x16, 0xf7, 0xb1, 0x3b, 0xcc,
+	0xe3, 0x5f, 0xa6, 0xca, 0x7e, 0xaf, 0xc2, 0xca, 0x1e, 0xf8, 0x95, 0x7a, 0xac, 0x17, 0xfe, 0xb2,
+	0x54, 0x96, 0xca, 0xd2, 0x7f, 0x75, 0x8a, 0x3a, 0x7a, 0x90, 0x8f, 0x22, 0xcc, 0xc4, 0xcf, 0xd3,
+	0x7c, 0xc9, 0x84, 0xae, 0x18, 0x48, 0xfd, 0xdb, 0xf7, 0xef, 0xa6, 0x98, 0x74, 0x19, 0x5a, 0xf6,
+	0xe9, 0xac, 0x08, 0xde, 0x32, 0x34, 0xef, 0xdd, 0x59, 0xe9, 0x49, 0xd5, 0xca, 0xbe, 0x51, 0xfd,
+	0x7a, 0xf2, 0x3e, 0x4d, 0x5a, 0x2a, 0x21, 0x6a, 0x08, 0x74, 0x69, 0x44, 0x25, 0x63, 0x48, 0xbd,
+	0x5e, 0x15, 0x88, 0x7f, 0x4c, 0x13, 0xc5, 0x69, 0x97, 0xc5, 0xaa, 0xa2, 0x31, 0x94, 0x94, 0x8b,
+	0xee, 0xcc, 0x94, 0xbf, 0xaa, 0x46, 0x16, 0x15, 0x5f, 0xdd, 0x28, 0x45, 0xe5, 0xf8, 0x1a, 0xb9,
+	0x55, 0x22, 0xd4, 0x28, 0x6d, 0xd0, 0x10, 0x6e, 0xa4, 0xe6, 0x8c, 0x60, 0xa3, 0xd1, 0x87, 0xe6,
+	0xc6, 0x53, 0x55, 0x1d, 0xfe, 0x75, 0x90, 0x83, 0x72, 0x58, 0x17, 0xcf, 0xd3, 0x17, 0x66, 0x73,
+	0x11, 0x20, 0xdb, 0x4c, 0x0c, 0xef, 0x9a, 0xc4, 0x39, 0xec, 0x76, 0xee, 0xbf, 0x1d, 0x74, 0x49,
+	0x10, 0xad, 0x2b, 0xf9, 0x1b, 0x18, 0x70, 0x51, 0xdc, 0x7f, 0xed, 0x5f, 0x72, 0xa0, 0x81, 0x56,
+	0x1e, 0x9b, 0x2e, 0x76, 0xc8, 0x7b, 0x1b, 0xeb, 0x8d, 0x34, 0x9b, 0xb1, 0xd6, 0x8a, 0xb4, 0x86,
+	0x87, 0xe1, 0x98, 0xa8, 0x67, 0xb1, 0x5a, 0x85, 0xa9, 0xed, 0xae, 0x01, 0xa9, 0xad, 0x98, 0xa9,
+	0xe3, 0x1b, 0xe9, 0x18, 0x6e, 0xa5, 0x06, 0x8f, 0x60, 0x07, 0xd8, 0x6b, 0xfe, 0x98, 0x9e, 0x69,
+	0xef, 0xe0, 0xc3, 0xe3, 0x01, 0x83, 0xbe, 0x59, 0x43, 0x99, 0x16, 0x03, 0x1f, 0xeb, 0xf3, 0x4b,
+	0x13, 0x31, 0x17, 0xff, 0xc7, 0xc0, 0x9f, 0xdf, 0x6d, 0x32, 0xe3, 0x22, 0xdd, 0x05, 0x63, 0x88,
+	0x03, 0x67, 0x96, 0xef, 0x2c, 0xc6, 0xb1, 0x40, 0x2e, 0x9e, 0x17, 0x43, 0x85, 0x13, 0xd8, 0xa4,
+	0x4c, 0x2b, 0x8f, 0x01, 0x8e, 0x2f, 0x5b, 0x9d, 0x85, 0xf4, 0xca, 0xba, 0xfc, 0x96, 0x35, 0xb9,
+	0x48, 0xfa, 0x33, 0x0e, 0x79, 0x41, 0x3a, 0x16, 0xab, 0x55, 0x98, 0x73, 0xfd, 0xcc, 0x4f, 0xb7,
+	0xd8, 0x06, 0x8e, 0x83, 0x24, 0xeb, 0x98, 0x68, 0xde, 0xbe, 0x42, 0xb3, 0xbe, 0xc2, 0x0d, 0x3f,
+	0xdf, 0x33, 0x13, 0xc0, 0x72, 0x9c, 0xf4, 0x11, 0xa3, 0x44, 0xec, 0x74, 0xb9, 0x7a, 0xfb, 0x38,
+	0x9a, 0x0a, 0x70, 0x52, 0x87, 0x3f, 0x74, 0xe2, 0xb8, 0x72, 0x25, 0xe1, 0xaf, 0x66, 0x91, 0xf6,
+	0x23, 0xad, 0x93, 0x4a, 0x8d, 0xb3, 0x01, 0x37, 0xb1, 0x40, 0x78, 0xbb, 0x91, 0x26, 0xaa, 0xf9,
+	0x07, 0xa4, 0x4b, 0xa1, 0xc1, 0x0d, 0x53, 0x30, 0x83, 0xe8, 0xc9, 0xc2, 0x43, 0x8a, 0xfe, 0x80,
+	0x8a, 0xe7, 0xe9, 0x9a, 0x06, 0x37, 0xfe, 0xf9, 0xc2, 0xdc, 0x32, 0x27, 0x30, 0xb8, 0x90, 0x7a,
+	0x34, 0x34, 0x16, 0xab, 0x55, 0xb8, 0xbc, 0xd8, 0x87, 0x44, 0x01, 0x52, 0x45, 0x17, 0x2e, 0x6a,
+	0x41, 0x9d, 0x21, 0x4c, 0x1d, 0xda, 0xca, 0xb5, 0x8b, 0x9d, 0x6c, 0xab, 0xb7, 0x6a, 0x39, 0x82,
+	0xfa, 0xef, 0x7b, 0x4a, 0xb3, 0xd9, 0x49, 0xb4, 0xcd, 0x39, 0xc8, 0x7b, 0x57, 0xe0, 0x95, 0x3f,
+	0x3a, 0x99, 0x6e, 0xcf, 0xf3, 0x2e, 0xa4, 0x35, 0xf1, 0x31, 0xc8, 0x94, 0xce, 0x4c, 0xa1, 0xbb,
+	0x54, 0xf5, 0x60, 0xa1, 0xc1, 0x2f, 0xb1, 0x3a, 0xa6, 0x95, 0xfd, 0x9c, 0x34, 0xc2, 0x6c, 0xc8,
+	0x77, 0x63, 0x74, 0xf9, 0xdf, 0x20, 0xbd, 0x45, 0x05, 0xe6, 0x12, 0x9d, 0xe1, 0x6b, 0x2c, 0x56,
+	0xab, 0x60, 0x12, 0xe3, 0xf8, 0x0e, 0x27, 0x4a, 0xd1, 0x58, 0x42, 0xbd, 0x16, 0x63, 0x06, 0x0d,
+	0x29, 0xb4, 0x96, 0x8b, 0xeb, 0x28, 0x5e, 0x26, 0x21, 0x11, 0xf5, 0xc4, 0xe7, 0x37, 0xf2, 0xe9,
+	0x53, 0x5a, 0xd8, 0x2b, 0xb8, 0xa5, 0x0a, 0xfa, 0xa9, 0x78, 0x5d, 0x67, 0xef, 0x9f, 0xf2, 0x52,
+	0xb7, 0x60, 0x50, 0xf3, 0x57, 0x30, 0xd6, 0xd4, 0xab, 0xff, 0xb2, 0x6d, 0x46, 0x5a, 0xaf, 0xf0,
+	0x06, 0x8b, 0x05, 0x6e, 0xbf, 0x73, 0x99, 0x52, 0x6c, 0x08, 0x2b, 0xd1, 0x93, 0x49, 0x0a, 0xdf,
+	0x2b, 0x57, 0xbf, 0xfd, 0x8f, 0xa3, 0x0a, 0x9c, 0xac, 0x3e, 0xaa, 0x2c, 0x56, 0xab, 0xb8, 0x25,
+	0x9b, 0x37, 0xa5, 0x3d, 0x92, 0x0f, 0x28, 0xcb, 0x8f, 0xcb, 0x33, 0xc9, 0xcb, 0xc8, 0x33, 0x90,
+	0x9c, 0x1c, 0xae, 0x2f, 0x9f, 0xc1, 0x57, 0x19, 0xdc, 0x7b, 0xc2, 0xd2, 0x46, 0xc4, 0xbb, 0x6f,
+	0xa2, 0xf2, 0xb5, 0xd4, 0x2d, 0x04, 0xaa, 0xf8, 0xeb, 0x66, 0xba, 0x56, 0x16, 0x69, 0xf8, 0xeb,
+	0x3f, 0xde, 0xaf, 0xff, 0x87, 0xea, 0x5d, 0xbb, 0x08, 0x57, 0x49, 0xd5, 0x9b, 0x78, 0xb9, 0x6d,
+	0xea, 0xf5, 0x01, 0xac, 0x0b, 0xa3, 0x03, 0x4a, 0xcc, 0xaf, 0xb2, 0x58, 0xad, 0x92, 0x2d, 0xc1,
+	0x74, 0x00, 0xb0, 0x5b, 0xc3, 0xc5, 0x4d, 0x84, 0x7e, 0x64, 0xf2, 0xa3, 0x58, 0x4a, 0x16, 0x01,
+	0x0d, 0x42, 0x5c, 0xf3, 0xc9, 0xae, 0x4e, 0x20, 0x4e, 0xe5, 0xef, 0x18, 0x87, 0x82, 0x26, 0xee,
+	0x35, 0xfe, 0x83, 0xb8, 0xb8, 0x53, 0x1a, 0xfe, 0xa0, 0x38, 0xfc, 0xee, 0xab, 0xcb, 0x3f, 0xf6,
+	0xb2, 0xa2, 0x17, 0x75, 0xdb, 0xd3, 0x4d, 0x4e, 0xaa, 0x50, 0x59, 0x79, 0x53, 0x37, 0xbf, 0xe5,
+	0x62, 0x4c, 0xd2, 0x2f, 0xd1, 0x25, 0xe4, 0x57, 0x9d, 0x5e, 0x85, 0x69, 0xaa, 0xa7, 0x3e, 0x28,
+	0x5a, 0x8e, 0x0e, 0x70, 0xa7, 0x18, 0x09, 0x77, 0x6e, 0x23, 0x7f, 0xe4, 0x62, 0x60, 0x63, 0x69,
+	0x3d, 0x11, 0x4d, 0x6b, 0xe0, 0xec, 0xa0, 0xbc, 0x25, 0xb2, 0xc8, 0x65, 0x3b, 0xf4, 0xd8, 0xc4,
+	0x25, 0xfe, 0xe5, 0xb8, 0x5e, 0x45, 0xb7, 0xff, 0xff, 0x12, 0x48, 0x5a, 0xb7, 0x74, 0x49, 0xac,
+	0x07, 0x7e, 0x33, 0xdb, 0x8c, 0x29, 0xb5, 0x9c, 0x2e, 0xbf, 0x00, 0xb5, 0x36, 0x07, 0x70, 0x4c,
+	0x2b, 0x15, 0xff, 0x54, 0xd5, 0x23, 0xbf, 0x87, 0x65, 0xa4, 0x82, 0xad, 0x48, 0x76, 0x7f, 0xdc,
+	0x38, 0x45, 0xb2, 0x96, 0x14, 0x4f, 0xef, 0x86, 0x77, 0xe4, 0x4b, 0xb6, 0x43, 0x15, 0x59, 0x18,
+	0x72, 0xce, 0xdd, 0xf6, 0xad, 0xcf, 0xff, 0x2a, 0x8a, 0xda, 0xea, 0x9e, 0x6c, 0xe9, 0xb4, 0x0f,
+	0x51, 0x3c, 0xd3, 0x14, 0xf5, 0x9e, 0x76, 0x1a, 0x51, 0x7f, 0x8b, 0x3c, 0x9f, 0x76, 0xcb, 0x80,
+	0xde, 0xb4, 0xf7, 0xbc, 0xc0, 0x5c, 0xdc, 0xa5, 0xe1, 0x6f, 0x84, 0x14, 0xc3, 0x33, 0x7c, 0xd5,
+	0xa0, 0xd8, 0xef, 0xdf, 0x32, 0x62, 0xf4, 0xc9, 0x75, 0x23, 0x5d, 0xb3, 0xcc, 0x81, 0x42, 0x65,
+	0x3b, 0x17, 0xa0, 0x74, 0x8f, 0x24, 0x85, 0x95, 0x88, 0xbf, 0x83, 0x95, 0xc5, 0xd4, 0xba, 0x9d,
+	0x7c, 0x85, 0x6d, 0x47, 0xc8, 0x82, 0x7f, 0xf9, 0x1e, 0x78, 0x5d, 0x13, 0x36, 0x29, 0x45, 0x9e,
+	0xb4, 0x5b, 0xe4, 0xf1, 0xf4, 0x0d, 0xb5, 0x61, 0x74, 0x62, 0x91, 0xc5, 0xa3, 0x4a, 0xc5, 0x4f,
+	0xfe, 0x46, 0xe4, 0x0f, 0xae, 0xb5, 0x50, 0x64, 0xa1, 0x73, 0x10, 0x5a, 0x2c, 0x3b, 0xfb, 0x01,
+	0xb8, 0x47, 0x24, 0xe8, 0x32, 0x3e, 0xbc, 0xa6, 0x88, 0x2c, 0x1f, 0x0e, 0x4b, 0x1b, 0x52, 0x12,
+	0xfe, 0xe7, 0x52, 0x98, 0x72, 0xe5, 0x7e, 0x72, 0x02, 0xdb, 0x7e, 0x6f, 0x39, 0x7d, 0xa6, 0xce,
+	0x30, 0x85, 0x52, 0xad, 0x68, 0x0b, 0x15, 0x73, 0xa4, 0x1d, 0xb3, 0x1f, 0x4f, 0xa3, 0x8b, 0x14,
+	0xb4, 0x5b, 0xe4, 0xb5, 0x3b, 0xb4, 0x89, 0xf5, 0xe8, 0x47, 0x58, 0xbe, 0x92, 0x6f, 0xf7, 0x87,
+	0xd2, 0xf1, 0xcf, 0xc1, 0x94, 0x34, 0x87, 0x4b, 0x13, 0x7f, 0x05, 0xdf, 0xdc, 0xf6, 0x7d, 0xcd,
+	0xb6, 0xb4, 0x80, 0x0f, 0x64, 0x33, 0x70, 0x25, 0xe8, 0x59, 0x97, 0xb7, 0x2e, 0x22, 0x5f, 0x65,
+	0x0f, 0xf2, 0xc2, 0x9f, 0x09, 0x67, 0x43, 0x0f, 0x27, 0xfb, 0xc0, 0x2e, 0x68, 0x17, 0x86, 0x11,
+	0xb7, 0xe9, 0x33, 0xf9, 0x5d, 0xc5, 0x8f, 0x42, 0x05, 0xeb, 0x52, 0x40, 0x5d, 0x02, 0x7e, 0xd7,
+	0xb0, 0x4e, 0x50, 0xdd, 0xaa, 0xfc, 0xc5, 0x42, 0x52, 0xb4, 0x5b, 0xe4, 0x19, 0x6d, 0xd2, 0x70,
+	0x54, 0xe9, 0x18, 0x33, 0xd9, 0xc4, 0xe1, 0x50, 0x05, 0x57, 0x24, 0xf1, 0xdd, 0xf2, 0x3f, 0x8a,
+	0x14, 0xa5, 0x2f, 0xe7, 0x31, 0x5c, 0x3d, 0x48, 0xda, 0xe2, 0x2a, 0x5f, 0xdd, 0x5b, 0xaf, 0x10,
+	0x43, 0x89, 0xe1, 0x10, 0x77, 0x20, 0x04, 0x1c, 0xc7, 0x66, 0x43, 0xc9, 0xf8, 0x85, 0x14, 0xeb,
+	0xe1, 0xa4, 0xef, 0x19, 0x38, 0x8f, 0xc4, 0x5e, 0xb2, 0x4c, 0xe7, 0xdb, 0xd0, 0x16, 0xe3, 0x66,
+	0xec, 0x49, 0x27, 0x1f, 0x2c, 0xba, 0x5b, 0x90, 0xb5, 0x73, 0x5f, 0x11, 0xd2, 0xeb, 0x33, 0x7b,
+	0x8c, 0x66, 0x8b, 0xbc, 0x85, 0x42, 0xef, 0xb9, 0x75, 0x9f, 0x19, 0xd9, 0x34, 0xd4, 0xb6, 0xb7,
+	0x03, 0xa6, 0x1d, 0x7f, 0x15, 0x4d, 0x2f, 0x1d, 0xbf, 0x21, 0x15, 0xca, 0xb5, 0xb1, 0x42, 0x27,
+	0xfb, 0x05, 0x09, 0xb4, 0xca, 0x03, 0xe2, 0x2f, 0xd2, 0xd2, 0xd8, 0x76, 0x0e, 0x27, 0x8d, 0x18,
+	0x8f, 0x01, 0xb2, 0x3d, 0x84, 0xff, 0x6a, 0xf9, 0x8b, 0x47, 0xe4, 0xb1, 0x5d, 0xf7, 0xdd, 0xfb,
+	0xff, 0x86, 0xbb, 0x85, 0xb7, 0x73, 0x32, 0x5a, 0xb6, 0x22, 0x75, 0x3d, 0x26, 0xc8, 0xa6, 0xb9,
+	0xbc, 0x7b, 0xeb, 0x78, 0x58, 0x18, 0x73, 0x8b, 0x7f, 0x93, 0x7d, 0xec, 0x9a, 0x2d, 0xf2, 0x0c,
+	0xe3, 0x53, 0xc4, 0x20, 0xdd, 0x2d, 0x7c, 0x10, 0x7e, 0x21, 0x03, 0xb8, 0xd2, 0xbb, 0x74, 0xfd,
+	0xbf, 0x68, 0x00, 0x85, 0x72, 0x34, 0x4f, 0x17, 0xdd, 0x12, 0x27, 0x78, 0x54, 0x70, 0x0f, 0x38,
+	0xda, 0x50, 0xeb, 0x6b, 0xbc, 0xef, 0x9d, 0xe7, 0x3f, 0x2a, 0xfe, 0xf7, 0x85, 0xb6, 0x94, 0x63,
+	0xd4, 0xe7, 0x17, 0x54, 0xc8, 0x48, 0xf5, 0xe6, 0x99, 0x35, 0xa2, 0x9a, 0x28, 0xb7, 0xd7, 0xab,
+	0x12, 0xa9, 0xde, 0xf2, 0x4e, 0xb3, 0xa9, 0x9d, 0xa1, 0x41, 0xdb, 0x48, 0xc5, 0x82, 0x5e, 0xff,
+	0xc6, 0x8d, 0x7c, 0xff, 0x3f, 0xcc, 0xff, 0x35, 0xe3, 0x9f, 0xe1, 0x77, 0xc5, 0xc0, 0xa2, 0xa7,
+	0xff, 0x3e, 0x68, 0x49, 0xab, 0xff, 0xd4, 0x2f, 0x90, 0x7d, 0x5c, 0x0f, 0x3e, 0xff, 0xe5, 0xd4,
+	0xd4, 0x34, 0xe0, 0xa6, 0xca, 0xc4, 0xff, 0x06, 0xb2, 0x6b, 0xe8, 0x9c, 0x7c, 0x20, 0x93, 0x9e,
+	0x89, 0xdf, 0xb0, 0x8f, 0x85, 0xe5, 0xa9, 0x4f, 0x96, 0xa5, 0xb2, 0x54, 0x96, 0xca, 0x52, 0x59,
+	0x7a, 0x60, 0xd2, 0xff, 0x02,
 };
 
-// Font glyphs info data
-// NOTE: No glyphs.image data provided
-static const GlyphInfo fontGlyphs_Iosevka[95] = {
-		{32, 0, 26, 13, {0}},	 {33, 4, 6, 13, {0}},		{34, 2, 5, 13, {0}},
-		{35, 0, 6, 13, {0}},	 {36, 1, 3, 13, {0}},		{37, 0, 5, 13, {0}},
-		{38, 1, 5, 13, {0}},	 {39, 5, 5, 13, {0}},		{40, 3, 3, 13, {0}},
-		{41, 2, 3, 13, {0}},	 {42, 1, 3, 13, {0}},		{43, 1, 11, 13, {0}},
-		{44, 4, 21, 13, {0}},	 {45, 1, 15, 13, {0}},	{46, 4, 21, 13, {0}},
-		{47, 1, 3, 13, {0}},	 {48, 1, 5, 13, {0}},		{49, 1, 6, 13, {0}},
-		{50, 1, 5, 13, {0}},	 {51, 1, 5, 13, {0}},		{52, 1, 6, 13, {0}},
-		{53, 1, 6, 13, {0}},	 {54, 1, 6, 13, {0}},		{55, 1, 6, 13, {0}},
-		{56, 1, 5, 13, {0}},	 {57, 1, 5, 13, {0}},		{58, 4, 11, 13, {0}},
-		{59, 4, 11, 13, {0}},	 {60, 1, 9, 13, {0}},		{61, 1, 13, 13, {0}},
-		{62, 1, 9, 13, {0}},	 {63, 1, 5, 13, {0}},		{64, 1, 5, 13, {0}},
-		{65, 1, 6, 13, {0}},	 {66, 1, 6, 13, {0}},		{67, 1, 5, 13, {0}},
-		{68, 1, 6, 13, {0}},	 {69, 1, 6, 13, {0}},		{70, 2, 6, 13, {0}},
-		{71, 1, 5, 13, {0}},	 {72, 1, 6, 13, {0}},		{73, 2, 6, 13, {0}},
-		{74, 1, 6, 13, {0}},	 {75, 2, 6, 13, {0}},		{76, 2, 6, 13, {0}},
-		{77, 1, 6, 13, {0}},	 {78, 1, 6, 13, {0}},		{79, 1, 5, 13, {0}},
-		{80, 2, 6, 13, {0}},	 {81, 1, 5, 13, {0}},		{82, 1, 6, 13, {0}},
-		{83, 1, 5, 13, {0}},	 {84, 1, 6, 13, {0}},		{85, 1, 6, 13, {0}},
-		{86, 1, 6, 13, {0}},	 {87, 0, 6, 13, {0}},		{88, 1, 6, 13, {0}},
-		{89, 1, 6, 13, {0}},	 {90, 1, 6, 13, {0}},		{91, 3, 3, 13, {0}},
-		{92, 1, 3, 13, {0}},	 {93, 2, 3, 13, {0}},		{94, 1, 6, 13, {0}},
-		{95, 1, 26, 13, {0}},	 {96, 2, 4, 13, {0}},		{97, 1, 11, 13, {0}},
-		{98, 1, 6, 13, {0}},	 {99, 1, 11, 13, {0}},	{100, 1, 6, 13, {0}},
-		{101, 1, 11, 13, {0}}, {102, 1, 5, 13, {0}},	{103, 1, 11, 13, {0}},
-		{104, 1, 6, 13, {0}},	 {105, 2, 6, 13, {0}},	{106, 0, 6, 13, {0}},
-		{107, 2, 6, 13, {0}},	 {108, 2, 6, 13, {0}},	{109, 1, 11, 13, {0}},
-		{110, 1, 11, 13, {0}}, {111, 1, 11, 13, {0}}, {112, 1, 11, 13, {0}},
-		{113, 1, 11, 13, {0}}, {114, 3, 11, 13, {0}}, {115, 1, 11, 13, {0}},
-		{116, 1, 6, 13, {0}},	 {117, 1, 11, 13, {0}}, {118, 1, 11, 13, {0}},
-		{119, 0, 11, 13, {0}}, {120, 1, 11, 13, {0}}, {121, 1, 11, 13, {0}},
-		{122, 1, 11, 13, {0}}, {123, 2, 3, 13, {0}},	{124, 5, 3, 13, {0}},
-		{125, 2, 3, 13, {0}},	 {126, 0, 14, 13, {0}},
+static const Rectangle IOSEVKA_RECS[65] = {
+	{2, 2, 13, 32},
+	{181, 2, 5, 21},
+	{56, 2, 12, 22},
+	{142, 38, 8, 20},
+	{190, 2, 11, 21},
+	{72, 2, 12, 22},
+	{154, 38, 11, 20},
+	{205, 2, 12, 21},
+	{221, 2, 12, 21},
+	{169, 38, 11, 20},
+	{88, 2, 12, 22},
+	{237, 2, 12, 21},
+	{184, 38, 12, 20},
+	{200, 38, 12, 20},
+	{104, 2, 11, 22},
+	{216, 38, 12, 20},
+	{232, 38, 11, 20},
+	{2, 63, 10, 20},
+	{119, 2, 11, 22},
+	{16, 63, 11, 20},
+	{31, 63, 10, 20},
+	{2, 38, 11, 21},
+	{45, 63, 11, 20},
+	{60, 63, 10, 20},
+	{74, 63, 12, 20},
+	{90, 63, 11, 20},
+	{134, 2, 12, 22},
+	{105, 63, 11, 20},
+	{40, 2, 12, 26},
+	{120, 63, 12, 20},
+	{150, 2, 12, 22},
+	{136, 63, 11, 20},
+	{17, 38, 11, 21},
+	{151, 63, 12, 20},
+	{167, 63, 13, 20},
+	{184, 63, 12, 20},
+	{200, 63, 12, 20},
+	{216, 63, 11, 20},
+	{45, 87, 11, 16},
+	{32, 38, 12, 21},
+	{60, 87, 11, 16},
+	{48, 38, 11, 21},
+	{75, 87, 12, 16},
+	{63, 38, 12, 21},
+	{166, 2, 11, 22},
+	{231, 63, 11, 20},
+	{2, 87, 10, 20},
+	{19, 2, 10, 27},
+	{16, 87, 11, 20},
+	{31, 87, 10, 20},
+	{137, 87, 12, 15},
+	{153, 87, 11, 15},
+	{91, 87, 12, 16},
+	{79, 38, 12, 21},
+	{95, 38, 11, 21},
+	{168, 87, 10, 15},
+	{107, 87, 11, 16},
+	{110, 38, 12, 21},
+	{122, 87, 11, 16},
+	{182, 87, 12, 15},
+	{198, 87, 13, 15},
+	{215, 87, 12, 15},
+	{126, 38, 12, 21},
+	{231, 87, 11, 15},
+	{33, 2, 3, 27},
 };
 
-// Font loading function: Iosevka
-static Font LoadFont_Iosevka(void)
-{
-	Font font = {0};
-
-	font.baseSize = 32;
-	font.glyphCount = 95;
-	font.glyphPadding = 4;
-
-	// Custom font loading
-	// NOTE: Compressed font image data (DEFLATE), it requires DecompressData() function
-	int fontDataSize_Iosevka = 0;
-	unsigned char* data =
-			DecompressData(fontData_Iosevka, COMPRESSED_DATA_SIZE_FONT_IOSEVKA,
-										 &fontDataSize_Iosevka);
-	Image imFont = {data, 512, 256, 1, 2};
-
-	// Load texture from image
-	font.texture = LoadTextureFromImage(imFont);
-	UnloadImage(imFont);	// Uncompressed data can be unloaded from memory
-
-	// Assign glyph recs and info data directly
-	// WARNING: This font data must not be unloaded
-	font.recs = (Rectangle*)fontRecs_Iosevka;
-	font.glyphs = (GlyphInfo*)fontGlyphs_Iosevka;
-
-	return font;
-}
+// glyph images are in the atlas
+static const GlyphInfo IOSEVKA_GLYPHS[65] = {
+	{32, 0, 26, 13, {0}},
+	{33, 4, 6, 13, {0}},
+	{48, 1, 5, 13, {0}},
+	{49, 1, 6, 13, {0}},
+	{50, 1, 5, 13, {0}},
+	{51, 1, 5, 13, {0}},
+	{52, 1, 6, 13, {0}},
+	{53, 1, 6, 13, {0}},
+	{54, 1, 6, 13, {0}},
+	{55, 1, 6, 13, {0}},
+	{56, 1, 5, 13, {0}},
+	{57, 1, 5, 13, {0}},
+	{65, 1, 6, 13, {0}},
+	{66, 1, 6, 13, {0}},
+	{67, 1, 5, 13, {0}},
+	{68, 1, 6, 13, {0}},
+	{69, 1, 6, 13, {0}},
+	{70, 2, 6, 13, {0}},
+	{71, 1, 5, 13, {0}},
+	{72, 1, 6, 13, {0}},
+	{73, 2, 6, 13, {0}},
+	{74, 1, 6, 13, {0}},
+	{75, 2, 6, 13, {0}},
+	{76, 2, 6, 13, {0}},
+	{77, 1, 6, 13, {0}},
+	{78, 1, 6, 13, {0}},
+	{79, 1, 5, 13, {0}},
+	{80, 2, 6, 13, {0}},
+	{81, 1, 5, 13, {0}},
+	{82, 1, 6, 13, {0}},
+	{83, 1, 5, 13, {0}},
+	{84, 1, 6, 13, {0}},
+	{85, 1, 6, 13, {0}},
+	{86, 1, 6, 13, {0}},
+	{87, 0, 6, 13, {0}},
+	{88, 1, 6, 13, {0}},
+	{89, 1, 6, 13, {0}},
+	{90, 1, 6, 13, {0}},
+	{97, 1, 11, 13, {0}},
+	{98, 1, 6, 13, {0}},
+	{99, 1, 11, 13, {0}},
+	{100, 1, 6, 13, {0}},
+	{101, 1, 11, 13, {0}},
+	{102, 1, 5, 13, {0}},
+	{103, 1, 11, 13, {0}},
+	{104, 1, 6, 13, {0}},
+	{105, 2, 6, 13, {0}},
+	{106, 0, 6, 13, {0}},
+	{107, 2, 6, 13, {0}},
+	{108, 2, 6, 13, {0}},
+	{109, 1, 11, 13, {0}},
+	{110, 1, 11, 13, {0}},
+	{111, 1, 11, 13, {0}},
+	{112, 1, 11, 13, {0}},
+	{113, 1, 11, 13, {0}},
+	{114, 3, 11, 13, {0}},
+	{115, 1, 11, 13, {0}},
+	{116, 1, 6, 13, {0}},
+	{117, 1, 11, 13, {0}},
+	{118, 1, 11, 13, {0}},
+	{119, 0, 11, 13, {0}},
+	{120, 1, 11, 13, {0}},
+	{121, 1, 11, 13, {0}},
+	{122, 1, 11, 13, {0}},
+	{124, 5, 3, 13, {0}},
+};
@@ -0,0 +1,300 @@
+#!/usr/bin/env sh
+set -e
+# shellcheck disable=2086
+BENCH="./pickle-bench"
+PICKLE="./pickle"
+SCENARIOS="idle spin menu-scroll typing list-1k list-10k list-100k"
+BASELINE="bench-baseline.json"
+RESULTS="bench.json"
+VERSUS="bench-versus.json"
+STARTUP_COLD="startup-cold.json"
+STARTUP_WARM="startup-warm.json"
+# launches measured by startup, for both the cold and the warm runs
+RUNS=10
+# percent a metric can grow before it counts as a regression
+THRESHOLD=10
+
+print_help() {
+	printf \
+		"%s [run|save|compare|startup|stress|versus old new] [-t percent] [-s scenarios] [-n runs]
+
+run          runs every scenario and writes the results to $RESULTS
+save         runs every scenario and stores the results as the baseline
+compare      runs every scenario and flags regressions against the baseline
+versus       runs every scenario with two benchmark binaries and compares them
+startup      launches pickle until its first frame, cold and warm, and prints
+             the time spent in every startup phase
+stress       pushes characters through the text input queue from one thread
+             and pops them on another, failing if any comes out wrong
+-t           regression threshold in percent, $THRESHOLD by default
+-s           space separated scenarios to run, all of them by default
+-n           launches for startup, $RUNS by default
+-h --help    show help
+
+Build the benchmark binary with ./build.sh linux -B first, startup uses the
+regular $PICKLE binary\n" "$0"
+}
+
+# sets $wrapper to xvfb-run when there is no display
+find_display() {
+	wrapper=""
+
+	if [ -z "$DISPLAY" ]; then
+		if ! command -v xvfb-run >/dev/null; then
+			echo "There is no display and xvfb-run is not installed!"
+			exit 1
+		fi
+
+		wrapper="xvfb-run -a"
+	fi
+}
+
+# runs headless on mesa's software renderer so it works without a gpu
+run_scenarios() {
+	out="$1"
+
+	if [ ! -x "$BENCH" ]; then
+		echo "$BENCH does not exist, build it with ./build.sh linux -B"
+		exit 1
+	fi
+
+	find_display
+	rm -f "$out"
+
+	for scenario in $SCENARIOS; do
+		echo "Running $scenario"
+		LIBGL_ALWAYS_SOFTWARE=1 $wrapper $BENCH --bench "$scenario" \
+			--bench-out "$out" >/dev/null 2>&1 || {
+			echo "'$scenario' failed!"
+			exit 1
+		}
+	done
+}
+
+launch() {
+	$wrapper $PICKLE --startup-bench "$1" >/dev/null 2>&1 || {
+		echo "$PICKLE failed to start!"
+		exit 1
+	}
+}
+
+# a cold launch needs the page cache dropped, which only root can do
+run_startup() {
+	if [ ! -x "$PICKLE" ]; then
+		echo "$PICKLE does not exist, build it with ./build.sh linux -R"
+		exit 1
+	fi
+
+	find_display
+	rm -f "$STARTUP_COLD" "$STARTUP_WARM"
+
+	if [ -w /proc/sys/vm/drop_caches ]; then
+		i=0
+		while [ $i -lt "$RUNS" ]; do
+			sync
+			echo 3 >/proc/sys/vm/drop_caches
+			launch "$STARTUP_COLD"
+			i=$((i + 1))
+		done
+	else
+		echo "Can not drop the page cache without root, only one cold launch"
+		launch "$STARTUP_COLD"
+	fi
+
+	i=0
+	while [ $i -lt "$RUNS" ]; do
+		launch "$STARTUP_WARM"
+		i=$((i + 1))
+	done
+
+	summarize_startup cold "$STARTUP_COLD"
+	summarize_startup warm "$STARTUP_WARM"
+}
+
+# prints the median, p95 and max of every phase
+summarize_startup() {
+	awk -v kind="$1" '
+		function sort(values, count,    i, j, value) {
+			for (i = 2; i <= count; i++) {
+				value = values[i]
+				for (j = i - 1; j > 0 && values[j] > value; j--) {
+					values[j + 1] = values[j]
+				}
+				values[j + 1] = value
+			}
+		}
+
+		{
+			line = $0
+			while (match(line, /"[A-Za-z_]+":[-0-9.]+/)) {
+				pair = substr(line, RSTART + 1, RLENGTH - 1)
+				line = substr(line, RSTART + RLENGTH)
+				split(pair, parts, "\":")
+
+				if (!(parts[1] in counts)) {
+					order[++phases] = parts[1]
+				}
+
+				samples[parts[1], ++counts[parts[1]]] = parts[2]
+			}
+		}
+
+		END {
+			printf "%s, %d launches\n", kind, NR
+			printf "%-14s %10s %10s %10s\n", "phase", "p50 ms", "p95 ms", "max ms"
+
+			for (p = 1; p <= phases; p++) {
+				name = order[p]
+				count = counts[name]
+
+				for (i = 1; i <= count; i++) {
+					values[i] = samples[name, i] + 0
+				}
+
+				sort(values, count)
+				printf "%-14s %10.2f %10.2f %10.2f\n", name, \
+					values[int((count - 1) * 0.5) + 1], \
+					values[int((count - 1) * 0.95) + 1], values[count]
+			}
+		}
+	' "$2"
+}
+
+# prints every metric side by side and fails if any grew past the threshold
+compare_results() {
+	awk -v threshold="$THRESHOLD" '
+		function field(line, name) {
+			if (match(line, "\"" name "\":[-0-9.e]+")) {
+				return substr(line, RSTART + length(name) + 3, RLENGTH - length(name) - 3)
+			}
+			return ""
+		}
+
+		function scenario(line) {
+			match(line, /"scenario":"[^"]*"/)
+			return substr(line, RSTART + 12, RLENGTH - 13)
+		}
+
+		BEGIN {
+			split("p50 p95 p99 cpu_ms allocations", metrics, " ")
+			failed = 0
+		}
+
+		FNR == NR {
+			baseline[scenario($0)] = $0
+			next
+		}
+
+		{
+			name = scenario($0)
+
+			if (!(name in baseline)) {
+				printf "%-12s not in the baseline\n", name
+				next
+			}
+
+			for (m = 1; m in metrics; m++) {
+				old = field(baseline[name], metrics[m]) + 0
+				new = field($0, metrics[m]) + 0
+				change = old > 0 ? (new - old) * 100 / old : (new > 0 ? 100 : 0)
+				regressed = change > threshold
+				failed = failed || regressed
+
+				printf "%-12s %-12s %12.3f %12.3f %+8.1f%%%s\n", name, metrics[m], \
+					old, new, change, regressed ? "  REGRESSION" : ""
+			}
+		}
+
+		END {
+			exit failed
+		}
+	' "$1" "$2"
+}
+
+main() {
+	command="run"
+
+	while [ $# -gt 0 ]; do
+		case "$1" in
+			"run" | "save" | "compare" | "startup" | "stress")
+				command="$1"
+				;;
+			"versus")
+				command="$1"
+				old="$2"
+				new="$3"
+				shift 2
+				;;
+			"-t")
+				shift
+				THRESHOLD="$1"
+				;;
+			"-s")
+				shift
+				SCENARIOS="$1"
+				;;
+			"-n")
+				shift
+				RUNS="$1"
+				;;
+			"-h" | "--help")
+				print_help
+				exit 0
+				;;
+			*)
+				echo "'$1' is not a valid argument!"
+				print_help
+				exit 1
+				;;
+		esac
+		shift
+	done
+
+	case "$command" in
+		"run")
+			run_scenarios "$RESULTS"
+			echo "Results written to $RESULTS"
+			;;
+		"startup")
+			run_startup
+			;;
+		"stress")
+			if [ ! -x "$BENCH" ]; then
+				echo "$BENCH does not exist, build it with ./build.sh linux -B"
+				exit 1
+			fi
+
+			$BENCH --queue-stress
+			;;
+		"versus")
+			BENCH="$old"
+			run_scenarios "$VERSUS"
+			BENCH="$new"
+			run_scenarios "$RESULTS"
+
+			if ! compare_results "$VERSUS" "$RESULTS"; then
+				echo "Some metrics got more than $THRESHOLD% worse with $new!"
+				exit 1
+			fi
+			;;
+		"save")
+			run_scenarios "$BASELINE"
+			echo "Baseline written to $BASELINE"
+			;;
+		"compare")
+			if [ ! -f "$BASELINE" ]; then
+				echo "There is no baseline, create one with $0 save"
+				exit 1
+			fi
+
+			run_scenarios "$RESULTS"
+
+			if ! compare_results "$BASELINE" "$RESULTS"; then
+				echo "Some metrics regressed more than $THRESHOLD%!"
+				exit 1
+			fi
+			;;
+	esac
+}
+
+main "$@"
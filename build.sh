@@ -6,6 +6,8 @@ WINDOWS=0
 LINUX=0
 ANDROID=0
 REBUILD=0
+PGO=0
+ASSETS=0
 BUILD_INPUTS="src/main.c"
 BUILD_FLAGS="-O3 -ggdb"
 WARNING_FLAGS="-Wall -Wextra -Wshadow"
@@ -15,17 +17,139 @@ MAINTAINER="lucasta"
 SOURCE="https://dl.google.com/android/repository/"
 CMD_TOOLS="commandlinetools-linux-10406996_latest.zip"
 NDK="android-ndk-r26b"
+PGO_DIR="$PWD/build/pgo"
+PGO_SCENARIOS="spin menu-scroll typing"
+# glyphs baked into the font, add any character the ui draws or a text field
+# accepts here and regenerate the assets with -a
+FONT_GLYPHS=" !0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz|"
+BENCH_FLAGS="-DRELEASE -DBENCH -DMAX_SLICES=100000 \
+	-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc"
 
 print_help() {
 	printf \
-		"%s [windows|linux|android] [-r -R -b]
+		"%s [windows|linux|android] [-r -R -B -P -a -b]
 
 -r           runs after building
 -R           builds with -DRELEASE, disabling debug mode features
+-B           builds pickle-bench, the headless benchmark binary used by bench.sh (linux only)
+-P           builds pickle and pickle-bench-pgo with profile guided optimization and lto,
+             trained on bench scenarios and the recordings in sessions/ (linux only)
+-a           regenerates the headers in assets/ from the source images and font (linux only)
 -b           rebuild raylib
 -h --help    show help\n" "$0"
 }
 
+# builds raylib into lib/$1 with extra cflags
+build_raylib() {
+	(
+		cd raylib/src/
+		make clean
+		make PLATFORM=PLATFORM_DESKTOP CUSTOM_CFLAGS="$2" AR=gcc-ar
+		mkdir --parents ../../lib/$1/
+		mv libraylib.a ../../lib/$1/
+		make clean
+	)
+}
+
+# the font source is not always around, its header is kept as is without it
+build_assets() {
+	mkdir --parents build
+	cc tools/assets.c -O2 $WARNING_FLAGS -I./raylib/src/ -L./lib/desktop/ \
+		-l:libraylib.a -lm -lz -o build/assets || exit 1
+
+	./build/assets image assets/MenuIcon.png assets/MenuIcon.h MENUICON -z
+	./build/assets image assets/TrashIcon.png assets/TrashIcon.h TRASHICON -z
+	./build/assets image assets/icon_xhdpi.png assets/icon_xhdpi.h WINDOWICON -z
+
+	if [ -f assets/iosevka-regular.ttf ]; then
+		./build/assets font assets/iosevka-regular.ttf assets/iosevka-regular.h \
+			IOSEVKA 32 "$FONT_GLYPHS" -z
+	else
+		echo "assets/iosevka-regular.ttf does not exist, keeping its header"
+
+		# the kept atlas can not follow FONT_GLYPHS, so it has to hold them already
+		wanted=$(printf '%s' "$FONT_GLYPHS" | od -An -tu1 -v | tr -s ' ' '\n' |
+			grep . | sort -n)
+		kept=$(sed -n 's/^\t{\([0-9]*\), .*, {0}},$/\1/p' \
+			assets/iosevka-regular.h | sort -n)
+
+		if [ "$wanted" != "$kept" ]; then
+			echo "FONT_GLYPHS changed, add the ttf to bake them into the atlas"
+			exit 1
+		fi
+	fi
+}
+
+# compiles through a fixed object path so every build finds the same profile
+build_pgo_binary() {
+	mkdir --parents "$PGO_DIR"
+	gcc -c src/main.c -I./raylib/src/ -O3 -ggdb $WARNING_FLAGS -DPLATFORM_LINUX \
+		$2 $3 -o "$PGO_DIR/main.o"
+	gcc "$PGO_DIR/main.o" $2 $3 -L./lib/pgo/ -l:libraylib.a -lm -o $1
+}
+
+# instrumented build, training runs, then the optimized rebuild of both
+build_pgo() {
+	generate="-fprofile-generate=$PGO_DIR -fprofile-update=atomic"
+	use="-fprofile-use=$PGO_DIR -fprofile-partial-training \
+		-Wno-missing-profile -Wno-coverage-mismatch -flto=auto"
+	wrapper=""
+
+	if [ -z "$DISPLAY" ]; then
+		wrapper="xvfb-run -a"
+	fi
+
+	rm -rf "$PGO_DIR" ./lib/pgo/
+
+	echo "--------------------------------"
+	echo "Building instrumented binaries!"
+	echo "--------------------------------"
+
+	build_raylib pgo "$generate"
+	build_pgo_binary "$PROGRAM-bench" "$BENCH_FLAGS" "$generate"
+
+	echo "--------------------------------"
+	echo "Training!"
+	echo "--------------------------------"
+
+	for scenario in $PGO_SCENARIOS; do
+		echo "Running $scenario"
+		LIBGL_ALWAYS_SOFTWARE=1 $wrapper ./$PROGRAM-bench --bench "$scenario" \
+			--bench-out /dev/null >/dev/null 2>&1 || {
+			echo "'$scenario' failed!"
+			exit 1
+		}
+	done
+
+	for session in sessions/*.pkrec; do
+		[ -f "$session" ] || continue
+		echo "Replaying $session"
+		LIBGL_ALWAYS_SOFTWARE=1 $wrapper ./$PROGRAM-bench --replay "$session" \
+			--replay-fast >/dev/null 2>&1 || {
+			echo "'$session' failed!"
+			exit 1
+		}
+	done
+
+	echo "--------------------------------"
+	echo "Building optimized binaries!"
+	echo "--------------------------------"
+
+	build_raylib pgo "$use"
+	# the release build differs from the trained one only around the
+	# benchmark code, those functions are built without a profile
+	build_pgo_binary "$PROGRAM" "-DRELEASE" "$use"
+	build_pgo_binary "$PROGRAM-bench-pgo" "$BENCH_FLAGS" "$use"
+
+	# the plain benchmark binary to compare against
+	if [ ! -f ./lib/desktop/libraylib.a ]; then
+		build_raylib desktop ""
+	fi
+
+	gcc src/main.c $BUILD_FLAGS $BENCH_FLAGS $LINKING_FLAGS -o $PROGRAM-bench
+	./bench.sh versus ./$PROGRAM-bench ./$PROGRAM-bench-pgo || true
+}
+
 main() {
 	if [ "$1" = "windows" ]; then
 		WINDOWS=1
@@ -62,6 +186,32 @@ main() {
 			"-R")
 				BUILD_FLAGS="$BUILD_FLAGS -DRELEASE"
 				;;
+			"-B")
+				if [ "$LINUX" != 1 ]; then
+					echo "Benchmarks only build for linux!"
+					exit 1
+				fi
+
+				BUILD_FLAGS="$BUILD_FLAGS $BENCH_FLAGS"
+				BUILD_OUT="$PROGRAM-bench"
+				RUNCMD="./bench.sh run"
+				;;
+			"-P")
+				if [ "$LINUX" != 1 ]; then
+					echo "Profile guided builds only work on linux!"
+					exit 1
+				fi
+
+				PGO=1
+				;;
+			"-a")
+				if [ "$LINUX" != 1 ]; then
+					echo "Assets can only be generated on linux!"
+					exit 1
+				fi
+
+				ASSETS=1
+				;;
 			"--help")
 				print_help
 				exit 0
@@ -79,6 +229,11 @@ main() {
 	done
 
 	if [ "$LINUX" = 1 ] || [ "$WINDOWS" = 1 ]; then
+		if [ "$PGO" = 1 ]; then
+			build_pgo
+			exit 0
+		fi
+
 		if [ "$REBUILD" = 1 ] || [ ! -f ./lib/desktop/libraylib.a ]; then
 			rm -rf ./lib/desktop/
 			echo "--------------------------------"
@@ -99,6 +254,10 @@ main() {
 			)
 		fi
 
+		if [ "$ASSETS" = 1 ]; then
+			build_assets
+		fi
+
 		if [ "$WINDOWS" = 1 ]; then
 			x86_64-w64-mingw32-windres $PROGRAM.rc -O coff -o $PROGRAM.res --target=pe-x86-64
 		fi
@@ -0,0 +1,171 @@
+#ifndef PICKLE_ASSETS
+#define PICKLE_ASSETS
+
+#include <math.h>
+#include <string.h>
+
+#include "globals.c"
+#include "log.c"
+
+// Generated by tools/assets.c, regenerate them with ./build.sh linux -a
+#include "../assets/MenuIcon.h"
+#include "../assets/TrashIcon.h"
+#include "../assets/icon_xhdpi.h"
+#include "../assets/iosevka-regular.h"
+
+#define LoadEmbeddedImage(NAME)                               \
+	LoadEmbeddedImageData(NAME##_DATA, NAME##_SIZE,             \
+												NAME##_COMPRESSED_SIZE, NAME##_WIDTH, \
+												NAME##_HEIGHT, NAME##_FORMAT)
+#define UnloadEmbeddedImage(image, NAME) \
+	UnloadEmbeddedImageData(image, NAME##_DATA)
+
+// uncompressed images point straight at the embedded data, nothing is copied
+static Image LoadEmbeddedImageData(const unsigned char* data,
+																	 int size,
+																	 int compressedSize,
+																	 int width,
+																	 int height,
+																	 int format)
+{
+	// only checked in debug builds
+	(void)size;
+	Image image = {(void*)data, width, height, 1, format};
+
+	if (compressedSize > 0)
+	{
+		int decompressedSize = 0;
+		image.data = DecompressData(data, compressedSize, &decompressedSize);
+		LogIf(decompressedSize != size,
+					LogAppend("ASSETS: Expected %d bytes, decompressed %d\n", size,
+										decompressedSize););
+	}
+
+	return image;
+}
+
+static void UnloadEmbeddedImageData(Image image, const unsigned char* data)
+{
+	if (image.data != data)
+	{
+		UnloadImage(image);
+	}
+}
+
+// Everything the ui draws lives in one texture, so raylib never has to switch
+// textures and flush its batch. The font is at the origin so the embedded
+// glyph rectangles stay valid, everything else is placed on shelves below it
+#define ATLAS_SPACING 2
+#define ATLAS_WHITE_SIZE 4
+#define ATLAS_MIN_WIDTH 256
+// room below the font for the icons, the white block and the shadows
+#define ATLAS_SHELVES_HEIGHT 64
+
+static Texture2D Atlas = {0};
+static Rectangle AtlasWhite = {0};
+static int AtlasShelfX = 0;
+static int AtlasShelfY = 0;
+static int AtlasShelfHeight = 0;
+
+// copies an rgba image into the atlas row by row
+static void AtlasCopy(Image atlas, Image image, int x, int y)
+{
+	for (int row = 0; row < image.height; row++)
+	{
+		memcpy((unsigned char*)atlas.data + ((y + row) * atlas.width + x) * 4,
+					 (unsigned char*)image.data + row * image.width * 4,
+					 image.width * 4);
+	}
+}
+
+// copies an rgba image to the next free spot of the atlas, starting a new
+// shelf when the current one is full, and returns where it went
+static Rectangle AtlasPlace(Image* atlas, Image image)
+{
+	if (AtlasShelfX + image.width > atlas->width)
+	{
+		AtlasShelfX = 0;
+		AtlasShelfY += AtlasShelfHeight + ATLAS_SPACING;
+		AtlasShelfHeight = 0;
+	}
+
+	if (AtlasShelfY + image.height > atlas->height)
+	{
+		TraceLog(LOG_ERROR, "ATLAS: No room left for a %dx%d image", image.width,
+						 image.height);
+		return (Rectangle){0};
+	}
+
+	Rectangle place = {AtlasShelfX, AtlasShelfY, image.width, image.height};
+	AtlasCopy(*atlas, image, AtlasShelfX, AtlasShelfY);
+	AtlasShelfX += image.width + ATLAS_SPACING;
+	AtlasShelfHeight = fmax(AtlasShelfHeight, image.height);
+
+	return place;
+}
+
+// The font atlas is stored with one channel, it is widened to white with the
+// coverage in alpha since raylib would draw grayscale opaque. Sets
+// the icon rectangles, more images can be placed before LoadAtlas uploads it
+static Image GenAtlas(void)
+{
+	int width = fmax(IOSEVKA_WIDTH, ATLAS_MIN_WIDTH);
+	Image atlas = GenImageColor(
+			width, IOSEVKA_HEIGHT + ATLAS_SPACING + ATLAS_SHELVES_HEIGHT, BLANK);
+
+	Image font = LoadEmbeddedImage(IOSEVKA);
+	const unsigned char* coverage = font.data;
+	unsigned char* pixels = atlas.data;
+
+	for (int y = 0; y < IOSEVKA_HEIGHT; y++)
+	{
+		for (int x = 0; x < IOSEVKA_WIDTH; x++)
+		{
+			unsigned char* pixel = pixels + (y * width + x) * 4;
+			pixel[0] = pixel[1] = pixel[2] = 255;
+			pixel[3] = coverage[y * IOSEVKA_WIDTH + x];
+		}
+	}
+
+	UnloadEmbeddedImage(font, IOSEVKA);
+	AtlasShelfX = 0;
+	AtlasShelfY = IOSEVKA_HEIGHT + ATLAS_SPACING;
+	AtlasShelfHeight = 0;
+
+#define X(Name, NAME)                                \
+	Image Name##Image = LoadEmbeddedImage(NAME##ICON); \
+	Name##Icon = AtlasPlace(&atlas, Name##Image);      \
+	UnloadEmbeddedImage(Name##Image, NAME##ICON);
+	ICON_LIST
+#undef X
+
+	Image white = GenImageColor(ATLAS_WHITE_SIZE, ATLAS_WHITE_SIZE, WHITE);
+	AtlasWhite = AtlasPlace(&atlas, white);
+	UnloadImage(white);
+
+	return atlas;
+}
+
+// uploads the atlas and unloads the image, shapes are drawn from the white
+// block and Fonte from the font
+static void LoadAtlas(Image atlas)
+{
+	Atlas = LoadTextureFromImage(atlas);
+	SetTextureFilter(Atlas, TEXTURE_FILTER_BILINEAR);
+	UnloadImage(atlas);
+
+	// the middle of the block, so filtering never reaches its transparent edge
+	SetShapesTexture(Atlas, (Rectangle){AtlasWhite.x + 1, AtlasWhite.y + 1,
+																			AtlasWhite.width - 2,
+																			AtlasWhite.height - 2});
+
+	Fonte = (Font){0};
+	Fonte.baseSize = IOSEVKA_BASE_SIZE;
+	Fonte.glyphCount = IOSEVKA_GLYPH_COUNT;
+	Fonte.glyphPadding = IOSEVKA_GLYPH_PADDING;
+	Fonte.texture = Atlas;
+	// the glyph data is never unloaded, so it can point at the embedded data
+	Fonte.recs = (Rectangle*)IOSEVKA_RECS;
+	Fonte.glyphs = (GlyphInfo*)IOSEVKA_GLYPHS;
+}
+#endif	// PICKLE_ASSETS
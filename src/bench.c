@@ -0,0 +1,393 @@
+#ifndef PICKLE_BENCH
+#define PICKLE_BENCH
+
+// Headless benchmark scenarios, built with ./build.sh linux -B and driven by
+// bench.sh
+#ifndef BENCH
+#	define BenchConfigure(...)
+#	define BenchSetup(...)
+#	define BenchFrameEnd(...) false
+#else
+#	include <stdio.h>
+#	include <stdlib.h>
+#	include <string.h>
+#	include <time.h>
+
+#	include "globals.c"
+#	include "input.c"
+#	include "pace.c"
+#	include "profile.c"
+#	include "queue.c"
+#	include "stats.c"
+
+#	ifndef BENCH_MAX_FRAMES
+#		define BENCH_MAX_FRAMES 4096
+#	endif
+
+// frames left out of the results while caches and the driver warm up
+#	define BENCH_WARMUP_FRAMES 10
+#	define BENCH_WIDTH 1280
+#	define BENCH_HEIGHT 720
+#	define BENCH_SEED 1234
+// fixed timestep so every run animates the same way
+#	define BENCH_DELTA_TIME (1.0f / 60)
+
+typedef struct
+{
+	const char* Name;
+	int Scene;
+	int Slices;
+	int Frames;
+	void (*Input)(InputFrame* frame, int f);
+	bool (*Done)(void);
+} BenchScenario;
+
+static const BenchScenario* Bench = NULL;
+static const char* BenchOut = "pickle-bench.json";
+static int BenchFrame = 0;
+static float BenchFrameTimes[BENCH_MAX_FRAMES];
+static float BenchZoneTimes[ZONES_AMOUNT][BENCH_MAX_FRAMES];
+static clock_t BenchClock = 0;
+static unsigned long long BenchAllocations = 0;
+
+// counts allocations made by pickle and raylib, linked with --wrap=malloc
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size)
+{
+	BenchAllocations++;
+	return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+	BenchAllocations++;
+	return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+	BenchAllocations++;
+	return __real_realloc(ptr, size);
+}
+
+static void BenchIdleInput(InputFrame* frame, int f)
+{
+	(void)f;
+	frame->DeltaTime = BENCH_DELTA_TIME;
+}
+
+// clicks the middle of the wheel on the first frame
+static void BenchSpinInput(InputFrame* frame, int f)
+{
+	frame->DeltaTime = BENCH_DELTA_TIME;
+	frame->MouseX = BENCH_WIDTH / 2;
+	frame->MouseY = BENCH_HEIGHT / 2;
+	frame->MousePressed = f == 0;
+	frame->MouseDown = f == 0;
+	frame->MouseReleased = f == 1;
+}
+
+static bool BenchSpinDone(void)
+{
+	return WheelPickedIndex >= STATE_WINNER;
+}
+
+// scrolls down and back up every two seconds
+static void BenchScrollInput(InputFrame* frame, int f)
+{
+	frame->DeltaTime = BENCH_DELTA_TIME;
+	frame->MouseWheel = f / 60 % 2 == 0 ? -1 : 1;
+}
+
+// types a character every frame into the first slice, clearing it when full
+static void BenchTypingInput(InputFrame* frame, int f)
+{
+	static const char TEXT[] = "the quick brown fox jumps over the lazy dog ";
+
+	frame->DeltaTime = BENCH_DELTA_TIME;
+
+	if (strlen(Slices[0].Name) > 40)
+	{
+		frame->BackspaceDown = true;
+		frame->BackspacePressed = f % 2 == 0;
+	}
+	else
+	{
+		frame->Chars[frame->CharCount++] = TEXT[f % (sizeof(TEXT) - 1)];
+	}
+}
+
+static const BenchScenario BENCH_SCENARIOS[] = {
+		{"idle", SCENE_WHEEL, 0, 600, BenchIdleInput, NULL},
+		{"spin", SCENE_WHEEL, COLORS_AMOUNT, BENCH_MAX_FRAMES, BenchSpinInput,
+		 BenchSpinDone},
+		{"menu-scroll", SCENE_MENU, COLORS_AMOUNT, 600, BenchScrollInput, NULL},
+		{"typing", SCENE_MENU, COLORS_AMOUNT, 600, BenchTypingInput, NULL},
+		{"list-1k", SCENE_MENU, 1000, 300, BenchScrollInput, NULL},
+		{"list-10k", SCENE_MENU, 10000, 100, BenchScrollInput, NULL},
+		{"list-100k", SCENE_MENU, 100000, 30, BenchScrollInput, NULL},
+};
+
+static void BenchInput(InputFrame* frame)
+{
+	Bench->Input(frame, BenchFrame);
+}
+
+#	ifdef PLATFORM_LINUX
+#		include <pthread.h>
+#		include <sched.h>
+
+// characters pushed through the queue by the stress test
+#		define BENCH_QUEUE_CHARACTERS 10000000
+
+// every size of utf-8 in turn, with a backspace every fifth character
+static int BenchQueueCodepoint(int i)
+{
+	static const int FIRST[] = {'a', 0xE0, 0x4E00, 0x1F600};
+
+	return i % 5 == 4 ? QUEUE_BACKSPACE : FIRST[i % 5] + i / 5 % 26;
+}
+
+// pushes the characters up to every backspace as one string, and whatever did
+// not fit again
+static void* BenchQueueProducer(void* queue)
+{
+	char text[32];
+
+	for (int i = 0; i < BENCH_QUEUE_CHARACTERS;)
+	{
+		int length = 0;
+		int pushed;
+
+		for (int c = i; c % 5 != 4 && c < BENCH_QUEUE_CHARACTERS; c++)
+		{
+			length += QueueEncode(BenchQueueCodepoint(c), text + length);
+		}
+
+		text[length] = '\0';
+		pushed = length > 0 ? QueuePushText(queue, text)
+												: QueuePush(queue, QUEUE_BACKSPACE);
+
+		// lets the consumer run when both share a core
+		if (pushed == 0)
+		{
+			sched_yield();
+		}
+
+		i += pushed;
+	}
+
+	return NULL;
+}
+
+// Hammers the text queue from two threads and checks every character comes
+// out whole and in order, returns the exit code
+static int BenchQueueStress(void)
+{
+	static Queue queue = {0};
+	pthread_t producer;
+	struct timespec start, end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	pthread_create(&producer, NULL, BenchQueueProducer, &queue);
+
+	int failed = -1;
+
+	for (int i = 0; i < BENCH_QUEUE_CHARACTERS;)
+	{
+		int c = QueuePop(&queue);
+
+		if (c == 0)
+		{
+			sched_yield();
+			continue;
+		}
+
+		if (c != BenchQueueCodepoint(i) && failed < 0)
+		{
+			failed = i;
+		}
+
+		i++;
+	}
+
+	pthread_join(producer, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double ms = (end.tv_sec - start.tv_sec) * 1000.0 +
+							(end.tv_nsec - start.tv_nsec) / 1000000.0;
+
+	if (failed >= 0)
+	{
+		TraceLog(LOG_ERROR, "BENCH: Character %d came out of the queue wrong",
+						 failed);
+		return 1;
+	}
+
+	TraceLog(LOG_INFO, "BENCH: %d characters through the queue in %.1f ms",
+					 BENCH_QUEUE_CHARACTERS, ms);
+	return 0;
+}
+#	else
+#		define BenchQueueStress(...) 1
+#	endif
+
+// picks the scenario from the command line, before the window exists
+static bool BenchStart(const char* name)
+{
+	for (size_t i = 0; i < ARRAY_LENGTH(BENCH_SCENARIOS); i++)
+	{
+		if (strcmp(BENCH_SCENARIOS[i].Name, name) == 0)
+		{
+			Bench = &BENCH_SCENARIOS[i];
+			return true;
+		}
+	}
+
+	TraceLog(LOG_ERROR, "BENCH: Unknown scenario '%s'", name);
+	return false;
+}
+
+static void BenchConfigure(void)
+{
+	if (Bench == NULL)
+	{
+		return;
+	}
+
+	SetConfigFlags(FLAG_WINDOW_HIDDEN);
+	ScreenWidth = BENCH_WIDTH;
+	ScreenHeight = BENCH_HEIGHT;
+}
+
+static void BenchSetup(void)
+{
+	if (Bench == NULL)
+	{
+		return;
+	}
+
+	if (Bench->Slices > MAX_SLICES)
+	{
+		TraceLog(LOG_WARNING, "BENCH: '%s' wants %d slices, MAX_SLICES is %d",
+						 Bench->Name, Bench->Slices, MAX_SLICES);
+	}
+
+	PaceSetTarget(0);
+	SetRandomSeed(BENCH_SEED);
+	InputSource = BenchInput;
+	CurrentScene = Bench->Scene;
+	SlicesCount = 0;
+
+	for (int i = 0; i < Bench->Slices && i < MAX_SLICES; i++)
+	{
+		Slices[i] = DEFAULT_SLICES[i % COLORS_AMOUNT];
+		SlicesCount++;
+	}
+
+	if (Bench->Input == BenchTypingInput)
+	{
+		TypingIndex = 0;
+	}
+}
+
+static int BenchCompare(const void* a, const void* b)
+{
+	float difference = *(const float*)a - *(const float*)b;
+	return (difference > 0) - (difference < 0);
+}
+
+// sorts the samples in place
+static float BenchPercentile(float* samples, int count, int percentile)
+{
+	qsort(samples, count, sizeof(float), BenchCompare);
+	return samples[(count - 1) * percentile / 100];
+}
+
+static void BenchWrite(void)
+{
+	int count = BenchFrame - BENCH_WARMUP_FRAMES;
+	float* frameTimes = BenchFrameTimes + BENCH_WARMUP_FRAMES;
+	double total = 0;
+
+	for (int f = 0; f < count; f++)
+	{
+		total += frameTimes[f];
+	}
+
+	FILE* file = fopen(BenchOut, "a");
+
+	if (file == NULL)
+	{
+		TraceLog(LOG_ERROR, "BENCH: Could not open %s", BenchOut);
+		return;
+	}
+
+	fprintf(file,
+					"{\"scenario\":\"%s\",\"slices\":%d,\"frames\":%d,\"frame_ms\":{"
+					"\"mean\":%.4f,",
+					Bench->Name, SlicesCount, count, total / count);
+	fprintf(file, "\"p50\":%.4f,", BenchPercentile(frameTimes, count, 50));
+	fprintf(file, "\"p95\":%.4f,", BenchPercentile(frameTimes, count, 95));
+	fprintf(file, "\"p99\":%.4f,", BenchPercentile(frameTimes, count, 99));
+	// sorted by the percentiles above
+	fprintf(file, "\"max\":%.4f},\"zones_p50_ms\":{", frameTimes[count - 1]);
+
+	for (int z = 0; z < ZONES_AMOUNT; z++)
+	{
+		float* zoneTimes = BenchZoneTimes[z] + BENCH_WARMUP_FRAMES;
+		fprintf(file, "%s\"%s\":%.4f", z > 0 ? "," : "", ZONE_NAMES[z],
+						BenchPercentile(zoneTimes, count, 50));
+	}
+
+	fprintf(file, "},\"cpu_ms\":%.3f,\"allocations\":%llu,\"stats\":",
+					(double)(clock() - BenchClock) * 1000 / CLOCKS_PER_SEC,
+					BenchAllocations);
+	StatsWriteJson(file);
+	fprintf(file, "}\n");
+	fclose(file);
+}
+
+// returns true once the scenario is over and the results are written
+static bool BenchFrameEnd(void)
+{
+	if (Bench == NULL)
+	{
+		return false;
+	}
+
+	BenchFrameTimes[BenchFrame] = ZoneLastFrame[ZONE_FRAME];
+
+	for (int z = 0; z < ZONES_AMOUNT; z++)
+	{
+		BenchZoneTimes[z][BenchFrame] = ZoneLastFrame[z];
+	}
+
+	BenchFrame++;
+
+	if (BenchFrame == BENCH_WARMUP_FRAMES)
+	{
+		BenchClock = clock();
+		BenchAllocations = 0;
+		memset(StatsTotal, 0, sizeof(StatsTotal));
+		memset(StatsScene, 0, sizeof(StatsScene));
+		StatsFrames = 0;
+		memset(StatsSceneFrames, 0, sizeof(StatsSceneFrames));
+	}
+
+	bool done = BenchFrame >= Bench->Frames || BenchFrame >= BENCH_MAX_FRAMES ||
+							(Bench->Done != NULL && Bench->Done());
+
+	if (done && BenchFrame > BENCH_WARMUP_FRAMES)
+	{
+		BenchWrite();
+	}
+
+	return done;
+}
+#endif	// BENCH
+
+#endif	// PICKLE_BENCH
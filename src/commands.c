@@ -0,0 +1,213 @@
+#ifndef PICKLE_COMMANDS
+#define PICKLE_COMMANDS
+
+#include <string.h>
+
+#include "edit.c"
+#include "globals.c"
+#include "history.c"
+#include "log.c"
+#include "trace.c"
+
+// Buttons push what they do instead of doing it, and the queue is applied in
+// one go after the frame is drawn, so nothing the draw pass is iterating over
+// changes under it. Slice indices are the ones the frame was drawn with, and
+// every slice edit goes through here into the history
+#define COMMAND_LIST                    \
+	X(AddEntry, ADD_ENTRY)                \
+	X(RemoveEntry, REMOVE_ENTRY)          \
+	X(Recolor, RECOLOR)                   \
+	X(SelectTextField, SELECT_TEXT_FIELD) \
+	X(ToggleMenu, TOGGLE_MENU)            \
+	X(Undo, UNDO)                         \
+	X(Redo, REDO)
+
+#define X(Name, NAME) COMMAND_##NAME,
+enum CommandEnum
+{
+	COMMAND_NONE,
+	COMMAND_LIST COMMANDS_AMOUNT
+};
+#undef X
+
+#define X(Name, NAME) #Name,
+static const char* COMMAND_NAMES[] = {"None", COMMAND_LIST};
+#undef X
+
+typedef struct
+{
+	int Kind;
+	int Slice;
+	// the color of a recolor
+	int Value;
+} Command;
+
+#define COMMAND(kind, slice, value) \
+	((Command){COMMAND_##kind, (slice), (value)})
+
+// far more than a frame can push, only key repeats push more than one
+#define COMMAND_QUEUE 64
+
+static const Command NO_COMMAND = {0};
+static Command Commands[COMMAND_QUEUE];
+static int CommandCount = 0;
+
+static void CommandPush(Command command)
+{
+	// a later recolor of the same slice in the frame replaces the earlier one
+	for (int i = 0; i < CommandCount && command.Kind == COMMAND_RECOLOR; i++)
+	{
+		if (Commands[i].Kind == COMMAND_RECOLOR &&
+				Commands[i].Slice == command.Slice)
+		{
+			Commands[i].Value = command.Value;
+			return;
+		}
+	}
+
+	LogIf(CommandCount >= COMMAND_QUEUE,
+				LogAppend("ERROR: The command queue is full!\n"));
+
+	if (CommandCount < COMMAND_QUEUE)
+	{
+		Commands[CommandCount++] = command;
+	}
+}
+
+static void CommandApply(Command command)
+{
+	switch (command.Kind)
+	{
+		case COMMAND_ADD_ENTRY:
+		{
+			if (SlicesCount >= MAX_SLICES)
+			{
+				break;
+			}
+
+			const Slice* defaultSlice = &DEFAULT_SLICES[SlicesCount % COLORS_AMOUNT];
+			strncpy(Slices[SlicesCount].Name, defaultSlice->Name, SLICE_NAME_SIZE);
+			Slices[SlicesCount].Color = defaultSlice->Color;
+			SlicesCount++;
+			HistoryAdded(SlicesCount - 1);
+		}
+		break;
+		case COMMAND_REMOVE_ENTRY:
+			if (TypingIndex == command.Slice)
+			{
+				HistoryRenameEnd();
+			}
+
+			HistoryRemoving(command.Slice);
+			SliceRemove(command.Slice);
+
+			if (TypingIndex == command.Slice)
+			{
+				TypingIndex = -1;
+			}
+			else if (TypingIndex > command.Slice)
+			{
+				TypingIndex--;
+			}
+			break;
+		case COMMAND_RECOLOR:
+		{
+			int before = Slices[command.Slice].Color;
+			Slices[command.Slice].Color = command.Value;
+
+			if (before != command.Value)
+			{
+				HistoryRecolored(command.Slice, before);
+			}
+		}
+		break;
+		case COMMAND_SELECT_TEXT_FIELD:
+			HistoryRenameEnd();
+			TypingIndex = command.Slice;
+
+			if (TypingIndex >= 0)
+			{
+				HistoryRenameBegin(TypingIndex);
+			}
+			break;
+		case COMMAND_TOGGLE_MENU:
+			CurrentScene = !CurrentScene;
+			break;
+		case COMMAND_UNDO:
+		case COMMAND_REDO:
+			// what was typed so far is undone first, and indices may move
+			HistoryRenameEnd();
+			TypingIndex = -1;
+
+			if (command.Kind == COMMAND_UNDO)
+			{
+				HistoryUndo();
+			}
+			else
+			{
+				HistoryRedo();
+			}
+			break;
+	}
+}
+
+static bool CommandHasSlice(int kind)
+{
+	return kind == COMMAND_REMOVE_ENTRY || kind == COMMAND_RECOLOR ||
+				 kind == COMMAND_SELECT_TEXT_FIELD;
+}
+
+// call once the frame is drawn
+static void CommandsApply(void)
+{
+	HistoryStepBegin();
+
+	for (int i = 0; i < CommandCount; i++)
+	{
+		Command command = Commands[i];
+
+		if (command.Kind == COMMAND_NONE ||
+				(CommandHasSlice(command.Kind) && command.Slice >= SlicesCount))
+		{
+			continue;
+		}
+
+		TraceInstant("command", COMMAND_NAMES[command.Kind], command.Slice);
+		CommandApply(command);
+
+		if (command.Kind != COMMAND_REMOVE_ENTRY)
+		{
+			continue;
+		}
+
+		// the slices after the removed one moved up
+		for (int j = i + 1; j < CommandCount; j++)
+		{
+			if (!CommandHasSlice(Commands[j].Kind))
+			{
+				continue;
+			}
+
+			if (Commands[j].Slice == command.Slice)
+			{
+				Commands[j].Kind = COMMAND_NONE;
+			}
+			else if (Commands[j].Slice > command.Slice)
+			{
+				Commands[j].Slice--;
+			}
+		}
+	}
+
+	// the name is taken again once typing moved, it may have been undone, and
+	// nothing typed for the last field ends up in the next one
+	if (Edit.Slice != TypingIndex)
+	{
+		Edit.Slice = -1;
+		InputDropChars();
+	}
+
+	CommandCount = 0;
+}
+
+#endif	// PICKLE_COMMANDS
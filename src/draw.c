@@ -3,14 +3,22 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include "commands.c"
+#include "edit.c"
 #include "globals.c"
+#include "hit.c"
+#include "input.c"
+#include "layout.c"
 #include "log.c"
-#include <ctype.h>
+#include "profile.c"
+#include "stats.c"
+#include "text.c"
 
 #define CONTRAST_LIMIT 90
 
 #define IsPointInsideRect(x, y, recX, recY, recWidth, recHeight) \
-	(x >= recX && x <= recX + recWidth && y >= recY && y <= recY + recHeight)
+	(Stats[STAT_HIT_TESTS]++,                                      \
+	 x >= recX && x <= recX + recWidth && y >= recY && y <= recY + recHeight)
 
 // picks between black and white depending on the passed color
 #define GetContrastedTextColor(color) \
@@ -30,6 +38,7 @@ typedef enum
 	ShadowKind_Pillar,
 	ShadowKind_Cube,
 	ShadowKind_TransparentCube,
+	SHADOW_KINDS_AMOUNT,
 } ShadowKind;
 
 typedef struct
@@ -41,7 +50,7 @@ typedef struct
 
 typedef struct
 {
-	int Width;
+	Size Width;
 	Color Color;
 	Color BorderColor;
 	int BorderThickness;
@@ -49,14 +58,14 @@ typedef struct
 
 typedef struct
 {
-	int Height;
+	Size Height;
 	int ColumnCount;
 	Column* Columns;
 } Row;
 
 typedef struct
 {
-	int WidthPercentage;
+	Size Width;
 	char* Text;
 	int FontSize;
 	bool RepeatPresses;
@@ -67,80 +76,297 @@ typedef struct
 	Color BorderColor;
 	int BorderThickness;
 	ShadowStyle ShadowStyle;
-	Texture2D Icon;
-	void (*Callback)(void* CallbackArgs);
-	void* CallbackArgs;
+	// in the atlas, empty for no icon
+	Rectangle Icon;
+	Command Command;
 } Button;
 
 typedef struct
 {
-	int HeightPercentage;
+	Size Height;
 	int ColumnAmount;
 	Button* Columns;
 } ButtonRow;
 
 static const ShadowStyle NO_SHADOW = {0};
-static const Texture2D NO_ICON = {0};
-static const Rectangle ICON_RECTANGLE = {0, 0, 24, 24};
+static const Rectangle NO_ICON = {0};
 
-static void DrawShadow(int x,
-											 int y,
-											 int width,
-											 int height,
-											 ShadowStyle shadowStyle,
-											 Color outlineColor)
+// Every kind of shadow is baked once into the atlas as two nine-patches, the
+// fill and the outlines, so they can be tinted separately. The corners are
+// baked for a SHADOW_PATCH pixel distance and scaled to the real one, the
+// middle is a single texel stretched over the widget. Empty cells of a patch
+// are not drawn, and a patch whose cells are all filled, like the fill of a
+// float shadow, is a single quad
+#define SHADOW_PATCH 8
+#define SHADOW_PATCH_SIZE (SHADOW_PATCH * 2 + 1)
+
+typedef struct
+{
+	Rectangle Source;
+	// bit row * 3 + column for every cell of the nine with a pixel set
+	unsigned short Cells;
+	// the cells make a rectangle without a hole, from the first to the last
+	bool Solid;
+	unsigned char First;
+	unsigned char Last;
+} ShadowPatch;
+
+static ShadowPatch ShadowFills[SHADOW_KINDS_AMOUNT] = {0};
+static ShadowPatch ShadowOutlines[SHADOW_KINDS_AMOUNT] = {0};
+
+// x and y are in the baked patch, the widget covers its top left corner and
+// the shadow is the widget moved down and right by the distance
+static bool ShadowFilled(ShadowKind kind, int x, int y)
 {
-	DrawRectangle(x + shadowStyle.Distance, y + shadowStyle.Distance, width,
-								height, shadowStyle.Color);
+	bool right = x > SHADOW_PATCH;
+	bool bottom = y > SHADOW_PATCH;
+
+	if (x >= SHADOW_PATCH && y >= SHADOW_PATCH)
+	{
+		return true;
+	}
 
-	if (shadowStyle.Kind != ShadowKind_Float)
+	if (kind == ShadowKind_Float)
 	{
-		// top right corner
-		DrawTriangle(
-				(Vector2){x + shadowStyle.Distance, y + height},
-				(Vector2){x, y + height},
-				(Vector2){x + shadowStyle.Distance, y + height + shadowStyle.Distance},
-				shadowStyle.Color);
+		return false;
+	}
+
+	// the sides the widget sweeps over on its way to the shadow
+	if (right && y < SHADOW_PATCH)
+	{
+		return x - SHADOW_PATCH - 1 <= y;
+	}
+
+	if (bottom && x < SHADOW_PATCH)
+	{
+		return x >= y - SHADOW_PATCH - 1;
+	}
+
+	return false;
+}
 
-		// bottom left corner
-		DrawTriangle(
-				(Vector2){x + width, y}, (Vector2){x + width, y + shadowStyle.Distance},
-				(Vector2){x + width + shadowStyle.Distance, y + shadowStyle.Distance},
-				shadowStyle.Color);
+static bool ShadowOutlined(ShadowKind kind, int x, int y)
+{
+	int last = SHADOW_PATCH_SIZE - 1;
+	bool right = x > SHADOW_PATCH;
+	bool bottom = y > SHADOW_PATCH;
 
-		if (shadowStyle.Kind != ShadowKind_Cast)
+	if (kind == ShadowKind_Float || kind == ShadowKind_Cast)
+	{
+		return false;
+	}
+
+	if (kind == ShadowKind_Cube &&
+			((x == last && y >= SHADOW_PATCH) || (y == last && x >= SHADOW_PATCH)))
+	{
+		return true;
+	}
+
+	if (kind == ShadowKind_TransparentCube && x >= SHADOW_PATCH - 1 &&
+			y >= SHADOW_PATCH - 1 &&
+			(x == SHADOW_PATCH - 1 || x == last || y == SHADOW_PATCH - 1 ||
+			 y == last))
+	{
+		return true;
+	}
+
+	// the edges between the corners of the widget and the shadow
+	return (right && y < SHADOW_PATCH && x - SHADOW_PATCH - 1 == y) ||
+				 (bottom && x < SHADOW_PATCH && x == y - SHADOW_PATCH - 1) ||
+				 (right && bottom && x == y);
+}
+
+// which of the nine cells of a patch the pixel is in, row * 3 + column
+static int ShadowCell(int x, int y)
+{
+	int column = x < SHADOW_PATCH ? 0 : x == SHADOW_PATCH ? 1 : 2;
+	int row = y < SHADOW_PATCH ? 0 : y == SHADOW_PATCH ? 1 : 2;
+
+	return row * 3 + column;
+}
+
+// gaps are the cells with a pixel that is not set
+static ShadowPatch ShadowPatchPlace(Image* atlas,
+																		Image image,
+																		unsigned short cells,
+																		unsigned short gaps)
+{
+	ShadowPatch patch = {AtlasPlace(atlas, image), cells, false, 9, 0};
+	unsigned short bounds = 0;
+
+	for (int i = 0; i < 9; i++)
+	{
+		if (cells & 1 << i)
 		{
-			if (shadowStyle.Kind == ShadowKind_Cube)
+			patch.First = fmin(patch.First, i);
+			patch.Last = i;
+		}
+	}
+
+	for (int row = patch.First / 3; row <= patch.Last / 3 && cells != 0; row++)
+	{
+		for (int column = patch.First % 3; column <= patch.Last % 3; column++)
+		{
+			bounds |= 1 << (row * 3 + column);
+		}
+	}
+
+	patch.Solid = cells != 0 && cells == bounds && (cells & gaps) == 0;
+	return patch;
+}
+
+// call after GenAtlas and before LoadAtlas
+static void BakeShadows(Image* atlas)
+{
+	for (int k = 0; k < SHADOW_KINDS_AMOUNT; k++)
+	{
+		Image fill = GenImageColor(SHADOW_PATCH_SIZE, SHADOW_PATCH_SIZE, BLANK);
+		Image outline = GenImageColor(SHADOW_PATCH_SIZE, SHADOW_PATCH_SIZE, BLANK);
+		unsigned short fillCells = 0;
+		unsigned short fillGaps = 0;
+		unsigned short outlineCells = 0;
+
+		for (int y = 0; y < SHADOW_PATCH_SIZE; y++)
+		{
+			for (int x = 0; x < SHADOW_PATCH_SIZE; x++)
 			{
-				// left cube shadow outline
-				DrawLine(x + width + shadowStyle.Distance, y + shadowStyle.Distance,
-								 x + width + shadowStyle.Distance,
-								 y + height + shadowStyle.Distance, outlineColor);
-
-				// bottom cube shadow outline
-				DrawLine(x + shadowStyle.Distance, y + height + shadowStyle.Distance,
-								 x + width + shadowStyle.Distance,
-								 y + height + shadowStyle.Distance, outlineColor);
+				int cell = 1 << ShadowCell(x, y);
+
+				if (ShadowFilled(k, x, y))
+				{
+					ImageDrawPixel(&fill, x, y, WHITE);
+					fillCells |= cell;
+				}
+				else
+				{
+					fillGaps |= cell;
+				}
+
+				if (ShadowOutlined(k, x, y))
+				{
+					ImageDrawPixel(&outline, x, y, WHITE);
+					outlineCells |= cell;
+				}
 			}
-			else if (shadowStyle.Kind == ShadowKind_TransparentCube)
+		}
+
+		ShadowFills[k] = ShadowPatchPlace(atlas, fill, fillCells, fillGaps);
+		// outlines are lines, never solid
+		ShadowOutlines[k] = ShadowPatchPlace(atlas, outline, outlineCells, 0x1FF);
+		UnloadImage(fill);
+		UnloadImage(outline);
+	}
+}
+
+static void DrawShadowQuad(float left,
+													 float top,
+													 float right,
+													 float bottom,
+													 Rectangle uv)
+{
+	rlTexCoord2f(uv.x, uv.y);
+	rlVertex2f(left, top);
+	rlTexCoord2f(uv.x, uv.height);
+	rlVertex2f(left, bottom);
+	rlTexCoord2f(uv.width, uv.height);
+	rlVertex2f(right, bottom);
+	rlTexCoord2f(uv.width, uv.y);
+	rlVertex2f(right, top);
+}
+
+// draws the cells of a baked patch that have anything in them in one go, the
+// corners are border pixels big
+static void DrawShadowPatch(const ShadowPatch* patch,
+														Rectangle dest,
+														float border,
+														Color color)
+{
+	Rectangle source = patch->Source;
+	float x[4] = {dest.x, dest.x + border, dest.x + dest.width - border,
+								dest.x + dest.width};
+	float y[4] = {dest.y, dest.y + border, dest.y + dest.height - border,
+								dest.y + dest.height};
+	// the middle samples the center of its texel so it never blends with the
+	// corners
+	float u[6] = {source.x,
+								source.x + SHADOW_PATCH,
+								source.x + SHADOW_PATCH + 0.5f,
+								source.x + SHADOW_PATCH + 0.5f,
+								source.x + SHADOW_PATCH + 1,
+								source.x + source.width};
+	float v[6] = {source.y,
+								source.y + SHADOW_PATCH,
+								source.y + SHADOW_PATCH + 0.5f,
+								source.y + SHADOW_PATCH + 0.5f,
+								source.y + SHADOW_PATCH + 1,
+								source.y + source.height};
+	int quads = 0;
+
+	if (patch->Cells == 0)
+	{
+		return;
+	}
+
+	rlSetTexture(Atlas.id);
+	rlBegin(RL_QUADS);
+	rlColor4ub(color.r, color.g, color.b, color.a);
+
+	if (patch->Solid)
+	{
+		// every texel of the cells is set, so the middle one stands for all
+		Rectangle uv = {u[2] / Atlas.width, v[2] / Atlas.height,
+										u[3] / Atlas.width, v[3] / Atlas.height};
+		DrawShadowQuad(x[patch->First % 3], y[patch->First / 3],
+									 x[patch->Last % 3 + 1], y[patch->Last / 3 + 1], uv);
+		quads = 1;
+	}
+	else
+	{
+		for (int cell = 0; cell < 9; cell++)
+		{
+			int row = cell / 3;
+			int col = cell % 3;
+
+			if (patch->Cells & 1 << cell)
 			{
-				DrawRectangleLines(x + shadowStyle.Distance, y + shadowStyle.Distance,
-													 width, height, outlineColor);
+				Rectangle uv = {u[col * 2] / Atlas.width, v[row * 2] / Atlas.height,
+												u[col * 2 + 1] / Atlas.width,
+												v[row * 2 + 1] / Atlas.height};
+				DrawShadowQuad(x[col], y[row], x[col + 1], y[row + 1], uv);
+				quads++;
 			}
+		}
+	}
 
-			// top right outline
-			DrawLine(x + width, y, x + width + shadowStyle.Distance,
-							 y + shadowStyle.Distance, outlineColor);
+	rlEnd();
+	rlSetTexture(0);
+	StatDraw(STAT_MODE_QUADS, Atlas.id, quads * 4);
+}
 
-			// bottom left outline
-			DrawLine(x, y + height, x + shadowStyle.Distance,
-							 y + height + shadowStyle.Distance, outlineColor);
+// the shadow and its outlines come from the atlas like everything else, so
+// they never break the batch
+static void DrawShadow(int x,
+											 int y,
+											 int width,
+											 int height,
+											 ShadowStyle shadowStyle,
+											 Color outlineColor)
+{
+	int distance = shadowStyle.Distance;
+	Rectangle dest = {x, y, width + distance, height + distance};
+	// the corners can not overlap on widgets smaller than the distance
+	float border = fmin(distance, fmin(width, height));
 
-			// bottom right outline
-			DrawLine(x + width, y + height, x + width + shadowStyle.Distance,
-							 y + height + shadowStyle.Distance, outlineColor);
-		}
+	if (distance <= 0)
+	{
+		return;
 	}
+
+	// kinds without outlines have an empty outline patch, drawn as nothing
+	DrawShadowPatch(&ShadowFills[shadowStyle.Kind], dest, border,
+									shadowStyle.Color);
+	DrawShadowPatch(&ShadowOutlines[shadowStyle.Kind], dest, border,
+									outlineColor);
 }
 
 static void DrawTextBox(int x,
@@ -155,6 +381,8 @@ static void DrawTextBox(int x,
 												int borderThickness,
 												ShadowStyle shadowStyle)
 {
+	Stats[STAT_TEXT_BOXES]++;
+
 	LogIf((strcmp(text, "") != 0) && CheckBadContrast(backgroundColor, textColor),
 				LogAppend("ERROR: The text at the %d,%d text box is not visible!\n", x,
 									y));
@@ -168,7 +396,8 @@ static void DrawTextBox(int x,
 
 	do
 	{
-		textSize = MeasureTextEx(Fonte, text, fontSize, TEXT_SPACING);
+		ProfileZone(ZONE_TEXT_MEASURE,
+								textSize = TextMeasure(text, fontSize, TEXT_SPACING););
 		fontSize -= 1;
 	} while (textSize.x > width || textSize.y > height);
 
@@ -198,11 +427,12 @@ static void DrawTextBox(int x,
 		DrawRectangleLinesEx(rect, Padding, borderColor);
 	}
 
-	DrawTextEx(Fonte, text, (Vector2){textX, textY}, fontSize, TEXT_SPACING,
-						 textColor);
+	TextDraw(text, (Vector2){textX, textY}, fontSize, TEXT_SPACING, textColor);
 }
 
-static void DrawRectangleGrid(int x,
+// layout keeps the cells between calls, NULL solves them every call
+static void DrawRectangleGrid(GridLayout* layout,
+															int x,
 															int y,
 															int width,
 															int height,
@@ -210,52 +440,104 @@ static void DrawRectangleGrid(int x,
 															const Row* rows,
 															int rows_amount)
 {
-	int availableHeight = height - (padding * (rows_amount - 1));
-	int curY = y;
-	int takenHeight = 0;
+	GridLayout local = GRID_LAYOUT_EMPTY;
+	layout = layout != NULL ? layout : &local;
+	rows_amount = fmin(rows_amount, LAYOUT_MAX_ROWS);
+	LAYOUT_GRID(layout, width, height, padding, rows, rows_amount, ColumnCount);
 
-	for (int i = 0; i < rows_amount; i++)
-	{
-		int rowLength = availableHeight * rows[i].Height / 100;
+	GRID_EACH_CELL(rows, rows_amount, ColumnCount, i, j, cell, {
+		const Column* column = &rows[i].Columns[j];
+		Rectangle rect = layout->Cells[cell];
+		rect.x += x;
+		rect.y += y;
 
-		int availableWidth = width - (padding * (rows[i].ColumnCount - 1));
-		int curX = x;
-		int takenWidth = 0;
+		DrawRectangleRec(rect, column->Color);
 
-		for (int j = 0; j < rows[i].ColumnCount; j++)
+		if (column->BorderThickness > 0)
 		{
-			int colLength = availableWidth * rows[i].Columns[j].Width / 100;
-			Rectangle rect = (Rectangle){curX, curY, colLength, rowLength};
+			DrawRectangleLinesEx(rect, column->BorderThickness, column->BorderColor);
+		}
+		else if (column->BorderThickness < 0)
+		{
+			DrawRectangleLinesEx(rect, Padding, column->BorderColor);
+		}
+	})
+}
 
-			DrawRectangleRec(rect, rows[i].Columns[j].Color);
+// Wheel labels are laid out around the center once and only rotated with the
+// wheel, labels past the mesh capacity are drawn one by one
+#define WHEEL_LABEL_QUADS 8192
 
-			if (rows[i].Columns[j].BorderThickness > 0)
-			{
-				DrawRectangleLinesEx(rect, rows[i].Columns[j].BorderThickness,
-														 rows[i].Columns[j].BorderColor);
-			}
-			else if (rows[i].Columns[j].BorderThickness < 0)
-			{
-				DrawRectangleLinesEx(rect, Padding, rows[i].Columns[j].BorderColor);
-			}
+static TextQuad WheelLabelQuads[WHEEL_LABEL_QUADS];
+static TextMesh WheelLabels = {WheelLabelQuads, WHEEL_LABEL_QUADS, 0};
+static unsigned int WheelLabelsKey = 0;
+static int WheelLabelsFitted = 0;
+
+// FNV-1a over everything the label layout depends on
+static unsigned int WheelLabelsHash(float radius,
+																		const Slice* slices,
+																		int slice_amount)
+{
+	int layout[] = {slice_amount, FontSize, Padding, (int)(radius * 16)};
+	unsigned int hash = 2166136261u;
+
+	for (size_t i = 0; i < sizeof(layout); i++)
+	{
+		hash = (hash ^ ((unsigned char*)layout)[i]) * 16777619u;
+	}
 
-			curX += colLength + padding;
-			takenWidth += colLength;
+	for (int i = 0; i < slice_amount; i++)
+	{
+		hash = (hash ^ slices[i].Color) * 16777619u;
 
-			LogIf(takenWidth > availableWidth,
-						LogAppend(
-								"ERROR: Rectangle grid %d row %d column takes more than the "
-								"available width!\n",
-								i + 1, j + 1));
+		for (const char* c = slices[i].Name; *c != '\0'; c++)
+		{
+			hash = (hash ^ (unsigned char)*c) * 16777619u;
 		}
+	}
 
-		curY += rowLength + padding;
-		takenHeight += rowLength;
+	return hash;
+}
+
+// draws the label, or adds it to the mesh when one is passed
+static bool DrawWheelLabel(TextMesh* mesh,
+													 const Slice* slice,
+													 Vector2 center,
+													 float middleAngle,
+													 float distance)
+{
+	float angleRad = middleAngle * DEG2RAD;
+	Vector2 position = {center.x + cosf(angleRad) * distance,
+											center.y + sinf(angleRad) * distance};
+	Vector2 origin = {0.0f, FontSize / 1.2f / 2.0f};
+	Color color = GetContrastedTextColor(COLORS[slice->Color]);
 
-		LogIf(takenHeight > availableHeight,
-					LogAppend("ERROR: Rectangle grid %d row takes more than the "
-										"available height!\n",
-										i + 1));
+	if (mesh == NULL)
+	{
+		TextDrawPro(slice->Name, position, origin, middleAngle, FontSize / 1.2f,
+								TEXT_SPACING, color);
+		return true;
+	}
+
+	return TextMeshAdd(mesh, slice->Name, position, origin, middleAngle,
+										 FontSize / 1.2f, TEXT_SPACING, color);
+}
+
+static void BuildWheelLabels(float distance,
+														 const Slice* slices,
+														 int slice_amount)
+{
+	float sectionSize = 360.0f / slice_amount;
+
+	TextMeshClear(&WheelLabels);
+	WheelLabelsFitted = 0;
+
+	while (WheelLabelsFitted < slice_amount &&
+				 DrawWheelLabel(&WheelLabels, &slices[WheelLabelsFitted],
+												(Vector2){0, 0},
+												sectionSize * (WheelLabelsFitted + 0.5f), distance))
+	{
+		WheelLabelsFitted++;
 	}
 }
 
@@ -269,6 +551,7 @@ static void DrawWheel(float angle,
 	float sectionSize = 360.0f / slice_amount;
 	float startAngle = angle;
 	float endAngle = sectionSize + angle;
+	float textDistance = inner_circle_radius + Padding * 2;
 
 	// Draw a border on the wheel
 	DrawRing(center, radius - Border, radius + Border, 0, 360, 0,
@@ -279,22 +562,27 @@ static void DrawWheel(float angle,
 		DrawCircleSector(center, radius, startAngle, endAngle, 0,
 										 COLORS[slices[i].Color]);
 
-		float middleAngle = startAngle + (sectionSize / 2.0f);
-		Vector2 textSize =
-				MeasureTextEx(Fonte, slices[i].Name, FontSize / 1.2f, TEXT_SPACING);
-		float angleRad = middleAngle * DEG2RAD;
+		startAngle += sectionSize;
+		endAngle += sectionSize;
+	}
+
+	unsigned int key = WheelLabelsHash(radius, slices, slice_amount);
 
-		float textDistance = inner_circle_radius + Padding * 2;
-		float textX = center.x + cosf(angleRad) * textDistance;
-		float textY = center.y + sinf(angleRad) * textDistance;
+	if (key != WheelLabelsKey)
+	{
+		ProfileZone(ZONE_TEXT_MEASURE,
+								BuildWheelLabels(textDistance, slices, slice_amount););
+		WheelLabelsKey = key;
+	}
 
-		DrawTextPro(Fonte, slices[i].Name, (Vector2){textX, textY},
-								(Vector2){0.0f, textSize.y / 2.0f}, middleAngle,
-								FontSize / 1.2f, TEXT_SPACING,
-								GetContrastedTextColor(COLORS[slices[i].Color]));
+	// all the labels are a single batch, after the slices so the atlas is
+	// bound once
+	TextMeshDraw(&WheelLabels, center, angle);
 
-		startAngle += sectionSize;
-		endAngle += sectionSize;
+	for (int i = WheelLabelsFitted; i < slice_amount; i++)
+	{
+		DrawWheelLabel(NULL, &slices[i], center,
+									 angle + sectionSize * (i + 0.5f), textDistance);
 	}
 
 	// Draw a circle in the middle of the wheel
@@ -336,37 +624,10 @@ static void DrawCross(int x,
 	DrawLineEx(startVertical, endVertical, thickness, color);
 }
 
-#define HandleKeypress                                                       \
-	if (shadowStyle.Distance > 0)                                              \
-	{                                                                          \
-		x += shadowStyle.Distance;                                               \
-		y += shadowStyle.Distance;                                               \
-	}                                                                          \
-                                                                             \
-	DrawTextBox(x, y, width, height, text, fontSize, textColor, pressedColor,  \
-							borderColor, borderThickness, shadowStyle);                    \
-                                                                             \
-	ButtonPressedTime += GetFrameTime();                                       \
-                                                                             \
-	if (repeatPresses && ButtonPressedTime >= KeyRepeatInterval)               \
-	{                                                                          \
-		ButtonWasPressed = true;                                                 \
-                                                                             \
-		if (callback != NULL)                                                    \
-		{                                                                        \
-			callback(callbackArgs);                                                \
-		}                                                                        \
-		else                                                                     \
-		{                                                                        \
-			LogAppend("The '%s' button does not have a command defined!\n", text); \
-		}                                                                        \
-                                                                             \
-		ButtonPressedTime = 0;                                                   \
-		KeyRepeatInterval = fmax(KeyRepeatInterval * INITIAL_REPEAT_INTERVAL,    \
-														 MIN_REPEAT_INTERVAL);                           \
-	}
-
-static void DrawButton(int x,
+// id identifies the button in the hit index and must stay the same from one
+// frame to the next
+static void DrawButton(int id,
+											 int x,
 											 int y,
 											 int width,
 											 int height,
@@ -380,81 +641,44 @@ static void DrawButton(int x,
 											 Color borderColor,
 											 int borderThickness,
 											 ShadowStyle shadowStyle,
-											 Texture2D icon,
-											 void (*callback)(void* callbackArgs),
-											 void* callbackArgs)
+											 Rectangle icon,
+											 Command command)
 {
-	if (!Dragging && !ButtonWasPressed &&
-			IsMouseButtonReleased(MOUSE_BUTTON_LEFT) &&
-			IsPointInsideRect(MouseX, MouseY, x, y, width, height) &&
-			IsPointInsideRect(MousePressedX, MousePressedY, x, y, width, height))
-	{
-		ButtonWasPressed = true;
-		ButtonPressedTime = 0;
-		KeyRepeatInterval = INITIAL_REPEAT_INTERVAL;
+	Color color = backgroundColor;
+
+	HitRegister(id, (Rectangle){x, y, width, height});
 
-		if (callback != NULL)
+	if (HitClicked(id) || (repeatPresses && HitRepeated(id)))
+	{
+		if (command.Kind != COMMAND_NONE)
 		{
-			callback(callbackArgs);
+			CommandPush(command);
 		}
 		else
 		{
 			LogAppend("The '%s' button does not have a command defined!\n", text);
 		}
 	}
-	else if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
+
+	if (HitHeld(id))
 	{
-		if (IsPointInsideRect(MouseX, MouseY, x, y, width, height))
-		{
-			if (!Dragging && !ButtonWasPressed &&
-					IsPointInsideRect(MousePressedX, MousePressedY, x, y, width, height))
-			{
-				HandleKeypress;
-			}
-			else
-			{
-				DrawTextBox(x, y, width, height, text, fontSize, textColor,
-#ifdef PLATFORM_ANDROID
-										TouchCount > 0 ? hoveredColor : backgroundColor,
-#else
-										hoveredColor,
-#endif
-										borderColor, borderThickness, shadowStyle);
-			}
-		}
-		else
-		{
-			if (!Dragging && !ButtonWasPressed &&
-					IsPointInsideRect(MousePressedX, MousePressedY, x, y, width, height))
-			{
-				HandleKeypress;
-			}
-			else
-			{
-				DrawTextBox(x, y, width, height, text, fontSize, textColor,
-										backgroundColor, borderColor, borderThickness, shadowStyle);
-			}
-		}
+		// pressed into its shadow
+		x += shadowStyle.Distance;
+		y += shadowStyle.Distance;
+		color = pressedColor;
 	}
-	else
-	{
-		if (IsPointInsideRect(MouseX, MouseY, x, y, width, height))
-		{
-			DrawTextBox(x, y, width, height, text, fontSize, textColor,
 #ifdef PLATFORM_ANDROID
-									TouchCount > 0 ? hoveredColor : backgroundColor,
+	else if (HitHovered(id) && TouchCount > 0)
 #else
-									hoveredColor,
+	else if (HitHovered(id))
 #endif
-									borderColor, borderThickness, shadowStyle);
-		}
-		else
-		{
-			DrawTextBox(x, y, width, height, text, fontSize, textColor,
-									backgroundColor, borderColor, borderThickness, shadowStyle);
-		}
+	{
+		color = hoveredColor;
 	}
 
+	DrawTextBox(x, y, width, height, text, fontSize, textColor, color,
+							borderColor, borderThickness, shadowStyle);
+
 	if (icon.width > 0)
 	{
 		if (width < height)
@@ -466,13 +690,16 @@ static void DrawButton(int x,
 			width = height;
 		}
 
-		DrawTexturePro(icon, ICON_RECTANGLE, (Rectangle){x, y, width, height},
+		DrawTexturePro(Atlas, icon, (Rectangle){x, y, width, height},
 									 (Vector2){0, 0}, 0, WHITE);
 	}
 }
-#undef HandleKeypress
 
-static void DrawButtonGrid(int x,
+// layout keeps the cells between calls, NULL solves them every call, the
+// buttons get consecutive ids from firstId
+static void DrawButtonGrid(GridLayout* layout,
+													 int firstId,
+													 int x,
 													 int y,
 													 int width,
 													 int height,
@@ -480,51 +707,27 @@ static void DrawButtonGrid(int x,
 													 const ButtonRow* rows,
 													 int rows_amount)
 {
-	int availableHeight = height - (padding * (rows_amount - 1));
-	int curY = y;
-	int takenHeight = 0;
-
-	for (int i = 0; i < rows_amount; i++)
-	{
-		int rowLength = availableHeight * rows[i].HeightPercentage / 100;
-
-		int availableWidth = width - (padding * (rows[i].ColumnAmount - 1));
-		int curX = x;
-		int takenWidth = 0;
-
-		for (int j = 0; j < rows[i].ColumnAmount; j++)
-		{
-			int colLength = availableWidth * rows[i].Columns[j].WidthPercentage / 100;
-
-			DrawButton(
-					curX, curY, colLength, rowLength, rows[i].Columns[j].Text,
-					rows[i].Columns[j].FontSize, rows[i].Columns[j].RepeatPresses,
-					rows[i].Columns[j].TextColor, rows[i].Columns[j].BackgroundColor,
-					rows[i].Columns[j].PressedColor, rows[i].Columns[j].HoveredColor,
-					rows[i].Columns[j].BorderColor, rows[i].Columns[j].BorderThickness,
-					rows[i].Columns[j].ShadowStyle, rows[i].Columns[j].Icon,
-					rows[i].Columns[j].Callback, rows[i].Columns[j].CallbackArgs);
-
-			curX += colLength + padding;
-			takenWidth += colLength;
-
-			LogIf(takenWidth > availableWidth,
-						LogAppend("ERROR: Button grid %d column takes more than the "
-											"available width!\n",
-											j + 1));
-		}
-
-		curY += rowLength + padding;
-		takenHeight += rowLength;
-
-		LogIf(
-				takenHeight > availableHeight,
-				LogAppend(
-						"ERROR: Button grid %d row takes more than the available height!\n",
-						i + 1));
-	}
+	GridLayout local = GRID_LAYOUT_EMPTY;
+	layout = layout != NULL ? layout : &local;
+	rows_amount = fmin(rows_amount, LAYOUT_MAX_ROWS);
+	LAYOUT_GRID(layout, width, height, padding, rows, rows_amount, ColumnAmount);
+
+	GRID_EACH_CELL(rows, rows_amount, ColumnAmount, i, j, cell, {
+		const Button* button = &rows[i].Columns[j];
+		Rectangle rect = layout->Cells[cell];
+
+		DrawButton(firstId + cell, x + rect.x, y + rect.y, rect.width, rect.height,
+							 button->Text, button->FontSize, button->RepeatPresses,
+							 button->TextColor, button->BackgroundColor,
+							 button->PressedColor, button->HoveredColor,
+							 button->BorderColor, button->BorderThickness,
+							 button->ShadowStyle, button->Icon, button->Command);
+	})
 }
 
+// Draws the text being edited with its selection and cursor. Only the parts
+// of the text that changed are measured, the size it is drawn at is worked
+// out from the cached advances
 static void DrawTextField(int x,
 													int y,
 													int width,
@@ -532,57 +735,67 @@ static void DrawTextField(int x,
 													Color textColor,
 													Color backgroundColor,
 													Color borderColor,
+													Color selectionColor,
 													int fontSize,
-													int BorderThickness,
-													char* buffer)
+													int borderThickness,
+													ShadowStyle shadowStyle,
+													TextEdit* edit)
 {
-	size_t nameLength = strlen(buffer);
-	char displayName[SLICE_NAME_SIZE];
-	snprintf(displayName, sizeof(displayName), "%s|", buffer);
+	Stats[STAT_TEXT_BOXES]++;
+
+	LogIf(CheckBadContrast(backgroundColor, textColor),
+				LogAppend("ERROR: The text at the %d,%d text field is not visible!\n",
+									x, y));
 
-	DrawTextBox(x, y, width, height, displayName, fontSize, textColor,
-							backgroundColor, borderColor, BorderThickness, NO_SHADOW);
+	ProfileZone(ZONE_TEXT_MEASURE, EditMeasureStale(edit););
 
-	if (IsKeyPressed(KEY_BACKSPACE))
+	float advance = edit->PreAdvance + edit->PostAdvance;
+	int count = edit->PreCount + edit->PostCount;
+	int caretWidth = fmax(fontSize / 16, 1);
+	float size = fmin(fontSize, height);
+
+	// the width is linear in the font size, so the size that fits is direct
+	if (advance > 0)
 	{
-		if (nameLength > 0)
-			buffer[nameLength - 1] = '\0';
-		ButtonPressedTime = 0;
-		KeyRepeatInterval = INITIAL_REPEAT_INTERVAL;
+		size = fmin(size, (width - caretWidth - count * TEXT_SPACING) *
+													Fonte.baseSize / advance);
 	}
-	else if (IsKeyDown(KEY_BACKSPACE))
-	{
-		ButtonPressedTime += GetFrameTime();
 
-		if (ButtonPressedTime >= KeyRepeatInterval)
-		{
-			if (nameLength > 0)
-				buffer[nameLength - 1] = '\0';
-			ButtonPressedTime = 0;
-			KeyRepeatInterval = fmax(KeyRepeatInterval * INITIAL_REPEAT_INTERVAL,
-															 MIN_REPEAT_INTERVAL);
-		}
-	}
-	else
-	{
-		ButtonPressedTime += GetFrameTime();
+	size = fmax(floorf(size), 1);
 
-		if (ButtonPressedTime >= KeyRepeatInterval)
-		{
-			int keycode = GetCharPressed();
+	float scale = size / Fonte.baseSize;
+	float textWidth = advance * scale + fmax(count - 1, 0) * TEXT_SPACING;
+	float textX = x + (width - textWidth - caretWidth) / 2;
+	float textY = y + (height - size) / 2;
+	float caretX =
+			textX + edit->PreAdvance * scale + edit->PreCount * TEXT_SPACING;
+	float anchorX =
+			textX + edit->AnchorAdvance * scale + edit->AnchorCount * TEXT_SPACING;
+	Rectangle rect = {x, y, width, height};
 
-			if (nameLength < SLICE_NAME_SIZE - 1 &&
-					(keycode == ' ' || isalnum(keycode)))
-			{
-				buffer[nameLength] = tolower(keycode);
-				buffer[nameLength + 1] = '\0';
+	DrawShadow(x, y, width, height, shadowStyle, borderColor);
+	DrawRectangleRec(rect, backgroundColor);
 
-				ButtonPressedTime = 0;
-				KeyRepeatInterval = fmax(KeyRepeatInterval * INITIAL_REPEAT_INTERVAL,
-																 MIN_REPEAT_INTERVAL);
-			}
-		}
+	if (borderThickness > 0)
+	{
+		DrawRectangleLinesEx(rect, borderThickness, borderColor);
 	}
+
+	if (edit->Anchor != edit->GapStart)
+	{
+		DrawRectangleRec((Rectangle){fmin(caretX, anchorX), textY,
+																 fabs(caretX - anchorX), size},
+										 selectionColor);
+	}
+
+	// the first half ends at the gap and the second one at the end of the buffer
+	TextDraw(edit->Buffer, (Vector2){textX, textY}, size, TEXT_SPACING,
+					 textColor);
+	TextDraw(edit->Buffer + edit->GapEnd, (Vector2){caretX, textY}, size,
+					 TEXT_SPACING, textColor);
+	DrawRectangleRec((Rectangle){caretX - (edit->PreCount > 0 ? TEXT_SPACING : 0),
+															 textY, caretWidth, size},
+									 textColor);
 }
 
 #endif	// PICKLE_DRAW
@@ -0,0 +1,414 @@
+#ifndef PICKLE_EDIT
+#define PICKLE_EDIT
+
+#include <ctype.h>
+#include <math.h>
+#include <string.h>
+
+#include "globals.c"
+#include "input.c"
+#include "stats.c"
+#include "text.c"
+#include "trace.c"
+
+// Editing of the slice name being typed in. The name is copied once into a
+// gap buffer, the text before the cursor sits at the start and the text after
+// it at the end, so typing and deleting at the cursor only touch the bytes
+// involved. Both halves are measured only after they change and the slice
+// name is only written back when the text did
+typedef struct
+{
+	// slice the buffer holds, -1 for none
+	int Slice;
+	// one byte more than a name, so the gap always has room for the nul that
+	// ends the first half, and a last nul that ends the second one
+	char Buffer[SLICE_NAME_SIZE + 1];
+	// the gap starts at the cursor
+	int GapStart;
+	int GapEnd;
+	// the other end of the selection, same as the cursor when there is none
+	int Anchor;
+	int Length;
+	bool Changed;
+	float RepeatTime;
+	float RepeatInterval;
+	// advances in font units and glyph counts, up to the cursor, after it and
+	// up to the anchor
+	float PreAdvance;
+	int PreCount;
+	float PostAdvance;
+	int PostCount;
+	float AnchorAdvance;
+	int AnchorCount;
+	bool PreStale;
+	bool PostStale;
+	bool AnchorStale;
+} TextEdit;
+
+static TextEdit Edit = {.Slice = -1};
+
+// byte at a position of the text, as if there was no gap
+static char EditByte(const TextEdit* edit, int position)
+{
+	return edit->Buffer[position < edit->GapStart
+													? position
+													: position - edit->GapStart + edit->GapEnd];
+}
+
+// start of the character before the position, utf-8 takes several bytes
+static int EditPrevious(const TextEdit* edit, int position)
+{
+	do
+	{
+		position--;
+	} while (position > 0 && (EditByte(edit, position) & 0xC0) == 0x80);
+
+	return fmax(position, 0);
+}
+
+static int EditNext(const TextEdit* edit, int position)
+{
+	do
+	{
+		position++;
+	} while (position < edit->Length &&
+					 (EditByte(edit, position) & 0xC0) == 0x80);
+
+	return fmin(position, edit->Length);
+}
+
+// puts the cursor at the position by moving the bytes between them across
+static void EditMoveGap(TextEdit* edit, int position)
+{
+	if (position < edit->GapStart)
+	{
+		int count = edit->GapStart - position;
+		memmove(edit->Buffer + edit->GapEnd - count, edit->Buffer + position,
+						count);
+		edit->GapStart -= count;
+		edit->GapEnd -= count;
+	}
+	else if (position > edit->GapStart)
+	{
+		int count = position - edit->GapStart;
+		memmove(edit->Buffer + edit->GapStart, edit->Buffer + edit->GapEnd,
+						count);
+		edit->GapStart += count;
+		edit->GapEnd += count;
+	}
+	else
+	{
+		return;
+	}
+
+	edit->Buffer[edit->GapStart] = '\0';
+	edit->PreStale = edit->PostStale = edit->AnchorStale = true;
+}
+
+// takes the name of the slice into the buffer with the cursor at its end
+static void EditLoad(TextEdit* edit, int slice)
+{
+	int length = strlen(Slices[slice].Name);
+
+	memcpy(edit->Buffer, Slices[slice].Name, length);
+	edit->Slice = slice;
+	edit->GapStart = edit->Length = edit->Anchor = length;
+	edit->GapEnd = SLICE_NAME_SIZE;
+	edit->Buffer[edit->GapStart] = '\0';
+	edit->Buffer[SLICE_NAME_SIZE] = '\0';
+	edit->Changed = false;
+	edit->RepeatTime = 0;
+	edit->RepeatInterval = INITIAL_REPEAT_INTERVAL;
+	edit->PreStale = edit->PostStale = edit->AnchorStale = true;
+}
+
+// writes the text back to the slice if it changed
+static void EditSync(TextEdit* edit)
+{
+	if (!edit->Changed || edit->Slice < 0)
+	{
+		return;
+	}
+
+	char* name = Slices[edit->Slice].Name;
+	int post = edit->Length - edit->GapStart;
+
+	memcpy(name, edit->Buffer, edit->GapStart);
+	memcpy(name + edit->GapStart, edit->Buffer + edit->GapEnd, post);
+	name[edit->Length] = '\0';
+	edit->Changed = false;
+}
+
+// removes the bytes between the positions, the cursor ends up where they were
+static void EditDelete(TextEdit* edit, int from, int to)
+{
+	if (from >= to)
+	{
+		return;
+	}
+
+	if (from == edit->GapStart)
+	{
+		edit->GapEnd += to - from;
+		edit->PostStale = true;
+	}
+	else
+	{
+		EditMoveGap(edit, to);
+		edit->GapStart = from;
+		edit->Buffer[edit->GapStart] = '\0';
+		edit->PreStale = true;
+	}
+
+	edit->Length -= to - from;
+	edit->Anchor = edit->GapStart;
+	edit->AnchorStale = true;
+	edit->Changed = true;
+}
+
+// false when nothing was selected
+static bool EditDeleteSelection(TextEdit* edit)
+{
+	if (edit->Anchor == edit->GapStart)
+	{
+		return false;
+	}
+
+	EditDelete(edit, fmin(edit->Anchor, edit->GapStart),
+						 fmax(edit->Anchor, edit->GapStart));
+	return true;
+}
+
+// types the character over the selection when it fits and the atlas has its
+// glyph, those are the FONT_GLYPHS in build.sh
+static bool EditInsert(TextEdit* edit, int codepoint)
+{
+	if (!TextCanDraw(codepoint))
+	{
+		return false;
+	}
+
+	int size = 0;
+	const char* utf8 =
+			CodepointToUTF8(codepoint < 0x80 ? tolower(codepoint) : codepoint, &size);
+	int selected = abs(edit->Anchor - edit->GapStart);
+
+	if (edit->Length - selected + size >= SLICE_NAME_SIZE)
+	{
+		return false;
+	}
+
+	EditDeleteSelection(edit);
+	memcpy(edit->Buffer + edit->GapStart, utf8, size);
+	edit->GapStart += size;
+	edit->Buffer[edit->GapStart] = '\0';
+	edit->Length += size;
+	edit->Anchor = edit->GapStart;
+	edit->PreStale = edit->AnchorStale = true;
+	edit->Changed = true;
+	return true;
+}
+
+static void EditBackspace(TextEdit* edit)
+{
+	if (!EditDeleteSelection(edit))
+	{
+		EditDelete(edit, EditPrevious(edit, edit->GapStart), edit->GapStart);
+	}
+}
+
+// moves the cursor, keeping the anchor where it was when selecting
+static void EditMove(TextEdit* edit, int position, bool select)
+{
+	EditMoveGap(edit, position);
+
+	if (!select && edit->Anchor != position)
+	{
+		edit->Anchor = position;
+		edit->AnchorStale = true;
+	}
+}
+
+// puts the selected text on the clipboard
+static void EditCopy(const TextEdit* edit)
+{
+	char text[SLICE_NAME_SIZE];
+	int from = fmin(edit->Anchor, edit->GapStart);
+	int to = fmax(edit->Anchor, edit->GapStart);
+
+	if (from == to)
+	{
+		return;
+	}
+
+	for (int i = from; i < to; i++)
+	{
+		text[i - from] = EditByte(edit, i);
+	}
+
+	text[to - from] = '\0';
+	SetClipboardText(text);
+}
+
+// call every frame while a slice is typed in, before drawing its field
+static void EditUpdate(TextEdit* edit, int slice)
+{
+	if (edit->Slice != slice)
+	{
+		EditLoad(edit, slice);
+	}
+
+	unsigned int keys = Input.Keys;
+	bool select = keys & INPUT_KEY_SHIFT;
+	int typed = 0;
+
+	// the whole queue is taken, so fast typing and pastes lose nothing
+	for (int c; (c = InputGetChar()) != 0;)
+	{
+		if (c == QUEUE_BACKSPACE)
+		{
+			EditBackspace(edit);
+		}
+		else
+		{
+			typed += EditInsert(edit, c);
+		}
+	}
+
+	if (typed > 0)
+	{
+		TraceInstant("input", "Chars typed", typed);
+	}
+
+	if (keys & INPUT_KEY_SELECT_ALL)
+	{
+		EditMove(edit, 0, false);
+		EditMove(edit, edit->Length, true);
+	}
+
+	if (keys & (INPUT_KEY_COPY | INPUT_KEY_CUT))
+	{
+		EditCopy(edit);
+	}
+
+	if (keys & INPUT_KEY_CUT)
+	{
+		EditDeleteSelection(edit);
+	}
+
+	if (keys & INPUT_KEY_DELETE && !EditDeleteSelection(edit))
+	{
+		EditDelete(edit, edit->GapStart, EditNext(edit, edit->GapStart));
+	}
+
+	// without shift the arrows first drop the selection on its side
+	int from = fmin(edit->Anchor, edit->GapStart);
+	int to = fmax(edit->Anchor, edit->GapStart);
+
+	if (keys & INPUT_KEY_LEFT)
+	{
+		EditMove(edit,
+						 select || from == to ? EditPrevious(edit, edit->GapStart) : from,
+						 select);
+	}
+
+	if (keys & INPUT_KEY_RIGHT)
+	{
+		EditMove(edit, select || from == to ? EditNext(edit, edit->GapStart) : to,
+						 select);
+	}
+
+	if (keys & INPUT_KEY_HOME)
+	{
+		EditMove(edit, 0, select);
+	}
+
+	if (keys & INPUT_KEY_END)
+	{
+		EditMove(edit, edit->Length, select);
+	}
+
+	if (Input.BackspacePressed)
+	{
+		TraceInstant("input", "Backspace pressed", edit->GapStart);
+
+		EditBackspace(edit);
+		edit->RepeatTime = 0;
+		edit->RepeatInterval = INITIAL_REPEAT_INTERVAL;
+	}
+	else if (Input.BackspaceDown)
+	{
+		edit->RepeatTime += DeltaTime;
+
+		if (edit->RepeatTime >= edit->RepeatInterval)
+		{
+			EditBackspace(edit);
+			edit->RepeatTime = 0;
+			edit->RepeatInterval =
+					fmax(edit->RepeatInterval * INITIAL_REPEAT_INTERVAL,
+							 MIN_REPEAT_INTERVAL);
+		}
+	}
+
+	EditSync(edit);
+}
+
+// adds the advances of the characters in the first length bytes, in font
+// units
+static void EditMeasure(const char* text,
+												int length,
+												float* advance,
+												int* count)
+{
+	Stats[STAT_MEASURE_TEXT]++;
+
+	for (int i = 0, size = 0; i < length; i += size)
+	{
+		TextGlyph* glyph = TextFindGlyph(TextNextCodepoint(text + i, &size));
+		*advance += glyph->Advance;
+		*count += 1;
+	}
+}
+
+// measures again only the parts that changed
+static void EditMeasureStale(TextEdit* edit)
+{
+	if (edit->PreStale)
+	{
+		edit->PreAdvance = edit->PreCount = 0;
+		EditMeasure(edit->Buffer, edit->GapStart, &edit->PreAdvance,
+								&edit->PreCount);
+		edit->PreStale = false;
+		edit->AnchorStale = true;
+	}
+
+	if (edit->PostStale)
+	{
+		edit->PostAdvance = edit->PostCount = 0;
+		EditMeasure(edit->Buffer + edit->GapEnd, edit->Length - edit->GapStart,
+								&edit->PostAdvance, &edit->PostCount);
+		edit->PostStale = false;
+	}
+
+	if (edit->AnchorStale)
+	{
+		edit->AnchorAdvance = edit->AnchorCount = 0;
+
+		if (edit->Anchor <= edit->GapStart)
+		{
+			EditMeasure(edit->Buffer, edit->Anchor, &edit->AnchorAdvance,
+									&edit->AnchorCount);
+		}
+		else
+		{
+			edit->AnchorAdvance = edit->PreAdvance;
+			edit->AnchorCount = edit->PreCount;
+			EditMeasure(edit->Buffer + edit->GapEnd, edit->Anchor - edit->GapStart,
+									&edit->AnchorAdvance, &edit->AnchorCount);
+		}
+
+		edit->AnchorStale = false;
+	}
+}
+
+#endif	// PICKLE_EDIT
@@ -0,0 +1,150 @@
+#ifndef PICKLE_FLIGHT
+#define PICKLE_FLIGHT
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "globals.c"
+#include "input.c"
+#include "profile.c"
+#include "stats.c"
+
+// Keeps the last frames in a fixed ring and dumps it whenever a frame goes
+// over budget, cheap enough to stay on in release builds
+
+// about 7 seconds at the target fps, must be a power of two
+#ifndef FLIGHT_FRAMES
+#	define FLIGHT_FRAMES 1024
+#endif
+
+// frames ignored after startup, the first frames always take long
+#ifndef FLIGHT_WARMUP_FRAMES
+#	define FLIGHT_WARMUP_FRAMES 60
+#endif
+
+// seconds to wait before dumping again so a slow stretch dumps only once
+#ifndef FLIGHT_COOLDOWN
+#	define FLIGHT_COOLDOWN 5
+#endif
+
+typedef struct
+{
+	float DeltaTime;
+	float ZoneTimes[ZONES_AMOUNT];
+	unsigned int DrawCalls;
+	unsigned int Batches;
+	unsigned int Vertices;
+	short MouseX;
+	short MouseY;
+	bool MouseDown;
+	bool Clicked;
+	bool Dragging;
+	signed char Scene;
+	int TypingIndex;
+	int WheelPickedIndex;
+	int SlicesCount;
+} FlightFrame;
+
+static FlightFrame FlightFrames[FLIGHT_FRAMES];
+static unsigned int FlightFrameCount = 0;
+static double FlightLastDump = -FLIGHT_COOLDOWN;
+static bool FlightIgnored = false;
+// milliseconds, zero uses twice PaceBudget
+static float FlightBudget = 0;
+
+// the current frame stalls on purpose and should not be dumped
+static void FlightIgnoreFrame(void)
+{
+	FlightIgnored = true;
+}
+
+static void FlightDump(float frameTime)
+{
+	char fileName[64];
+	snprintf(fileName, sizeof(fileName), "pickle-hitch-%ld-%u.csv",
+					 (long)time(NULL), FlightFrameCount);
+
+	FILE* file = fopen(fileName, "w");
+
+	if (file == NULL)
+	{
+		TraceLog(LOG_WARNING, "FLIGHT: Could not open %s", fileName);
+		return;
+	}
+
+	fprintf(file, "frame,delta_ms");
+
+#define X(Name, NAME) fprintf(file, "," #Name "_ms");
+	PROFILE_ZONE_LIST
+#undef X
+
+	fprintf(file,
+					",draw_calls,batches,vertices,mouse_x,mouse_y,mouse_down,clicked,"
+					"dragging,scene,typing_index,picked_index,slices\n");
+
+	unsigned int first = FlightFrameCount > FLIGHT_FRAMES
+													 ? FlightFrameCount - FLIGHT_FRAMES
+													 : 0;
+
+	for (unsigned int f = first; f < FlightFrameCount; f++)
+	{
+		FlightFrame* frame = &FlightFrames[f & (FLIGHT_FRAMES - 1)];
+
+		fprintf(file, "%u,%.3f", f, frame->DeltaTime * 1000);
+
+		for (int z = 0; z < ZONES_AMOUNT; z++)
+		{
+			fprintf(file, ",%.3f", frame->ZoneTimes[z]);
+		}
+
+		fprintf(file, ",%u,%u,%u", frame->DrawCalls, frame->Batches,
+						frame->Vertices);
+		fprintf(file, ",%d,%d,%d,%d,%d,%d,%d,%d,%d\n", frame->MouseX,
+						frame->MouseY, frame->MouseDown, frame->Clicked, frame->Dragging,
+						frame->Scene, frame->TypingIndex, frame->WheelPickedIndex,
+						frame->SlicesCount);
+	}
+
+	fclose(file);
+
+	TraceLog(LOG_WARNING, "FLIGHT: %.2fms frame, wrote the last %u frames to %s",
+					 frameTime, FlightFrameCount - first, fileName);
+}
+
+// call after ProfileFrameEnd so the zone times are from this frame
+static void FlightFrameEnd(void)
+{
+	FlightFrame* frame = &FlightFrames[FlightFrameCount & (FLIGHT_FRAMES - 1)];
+	frame->DeltaTime = DeltaTime;
+	memcpy(frame->ZoneTimes, ZoneLastFrame, sizeof(ZoneLastFrame));
+	frame->DrawCalls = StatsLastFrame[STAT_DRAW_CALLS];
+	frame->Batches = StatsLastFrame[STAT_BATCHES];
+	frame->Vertices = StatsLastFrame[STAT_VERTICES];
+	frame->MouseX = MouseX;
+	frame->MouseY = MouseY;
+	frame->MouseDown = Input.MouseDown;
+	frame->Clicked = Clicked;
+	frame->Dragging = Dragging;
+	frame->Scene = CurrentScene;
+	frame->TypingIndex = TypingIndex;
+	frame->WheelPickedIndex = WheelPickedIndex;
+	frame->SlicesCount = SlicesCount;
+	FlightFrameCount++;
+
+	float frameTime = ZoneLastFrame[ZONE_FRAME];
+	float budget = FlightBudget > 0 ? FlightBudget : PaceBudget() * 2;
+
+	// the cooldown also skips the frame that pays for writing the dump
+	if (!FlightIgnored && frameTime > budget &&
+			FlightFrameCount > FLIGHT_WARMUP_FRAMES &&
+			GetTime() - FlightLastDump >= FLIGHT_COOLDOWN)
+	{
+		FlightDump(frameTime);
+		FlightLastDump = GetTime();
+	}
+
+	FlightIgnored = false;
+}
+
+#endif	// PICKLE_FLIGHT
@@ -7,6 +7,11 @@
 
 #define ARRAY_LENGTH(arr) sizeof(arr) / sizeof(arr[0])
 
+#ifndef clamp
+#	define clamp(val, min_val, max_val) \
+		((val) > (max_val) ? (max_val) : ((val) < (min_val) ? (min_val) : (val)))
+#endif
+
 // NOTE(LucasTA): Odd number off colors is not supported XD
 #define COLOR_LIST \
 	X(GRAY)          \
@@ -54,7 +59,12 @@ typedef struct
 static const Slice DEFAULT_SLICES[] = {COLOR_LIST};
 #undef X
 
-static Slice Slices[COLORS_AMOUNT];
+// more slices than colors repeat the colors, benchmarks raise it
+#ifndef MAX_SLICES
+#	define MAX_SLICES COLORS_AMOUNT
+#endif
+
+static Slice Slices[MAX_SLICES];
 static int SlicesCount = 0;
 
 #define PALETTE_ROW_AMOUNT 2
@@ -63,6 +73,7 @@ static int SlicesCount = 0;
 #define PALETTE_COL_PERCENTAGE (100.0f / (PALETTE_COL_AMOUNT))
 
 static const char APP_NAME[] = "pickle";
+static const int TARGET_FPS = 144;
 static const char WHEEL_TEXT[] = "SPIN!";
 static const int TEXT_SPACING = 2;
 static const float ROUNDNESS = 0.2f;
@@ -70,6 +81,8 @@ static const Color FOREGROUND_COLOR = BLACK;
 // NOTE(LucasTA): background should not be a color in COLOR_LIST
 static const Color BACKGROUND_COLOR = LIGHTGRAY;
 static const Color HIGHLIGHT_COLOR = WHITE;
+static const Color SELECTION_COLOR = SKYBLUE;
+static const Color SHADOW_COLOR = {0, 0, 0, 80};
 static const Color HOVERED_COLOR = GRAY;
 static const Color PRESSED_COLOR = DARKGRAY;
 static const Color RED_PRESSED_COLOR = MAROON;
@@ -87,15 +100,12 @@ static float MouseScroll = 0;
 #endif
 
 static const float MIN_REPEAT_INTERVAL = INITIAL_REPEAT_INTERVAL / 10;
-static float ButtonPressedTime = 0;
-static float KeyRepeatInterval = INITIAL_REPEAT_INTERVAL;
 static float MenuScrollOffset = 0;
 static float DeltaTime = 0;
 static float WheelAcceleration = 0;
 static float WheelAccelerationRate = 0;
 static float WheelAngle = 0;
 static Vector2 WheelTextSize = {0};
-static bool ButtonWasPressed = false;
 static bool Clicked = false;
 static bool Dragging = false;
 static Font Fonte;
@@ -128,20 +138,12 @@ enum StateEnum
 
 static int WheelPickedIndex = STATE_NO_WINNER;
 
-#include "../assets/MenuIcon.h"
-#include "../assets/TrashIcon.h"
-#include "../assets/icon_xhdpi.h"
-
-#define ICON_LIST   \
-	X(Window, WINDOW) \
-	X(Menu, MENU)     \
+// icons packed into the ui atlas, the window icon is only an image
+#define ICON_LIST \
+	X(Menu, MENU)   \
 	X(Trash, TRASH)
 
-#define X(Name, NAME)                                            \
-	static Image Name##Image = {                                   \
-			NAME##ICON_DATA,	 NAME##ICON_WIDTH, NAME##ICON_HEIGHT, 1, \
-			NAME##ICON_FORMAT,                                         \
-	};
+#define X(Name, NAME) static Rectangle Name##Icon = {0};
 ICON_LIST
 #undef X
 
@@ -0,0 +1,315 @@
+#ifndef PICKLE_HISTORY
+#define PICKLE_HISTORY
+
+#include <string.h>
+
+#include "globals.c"
+#include "log.c"
+
+// Undo and redo for the slice edits. Only what changed is recorded, the slice
+// index, the colors and the bytes of a name that were added or removed, in a
+// ring that drops the oldest steps once it is full. Everything applied in one
+// frame is a single step, so bulk edits are undone at once
+#define HISTORY_SIZE (16 * 1024)
+
+enum HistoryOpEnum
+{
+	HISTORY_ADD,
+	HISTORY_REMOVE,
+	HISTORY_RECOLOR,
+	HISTORY_RENAME,
+};
+
+// followed by BeforeLength bytes of the old name, AfterLength bytes of the new
+// one and the size of the whole record, so the ring can be walked back
+typedef struct
+{
+	int Slice;
+	unsigned char Op;
+	// the first record of a step
+	unsigned char First;
+	unsigned char Before;
+	unsigned char After;
+	// bytes at the start of the name a rename kept
+	unsigned short Offset;
+	unsigned short BeforeLength;
+	unsigned short AfterLength;
+} HistoryRecord;
+
+// positions only grow, they wrap when indexing the ring
+static unsigned char HistoryRing[HISTORY_SIZE];
+static unsigned int HistoryTail = 0;
+static unsigned int HistoryCursor = 0;
+static unsigned int HistoryHead = 0;
+static unsigned int HistoryStepStart = 0;
+static bool HistoryNextFirst = true;
+// the slice being typed in and its name from before
+static int HistoryRenameSlice = -1;
+static char HistoryRenameName[SLICE_NAME_SIZE];
+
+static void HistoryWrite(unsigned int at, const void* data, int size)
+{
+	for (int i = 0; i < size; i++)
+	{
+		HistoryRing[(at + i) % HISTORY_SIZE] = ((const unsigned char*)data)[i];
+	}
+}
+
+static void HistoryRead(unsigned int at, void* data, int size)
+{
+	for (int i = 0; i < size; i++)
+	{
+		((unsigned char*)data)[i] = HistoryRing[(at + i) % HISTORY_SIZE];
+	}
+}
+
+static unsigned short HistoryRecordSize(HistoryRecord record)
+{
+	return sizeof(record) + record.BeforeLength + record.AfterLength +
+				 sizeof(unsigned short);
+}
+
+// drops the oldest step
+static void HistoryDrop(void)
+{
+	HistoryRecord record;
+
+	do
+	{
+		HistoryRead(HistoryTail, &record, sizeof(record));
+		HistoryTail += HistoryRecordSize(record);
+
+		if (HistoryTail == HistoryHead)
+		{
+			return;
+		}
+
+		HistoryRead(HistoryTail, &record, sizeof(record));
+	} while (!record.First);
+}
+
+// call before applying the edits of a frame
+static void HistoryStepBegin(void)
+{
+	HistoryNextFirst = true;
+}
+
+static void HistoryPush(HistoryRecord record,
+												const char* before,
+												const char* after)
+{
+	unsigned short size = HistoryRecordSize(record);
+
+	if (HistoryNextFirst)
+	{
+		HistoryStepStart = HistoryCursor;
+	}
+
+	record.First = HistoryNextFirst;
+	HistoryNextFirst = false;
+	// whatever was undone can not be redone anymore
+	HistoryHead = HistoryCursor;
+
+	while (HistoryHead + size - HistoryTail > HISTORY_SIZE)
+	{
+		if (HistoryTail == HistoryStepStart)
+		{
+			// the step alone does not fit, keep its end as a step of its own
+			LogAppend("ERROR: An edit was too big to undo!\n");
+			HistoryTail = HistoryStepStart = HistoryHead;
+			record.First = true;
+			break;
+		}
+
+		HistoryDrop();
+	}
+
+	HistoryWrite(HistoryHead, &record, sizeof(record));
+	HistoryHead += sizeof(record);
+	HistoryWrite(HistoryHead, before, record.BeforeLength);
+	HistoryHead += record.BeforeLength;
+	HistoryWrite(HistoryHead, after, record.AfterLength);
+	HistoryHead += record.AfterLength;
+	HistoryWrite(HistoryHead, &size, sizeof(size));
+	HistoryHead += sizeof(size);
+	HistoryCursor = HistoryHead;
+}
+
+static void SliceInsert(int index, int color)
+{
+	memmove(&Slices[index + 1], &Slices[index],
+					(SlicesCount - index) * sizeof(Slice));
+	Slices[index].Color = color;
+	SlicesCount++;
+}
+
+static void SliceRemove(int index)
+{
+	memmove(&Slices[index], &Slices[index + 1],
+					(SlicesCount - index - 1) * sizeof(Slice));
+	SlicesCount--;
+}
+
+static void HistoryAdded(int slice)
+{
+	const char* name = Slices[slice].Name;
+	HistoryRecord record = {.Slice = slice,
+													.Op = HISTORY_ADD,
+													.After = Slices[slice].Color,
+													.AfterLength = strlen(name)};
+	HistoryPush(record, NULL, name);
+}
+
+// call before the slice is removed
+static void HistoryRemoving(int slice)
+{
+	const char* name = Slices[slice].Name;
+	HistoryRecord record = {.Slice = slice,
+													.Op = HISTORY_REMOVE,
+													.Before = Slices[slice].Color,
+													.BeforeLength = strlen(name)};
+	HistoryPush(record, name, NULL);
+
+	if (HistoryRenameSlice > slice)
+	{
+		HistoryRenameSlice--;
+	}
+}
+
+static void HistoryRecolored(int slice, int before)
+{
+	HistoryRecord record = {.Slice = slice,
+													.Op = HISTORY_RECOLOR,
+													.Before = before,
+													.After = Slices[slice].Color};
+	HistoryPush(record, NULL, NULL);
+}
+
+// call when typing in the slice starts
+static void HistoryRenameBegin(int slice)
+{
+	HistoryRenameSlice = slice;
+	memcpy(HistoryRenameName, Slices[slice].Name, SLICE_NAME_SIZE);
+}
+
+// records what was typed since HistoryRenameBegin, if anything
+static void HistoryRenameEnd(void)
+{
+	int slice = HistoryRenameSlice;
+	HistoryRenameSlice = -1;
+
+	if (slice < 0 || slice >= SlicesCount)
+	{
+		return;
+	}
+
+	const char* before = HistoryRenameName;
+	const char* after = Slices[slice].Name;
+	int offset = 0;
+
+	while (before[offset] != '\0' && before[offset] == after[offset])
+	{
+		offset++;
+	}
+
+	if (before[offset] == after[offset])
+	{
+		return;
+	}
+
+	HistoryRecord record = {.Slice = slice,
+													.Op = HISTORY_RENAME,
+													.Offset = offset,
+													.BeforeLength = strlen(before + offset),
+													.AfterLength = strlen(after + offset)};
+	HistoryPush(record, before + offset, after + offset);
+}
+
+// applies the record at the position, forward for redo and back for undo
+static void HistoryApply(unsigned int at, bool forward)
+{
+	HistoryRecord record;
+	HistoryRead(at, &record, sizeof(record));
+	unsigned int before = at + sizeof(record);
+	unsigned int after = before + record.BeforeLength;
+	Slice* slice = &Slices[record.Slice];
+
+	switch (record.Op)
+	{
+		case HISTORY_ADD:
+		case HISTORY_REMOVE:
+			if (forward == (record.Op == HISTORY_REMOVE))
+			{
+				SliceRemove(record.Slice);
+			}
+			else if (SlicesCount < MAX_SLICES)
+			{
+				int length = forward ? record.AfterLength : record.BeforeLength;
+				SliceInsert(record.Slice, forward ? record.After : record.Before);
+				HistoryRead(forward ? after : before, slice->Name, length);
+				slice->Name[length] = '\0';
+			}
+			break;
+		case HISTORY_RECOLOR:
+			slice->Color = forward ? record.After : record.Before;
+			break;
+		case HISTORY_RENAME:
+		{
+			int length = forward ? record.AfterLength : record.BeforeLength;
+			HistoryRead(forward ? after : before, slice->Name + record.Offset,
+									length);
+			slice->Name[record.Offset + length] = '\0';
+		}
+		break;
+	}
+}
+
+static bool HistoryCanUndo(void)
+{
+	return HistoryCursor != HistoryTail;
+}
+
+static bool HistoryCanRedo(void)
+{
+	return HistoryCursor != HistoryHead;
+}
+
+// reverts the last step, the records of a step are undone last to first
+static void HistoryUndo(void)
+{
+	HistoryRecord record = {0};
+
+	while (HistoryCanUndo() && !record.First)
+	{
+		unsigned short size;
+		HistoryRead(HistoryCursor - sizeof(size), &size, sizeof(size));
+		HistoryCursor -= size;
+		HistoryRead(HistoryCursor, &record, sizeof(record));
+		HistoryApply(HistoryCursor, false);
+	}
+
+	HistoryNextFirst = true;
+}
+
+// applies the next step again
+static void HistoryRedo(void)
+{
+	HistoryRecord record;
+
+	for (bool started = false; HistoryCanRedo(); started = true)
+	{
+		HistoryRead(HistoryCursor, &record, sizeof(record));
+
+		if (started && record.First)
+		{
+			break;
+		}
+
+		HistoryApply(HistoryCursor, true);
+		HistoryCursor += HistoryRecordSize(record);
+	}
+
+	HistoryNextFirst = true;
+}
+
+#endif	// PICKLE_HISTORY
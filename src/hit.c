@@ -0,0 +1,165 @@
+#ifndef PICKLE_HIT
+#define PICKLE_HIT
+
+#include <math.h>
+
+#include "globals.c"
+#include "input.c"
+#include "log.c"
+#include "stats.c"
+
+// Widgets register their rectangles while they are drawn, and the pointer is
+// resolved once at the start of the next frame against a uniform grid over the
+// screen. Only the widgets in the cell under the pointer are tested, newer
+// widgets are on top, and a widget only asks whether it is the one that got
+// resolved, so it no longer matters in which order they are drawn
+#define HIT_GRID 16
+#define HIT_MAX_NODES 4096
+#define HIT_NONE -1
+
+typedef struct
+{
+	int Id;
+	Rectangle Rect;
+	// the next widget in the same cell, registered before this one
+	int Next;
+} HitNode;
+
+static HitNode HitNodes[HIT_MAX_NODES];
+static int HitNodeCount = 0;
+static int HitCells[HIT_GRID * HIT_GRID];
+// the screen size the cells were made for
+static int HitWidth = 0;
+static int HitHeight = 0;
+// topmost widget under the pointer
+static int HitHot = HIT_NONE;
+// widget the current press started on
+static int HitActive = HIT_NONE;
+static float HitHeldTime = 0;
+static float HitRepeatInterval = 0;
+static bool HitRepeat = false;
+
+static int HitCell(float position, int length)
+{
+	return fmin(fmax(position * HIT_GRID / fmax(length, 1), 0), HIT_GRID - 1);
+}
+
+static int HitFind(int x, int y)
+{
+	if (x < 0 || y < 0 || x > HitWidth || y > HitHeight)
+	{
+		return HIT_NONE;
+	}
+
+	int cell = HitCell(y, HitHeight) * HIT_GRID + HitCell(x, HitWidth);
+
+	for (int n = HitCells[cell]; n != HIT_NONE; n = HitNodes[n].Next)
+	{
+		Stats[STAT_HIT_TESTS]++;
+
+		if (CheckCollisionPointRec((Vector2){x, y}, HitNodes[n].Rect))
+		{
+			return HitNodes[n].Id;
+		}
+	}
+
+	return HIT_NONE;
+}
+
+// call once the input of the frame is sampled, resolves the pointer against
+// the widgets of the last frame and starts registering them again
+static void HitFrameBegin(void)
+{
+	HitHot = HitFind(Input.MouseX, Input.MouseY);
+	HitRepeat = false;
+
+	if (Input.MousePressed)
+	{
+		HitActive = HitHot;
+		HitHeldTime = 0;
+		HitRepeatInterval = INITIAL_REPEAT_INTERVAL;
+	}
+	else if (Input.MouseDown && HitActive != HIT_NONE)
+	{
+		HitHeldTime += Input.DeltaTime;
+
+		if (HitHeldTime >= HitRepeatInterval)
+		{
+			HitRepeat = true;
+			HitHeldTime = 0;
+			HitRepeatInterval = fmax(HitRepeatInterval * INITIAL_REPEAT_INTERVAL,
+															 MIN_REPEAT_INTERVAL);
+		}
+	}
+	else if (!Input.MouseReleased)
+	{
+		HitActive = HIT_NONE;
+	}
+
+	HitNodeCount = 0;
+	HitWidth = Input.ScreenWidth;
+	HitHeight = Input.ScreenHeight;
+
+	for (int c = 0; c < HIT_GRID * HIT_GRID; c++)
+	{
+		HitCells[c] = HIT_NONE;
+	}
+}
+
+// the press no longer belongs to a widget, like when it turns into a scroll
+static void HitCancel(void)
+{
+	HitActive = HIT_NONE;
+}
+
+static void HitRegister(int id, Rectangle rect)
+{
+	if (rect.x >= HitWidth || rect.y >= HitHeight || rect.x + rect.width < 0 ||
+			rect.y + rect.height < 0)
+	{
+		return;
+	}
+
+	int left = HitCell(rect.x, HitWidth);
+	int right = HitCell(rect.x + rect.width, HitWidth);
+	int top = HitCell(rect.y, HitHeight);
+	int bottom = HitCell(rect.y + rect.height, HitHeight);
+
+	LogIf(HitNodeCount + (right - left + 1) * (bottom - top + 1) > HIT_MAX_NODES,
+				LogAppend("ERROR: Too many widgets to hit test!\n"));
+
+	for (int row = top; row <= bottom; row++)
+	{
+		for (int col = left; col <= right && HitNodeCount < HIT_MAX_NODES; col++)
+		{
+			int cell = row * HIT_GRID + col;
+			HitNodes[HitNodeCount] = (HitNode){id, rect, HitCells[cell]};
+			HitCells[cell] = HitNodeCount++;
+		}
+	}
+}
+
+static bool HitHovered(int id)
+{
+	return id == HitHot;
+}
+
+// the press started on the widget and is still going, wherever the pointer is
+static bool HitHeld(int id)
+{
+	return id == HitActive && Input.MouseDown;
+}
+
+// released on the same widget the press started on
+static bool HitClicked(int id)
+{
+	return id == HitActive && id == HitHot && Input.MouseReleased;
+}
+
+// true every repeat interval while the widget is held
+static bool HitRepeated(int id)
+{
+	return HitRepeat && HitHeld(id);
+}
+
+#endif	// PICKLE_HIT
@@ -0,0 +1,196 @@
+#ifndef PICKLE_INPUT
+#define PICKLE_INPUT
+
+#include <string.h>
+
+#include "globals.c"
+#include "log.c"
+#include "queue.c"
+#include "stats.c"
+
+// most characters taken in a single frame, a paste is cut at this
+#define INPUT_MAX_CHARS 255
+
+// Keys the text fields use, set on the frame they are pressed and again every
+// time the system repeats them while held
+#define INPUT_KEY_LIST     \
+	X(Left, LEFT)            \
+	X(Right, RIGHT)          \
+	X(Home, HOME)            \
+	X(End, END)              \
+	X(Delete, DELETE)        \
+	X(SelectAll, SELECT_ALL) \
+	X(Copy, COPY)            \
+	X(Cut, CUT)              \
+	X(Shift, SHIFT)
+
+#define X(Name, NAME) INPUT_KEY_##NAME##_BIT,
+enum InputKeyBitEnum
+{
+	INPUT_KEY_LIST INPUT_KEYS_AMOUNT
+};
+#undef X
+
+#define X(Name, NAME) INPUT_KEY_##NAME = 1 << INPUT_KEY_##NAME##_BIT,
+enum InputKeyEnum
+{
+	INPUT_KEY_LIST
+};
+#undef X
+
+// Everything pickle reads from the platform in a frame, sampled once at the
+// start of the frame
+typedef struct
+{
+	float DeltaTime;
+	int ScreenWidth;
+	int ScreenHeight;
+	int MouseX;
+	int MouseY;
+	float MouseWheel;
+	bool MousePressed;
+	bool MouseDown;
+	bool MouseReleased;
+	bool EscapePressed;
+	bool BackspacePressed;
+	bool BackspaceDown;
+	bool UndoPressed;
+	bool RedoPressed;
+	// INPUT_KEY flags, shift is held rather than pressed
+	unsigned int Keys;
+#ifdef PLATFORM_ANDROID
+	int TouchCount;
+	Vector2 TouchPosition;
+#endif
+	int CharCount;
+	int Chars[INPUT_MAX_CHARS];
+} InputFrame;
+
+static InputFrame Input = {0};
+// fills the frame instead of the platform when set
+static void (*InputSource)(InputFrame* frame) = NULL;
+// sees every frame once it is sampled
+static void (*InputSink)(const InputFrame* frame) = NULL;
+// characters waiting for a text field
+static Queue InputQueue = {0};
+#ifdef PLATFORM_ANDROID
+// filled by the java ui thread with what the soft keyboard typed
+static Queue InputAndroidQueue = {0};
+#endif
+
+// pressed, or repeated by the system while held
+static bool InputKeyPressed(int key)
+{
+	return IsKeyPressed(key) || IsKeyPressedRepeat(key);
+}
+
+static void InputUpdate(void)
+{
+	memset(&Input, 0, sizeof(Input));
+	Input.ScreenWidth = GetScreenWidth();
+	Input.ScreenHeight = GetScreenHeight();
+
+	if (InputSource != NULL)
+	{
+		InputSource(&Input);
+	}
+	else
+	{
+		Input.DeltaTime = GetFrameTime();
+		Input.MouseX = GetMouseX();
+		Input.MouseY = GetMouseY();
+		Input.MouseWheel = GetMouseWheelMove();
+		Input.MousePressed = IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+		Input.MouseDown = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+		Input.MouseReleased = IsMouseButtonReleased(MOUSE_BUTTON_LEFT);
+		Input.EscapePressed = IsKeyPressed(KEY_ESCAPE);
+		Input.BackspacePressed = IsKeyPressed(KEY_BACKSPACE);
+		Input.BackspaceDown = IsKeyDown(KEY_BACKSPACE);
+
+		bool control = IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL);
+		bool shift = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+		Input.UndoPressed = control && !shift && IsKeyPressed(KEY_Z);
+		Input.RedoPressed = control && ((shift && IsKeyPressed(KEY_Z)) ||
+																		IsKeyPressed(KEY_Y));
+
+		Input.Keys |= InputKeyPressed(KEY_LEFT) ? INPUT_KEY_LEFT : 0;
+		Input.Keys |= InputKeyPressed(KEY_RIGHT) ? INPUT_KEY_RIGHT : 0;
+		Input.Keys |= InputKeyPressed(KEY_HOME) ? INPUT_KEY_HOME : 0;
+		Input.Keys |= InputKeyPressed(KEY_END) ? INPUT_KEY_END : 0;
+		Input.Keys |= InputKeyPressed(KEY_DELETE) ? INPUT_KEY_DELETE : 0;
+		Input.Keys |= control && IsKeyPressed(KEY_A) ? INPUT_KEY_SELECT_ALL : 0;
+		Input.Keys |= control && IsKeyPressed(KEY_C) ? INPUT_KEY_COPY : 0;
+		Input.Keys |= control && IsKeyPressed(KEY_X) ? INPUT_KEY_CUT : 0;
+		Input.Keys |= shift ? INPUT_KEY_SHIFT : 0;
+#ifdef PLATFORM_ANDROID
+		Input.TouchCount = GetTouchPointCount();
+		Input.TouchPosition = GetTouchPosition(0);
+#endif
+
+		int c;
+
+		while (Input.CharCount < INPUT_MAX_CHARS && (c = GetCharPressed()) != 0)
+		{
+			Input.Chars[Input.CharCount++] = c;
+		}
+
+#ifdef PLATFORM_ANDROID
+		while (Input.CharCount < INPUT_MAX_CHARS &&
+					 (c = QueuePop(&InputAndroidQueue)) != 0)
+		{
+			Input.Chars[Input.CharCount++] = c;
+		}
+#endif
+
+		// a paste is typed, so replays get it without the clipboard
+		if (control && IsKeyPressed(KEY_V))
+		{
+			const char* text = GetClipboardText();
+
+			for (int size = 0; text != NULL && *text != '\0' &&
+												 Input.CharCount < INPUT_MAX_CHARS;
+					 text += size)
+			{
+				Input.Chars[Input.CharCount++] = GetCodepointNext(text, &size);
+			}
+		}
+	}
+
+	if (InputSink != NULL)
+	{
+		InputSink(&Input);
+	}
+
+	// characters only wait for a selected text field, raylib also drops what
+	// was typed once the frame is over
+	for (int i = 0; i < Input.CharCount && TypingIndex >= 0; i++)
+	{
+		QueuePush(&InputQueue, Input.Chars[i]);
+	}
+
+	// counted in every build, a full queue loses what was typed
+	unsigned int dropped = QueueTakeDropped(&InputQueue);
+#ifdef PLATFORM_ANDROID
+	dropped += QueueTakeDropped(&InputAndroidQueue);
+#endif
+	Stats[STAT_DROPPED_CHARS] += dropped;
+	LogIf(dropped > 0,
+				LogAppend("ERROR: %u typed characters did not fit a queue!\n",
+									dropped));
+}
+
+// the next character typed or QUEUE_BACKSPACE, 0 when there are none
+static int InputGetChar(void)
+{
+	return QueuePop(&InputQueue);
+}
+
+// drops what was typed for a text field that is not selected anymore
+static void InputDropChars(void)
+{
+	while (QueuePop(&InputQueue) != 0)
+	{
+	}
+}
+
+#endif	// PICKLE_INPUT
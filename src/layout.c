@@ -0,0 +1,201 @@
+#ifndef PICKLE_LAYOUT
+#define PICKLE_LAYOUT
+
+#include <math.h>
+
+#include "globals.c"
+#include "log.c"
+#include "stats.c"
+
+// Sizes the rows and columns of a grid. Fixed sizes are taken first, then the
+// percentages of the space left after the padding, and fill cells split what
+// is still free by weight. Every cell ends on the rounded sum of the sizes
+// before it, so remainder pixels are spread over the cells instead of being
+// lost at the end
+typedef enum
+{
+	SIZE_PERCENT,
+	SIZE_FIXED,
+	SIZE_FILL,
+} SizeKind;
+
+typedef struct
+{
+	SizeKind Kind;
+	// percent, pixels or fill weight
+	float Value;
+} Size;
+
+#define PERCENT(value) ((Size){SIZE_PERCENT, (value)})
+#define FIXED(pixels) ((Size){SIZE_FIXED, (pixels)})
+#define FILL(weight) ((Size){SIZE_FILL, (weight)})
+
+#define LAYOUT_MAX_ROWS 16
+#define LAYOUT_MAX_CELLS 64
+
+// The cells are relative to the container and only solved again when its
+// size or the padding change, the sizes must stay the same for a layout
+typedef struct
+{
+	int Width;
+	int Height;
+	int Padding;
+	int Count;
+	Rectangle Cells[LAYOUT_MAX_CELLS];
+} GridLayout;
+
+// never matches a container, so the first use solves it
+#define GRID_LAYOUT_EMPTY {.Width = -1, .Height = -1, .Padding = -1}
+
+static bool GridLayoutValid(const GridLayout* layout,
+														int width,
+														int height,
+														int padding)
+{
+	return layout->Width == width && layout->Height == height &&
+				 layout->Padding == padding;
+}
+
+// false when the sizes take more than the length
+static bool SolveSizes(const Size* sizes,
+											 int count,
+											 int length,
+											 int padding,
+											 int* lengths)
+{
+	float available = length - padding * (count - 1);
+	float taken = 0;
+	float weights = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		switch (sizes[i].Kind)
+		{
+			case SIZE_FIXED:
+				taken += sizes[i].Value;
+				break;
+			case SIZE_PERCENT:
+				taken += available * sizes[i].Value / 100;
+				break;
+			case SIZE_FILL:
+				weights += sizes[i].Value;
+				break;
+		}
+	}
+
+	float remaining = fmax(available - taken, 0);
+	float end = 0;
+	int previous = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		switch (sizes[i].Kind)
+		{
+			case SIZE_FIXED:
+				end += sizes[i].Value;
+				break;
+			case SIZE_PERCENT:
+				end += available * sizes[i].Value / 100;
+				break;
+			case SIZE_FILL:
+				end += weights > 0 ? remaining * sizes[i].Value / weights : 0;
+				break;
+		}
+
+		int rounded = roundf(end);
+		lengths[i] = rounded - previous;
+		previous = rounded;
+	}
+
+	return taken <= available + 0.5f;
+}
+
+// Takes the size of every row, the column count of every row and the sizes
+// of all the columns one row after the other, in the same order as the cells
+static void SolveGrid(GridLayout* layout,
+											int width,
+											int height,
+											int padding,
+											const Size* rows,
+											int rowsAmount,
+											const int* columnCounts,
+											const Size* columns)
+{
+	int rowLengths[LAYOUT_MAX_ROWS];
+	int columnLengths[LAYOUT_MAX_CELLS];
+	int y = 0;
+
+	Stats[STAT_LAYOUTS]++;
+	rowsAmount = fmin(rowsAmount, LAYOUT_MAX_ROWS);
+
+	if (!SolveSizes(rows, rowsAmount, height, padding, rowLengths))
+	{
+		LogAppend("ERROR: The grid rows take more than the available height!\n");
+	}
+
+	layout->Count = 0;
+
+	for (int r = 0; r < rowsAmount; r++)
+	{
+		int count = fmin(columnCounts[r], LAYOUT_MAX_CELLS - layout->Count);
+		int x = 0;
+
+		if (!SolveSizes(columns + layout->Count, count, width, padding,
+										columnLengths))
+		{
+			LogAppend("ERROR: Grid row %d takes more than the available width!\n",
+								r + 1);
+		}
+
+		for (int c = 0; c < count; c++)
+		{
+			layout->Cells[layout->Count++] =
+					(Rectangle){x, y, columnLengths[c], rowLengths[r]};
+			x += columnLengths[c] + padding;
+		}
+
+		y += rowLengths[r] + padding;
+	}
+
+	layout->Width = width;
+	layout->Height = height;
+	layout->Padding = padding;
+}
+
+// Walks the cells of a grid in order, row and column index the rows and
+// their Columns and cell the cells. The grids use different row structs, so
+// like LogIf this is a macro, COUNT names the member with the column count
+#define GRID_EACH_CELL(rows, rowsAmount, COUNT, row, column, cell, code) \
+	for (int row = 0, cell = 0; row < (rowsAmount); row++)                 \
+	{                                                                      \
+		for (int column = 0;                                                 \
+				 column < (rows)[row].COUNT && cell < LAYOUT_MAX_CELLS;          \
+				 column++, cell++)                                               \
+		{                                                                    \
+			code                                                               \
+		}                                                                    \
+	}
+
+// Solves the cells of rows with a Height and Columns with a Width, only when
+// the container changed since the last time
+#define LAYOUT_GRID(layout, width, height, padding, rows, rowsAmount, COUNT) \
+	if (!GridLayoutValid((layout), (width), (height), (padding)))              \
+	{                                                                          \
+		Size rowSizes[LAYOUT_MAX_ROWS];                                          \
+		int columnCounts[LAYOUT_MAX_ROWS];                                       \
+		Size columnSizes[LAYOUT_MAX_CELLS];                                      \
+		int amount = fmin((rowsAmount), LAYOUT_MAX_ROWS);                        \
+                                                                             \
+		for (int i = 0; i < amount; i++)                                         \
+		{                                                                        \
+			rowSizes[i] = (rows)[i].Height;                                        \
+			columnCounts[i] = (rows)[i].COUNT;                                     \
+		}                                                                        \
+                                                                             \
+		GRID_EACH_CELL(rows, amount, COUNT, r, c, cell,                          \
+									 columnSizes[cell] = (rows)[r].Columns[c].Width;)          \
+		SolveGrid((layout), (width), (height), (padding), rowSizes, amount,      \
+							columnCounts, columnSizes);                                    \
+	}
+
+#endif	// PICKLE_LAYOUT
@@ -1,43 +1,21 @@
-#ifndef clamp
-#	define clamp(val, min_val, max_val) \
-		((val) > (max_val) ? (max_val) : ((val) < (min_val) ? (min_val) : (val)))
-#endif
-
-#define FUNCS                                                      \
-	FUNC(SelectTextField, int FieldIndex)                            \
-	FUNC(ColorPick, int buttonRow, int buttonColumn, int SliceIndex) \
-	FUNC(AddEntry)                                                   \
-	FUNC(RemoveEntry, int SliceIndex)                                \
-	FUNC(ToggleMenu)
-
 #include "globals.c"
-#include "../assets/iosevka-regular.h"
-#include "funcs.c"
+#include "assets.c"
+#include "text.c"
 
 #include "draw.c"
+#include "ui.c"
 #include "log.c"
+#include "profile.c"
+#include "flight.c"
+#include "pace.c"
+#include "bench.c"
+#include "replay.c"
+#include "startup.c"
 
 #ifdef PLATFORM_ANDROID
 #	include <android_native_app_glue.h>
 #	include <jni.h>
 
-#	define ANDROID_INPUT_BUFFER_SIZE 1024
-static char androidInputBuffer[ANDROID_INPUT_BUFFER_SIZE];
-static int androidInputHead = 0;
-static int androidInputTail = 0;
-static bool androidDeletePressed = false;
-
-// called from JNI when it uses override below
-void AddAndroidInput(char c)
-{
-	int nextHead = (androidInputHead + 1) % ANDROID_INPUT_BUFFER_SIZE;
-	if (nextHead != androidInputTail)
-	{
-		androidInputBuffer[androidInputHead] = c;
-		androidInputHead = nextHead;
-	}
-}
-
 // overriding JNI, called from Java
 JNIEXPORT void JNICALL
 Java_com_lucasta_pickle_NativeLoader_nativeOnTextInput(JNIEnv* env,
@@ -47,10 +25,7 @@ Java_com_lucasta_pickle_NativeLoader_nativeOnTextInput(JNIEnv* env,
 	const char* str = (*env)->GetStringUTFChars(env, text, NULL);
 	if (str != NULL)
 	{
-		for (int i = 0; str[i] != '\0'; i++)
-		{
-			AddAndroidInput(str[i]);
-		}
+		QueuePushText(&InputAndroidQueue, str);
 	}
 	(*env)->ReleaseStringUTFChars(env, text, str);
 }
@@ -59,17 +34,7 @@ Java_com_lucasta_pickle_NativeLoader_nativeOnTextInput(JNIEnv* env,
 JNIEXPORT void JNICALL
 Java_com_lucasta_pickle_NativeLoader_nativeOnKeyDelete(JNIEnv* env, jobject obj)
 {
-	androidDeletePressed = true;
-}
-
-// "normal" c functions
-char GetAndroidInput(void)
-{
-	if (androidInputHead == androidInputTail)
-		return 0;
-	char c = androidInputBuffer[androidInputTail];
-	androidInputTail = (androidInputTail + 1) % ANDROID_INPUT_BUFFER_SIZE;
-	return c;
+	QueuePush(&InputAndroidQueue, QUEUE_BACKSPACE);
 }
 
 void ShowAndroidKeyboard(void)
@@ -117,116 +82,172 @@ void HideAndroidKeyboard(void)
 }
 #endif
 
-static void SelectTextFieldFunc(SelectTextFieldArgs args)
+int main(int argc, char** argv)
 {
-	TypingIndex = args.FieldIndex;
-}
-
-static void ColorPickFunc(ColorPickArgs args)
-{
-	Slices[args.SliceIndex].Color =
-			args.buttonRow * (COLORS_AMOUNT / PALETTE_ROW_AMOUNT) + args.buttonColumn;
-}
+	StartupBegin();
 
-static void AddEntryFunc()
-{
-	strncpy(Slices[SlicesCount].Name, DEFAULT_SLICES[SlicesCount].Name,
-					SLICE_NAME_SIZE);
-	Slices[SlicesCount].Color = DEFAULT_SLICES[SlicesCount].Color;
-	SlicesCount++;
-}
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--trace") == 0)
+		{
+			int frames = TRACE_DEFAULT_FRAMES;
 
-static void RemoveEntryFunc(RemoveEntryArgs args)
-{
-	memmove(&Slices[args.SliceIndex], &Slices[args.SliceIndex + 1],
-					(SlicesCount - args.SliceIndex - 1) * sizeof(Slice));
-	SlicesCount--;
-}
+			if (i + 1 < argc && isdigit(argv[i + 1][0]))
+			{
+				frames = atoi(argv[++i]);
+			}
 
-static void ToggleMenuFunc()
-{
-	CurrentScene = !CurrentScene;
-}
+			TraceStart(frames);
+		}
+		else if (strcmp(argv[i], "--hitch-budget") == 0 && i + 1 < argc)
+		{
+			FlightBudget = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--startup-bench") == 0)
+		{
+			StartupBenchOut = "pickle-startup.json";
 
-#define DRAW_BUTTON(x, y, width, height, text, fontSize, repeatPresses,     \
-										textColor, backgroundColor, pressedColor, hoveredColor, \
-										borderColor, borderThickness, shadowStyle, icon, Name,  \
-										argsPtr)                                                \
-	DrawButton(x, y, width, height, text, fontSize, repeatPresses, textColor, \
-						 backgroundColor, pressedColor, hoveredColor, borderColor,      \
-						 borderThickness, shadowStyle, icon, Name##Wrapper, argsPtr)
+			if (i + 1 < argc && argv[i + 1][0] != '-')
+			{
+				StartupBenchOut = argv[++i];
+			}
+		}
+		else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+		{
+			ReplayRecordPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+		{
+			ReplayPlayPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "--replay-fast") == 0)
+		{
+			ReplayFast = true;
+		}
+#ifdef BENCH
+		else if (strcmp(argv[i], "--bench") == 0 && i + 1 < argc)
+		{
+			if (!BenchStart(argv[++i]))
+			{
+				return 1;
+			}
+		}
+		else if (strcmp(argv[i], "--bench-out") == 0 && i + 1 < argc)
+		{
+			BenchOut = argv[++i];
+		}
+		else if (strcmp(argv[i], "--queue-stress") == 0)
+		{
+			return BenchQueueStress();
+		}
+#endif
+	}
 
-int main()
-{
 	SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_WINDOW_HIGHDPI |
 								 FLAG_MSAA_4X_HINT);
+	PaceConfigure(!ReplayFast);
+	BenchConfigure();
 #ifdef PLATFORM_WINDOWS
 	InitWindow(800, 600, APP_NAME);
 #else
 	InitWindow(ScreenWidth, ScreenHeight, APP_NAME);
 #endif
 	SetExitKey(KEY_NULL);
-	SetTargetFPS(144);
+	// raylib would spin until every deadline, the frames are paced here
+	SetTargetFPS(0);
+	PaceSetTarget(TARGET_FPS);
+	StartupMark(STARTUP_INIT_WINDOW);
 
 #ifndef PLATFORM_ANDROID
 	ChangeDirectory("assets");
 #endif
 
-	Fonte = LoadFont_Iosevka();
-
-#define X(Name, NAME)                                          \
-	Texture2D Name##Texture = LoadTextureFromImage(Name##Image); \
-	SetTextureFilter(Name##Texture, TEXTURE_FILTER_POINT);
-	ICON_LIST
-#undef X
+	Image atlas = GenAtlas();
+	BakeShadows(&atlas);
+	LoadAtlas(atlas);
+	StatShapesTexture = Atlas.id;
+	LoadText();
+	StartupMark(STARTUP_LOAD_ATLAS);
 
-	ImageFormat(&WindowImage, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
-	SetWindowIcon(WindowImage);
+	// the icons are generated as rgba, which is what the window icon needs
+	Image windowImage = LoadEmbeddedImage(WINDOWICON);
+	SetWindowIcon(windowImage);
+	UnloadEmbeddedImage(windowImage, WINDOWICON);
+	StartupMark(STARTUP_WINDOW_ICON);
 
 #ifndef PLATFORM_ANDROID
 	ChangeDirectory("..");
 #endif
 
-	SetTextureFilter(Fonte.texture, TEXTURE_FILTER_BILINEAR);
+	BenchSetup();
+	ReplaySetup();
 
 	while (!WindowShouldClose())
 	{
-		// key events
+		ProfileBegin(ZONE_FRAME);
+		StatsFrameBegin();
+
+		// update mouse and touch information
 		{
-			if (IsKeyPressed(KEY_ESCAPE))
+			ProfileBegin(ZONE_INPUT);
+			InputUpdate();
+			DeltaTime = Input.DeltaTime;
+#ifdef PLATFORM_ANDROID
+			TouchCount = Input.TouchCount;
+#else
+			MouseScroll = Input.MouseWheel * 32;
+
+			if (MouseScroll != 0)
+			{
+				TraceInstant("input", "Mouse scrolled", MouseScroll);
+			}
+#endif
+
+			MouseX = Input.MouseX;
+			MouseY = Input.MouseY;
+			Clicked = false;
+			HitFrameBegin();
+
+			if (Input.MousePressed)
+			{
+				MousePressedX = MouseX;
+				MousePressedY = MouseY;
+				Clicked = true;
+				TraceInstant("input", "Mouse pressed", 0);
+			}
+			else if (Input.MouseReleased)
 			{
-				CurrentScene = !CurrentScene;
+				TraceInstant("input", "Mouse released", 0);
 			}
+
+			ProfileEnd(ZONE_INPUT);
 		}
 
 		// update screen information
 		{
-			ScreenWidth = GetScreenWidth();
-			ScreenHeight = GetScreenHeight();
+			ScreenWidth = Input.ScreenWidth;
+			ScreenHeight = Input.ScreenHeight;
 			FontSize = (ScreenWidth + ScreenHeight) / 70;
 			Border = fmax((float)ScreenWidth / 500, 1);
 			Padding = Border * 2;
-			DeltaTime = GetFrameTime();
+			UiLayoutUpdate();
 		}
 
-		// update mouse and touch information
+		// key events
 		{
-#ifdef PLATFORM_ANDROID
-			TouchCount = GetTouchPointCount();
-#else
-			MouseScroll = GetMouseWheelMove() * 32;
-#endif
-
-			MouseX = GetMouseX();
-			MouseY = GetMouseY();
-			ButtonWasPressed = false;
-			Clicked = false;
+			if (Input.EscapePressed)
+			{
+				TraceInstant("input", "Escape pressed", 0);
+				CommandPush(COMMAND(TOGGLE_MENU, 0, 0));
+			}
 
-			if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+			if (Input.UndoPressed)
 			{
-				MousePressedX = MouseX;
-				MousePressedY = MouseY;
-				Clicked = true;
+				CommandPush(COMMAND(UNDO, 0, 0));
+			}
+			else if (Input.RedoPressed)
+			{
+				CommandPush(COMMAND(REDO, 0, 0));
 			}
 		}
 
@@ -235,33 +256,27 @@ int main()
 			BeginDrawing();
 			ClearBackground(BACKGROUND_COLOR);
 
-			int squareButtonSize =
-					(ScreenWidth < ScreenHeight ? ScreenWidth : ScreenHeight) / 8;
-			Rectangle cornerButtonRect = {ScreenWidth - squareButtonSize - Padding,
-																		Padding, squareButtonSize,
-																		squareButtonSize};
-			int sidePadding = squareButtonSize + Padding;
-			int menuX = (ScreenWidth < ScreenHeight ? 0 : squareButtonSize + Padding);
-			int menuEntryWidth =
-					ScreenWidth -
-					(ScreenWidth < ScreenHeight ? sidePadding : sidePadding * 2);
-			int menuVisibleEntries = (ScreenWidth < ScreenHeight ? 6 : 3);
-			int menuEntryHeight = ScreenHeight / menuVisibleEntries;
+			int squareButtonSize = Ui.SquareButtonSize;
+			Rectangle cornerButtonRect = Ui.Rects[UI_CORNER];
+			int menuVisibleEntries = Ui.VisibleEntries;
+			int menuEntryHeight = Ui.EntryHeight;
 
 			switch (CurrentScene)
 			{
 				case SCENE_MENU:
 				{
+					ProfileBegin(ZONE_MENU);
+
 					{
 #ifdef PLATFORM_ANDROID
-						if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+						if (Input.MousePressed)
 						{
-							StartTouchPosition = GetTouchPosition(0);
+							StartTouchPosition = Input.TouchPosition;
 						}
 
-						if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
+						if (Input.MouseDown)
 						{
-							Vector2 currentTouchPosition = GetTouchPosition(0);
+							Vector2 currentTouchPosition = Input.TouchPosition;
 
 							float touchMoveDistance =
 									fabsf(currentTouchPosition.y - StartTouchPosition.y);
@@ -274,11 +289,12 @@ int main()
 																		ScreenHeight))
 							{
 								Dragging = true;
+								HitCancel();
 								MenuScrollOffset =
 										clamp(MenuScrollOffset + currentTouchPosition.y -
 															StartTouchPosition.y,
 													clamp(SlicesCount - (menuVisibleEntries - 1), 0,
-																COLORS_AMOUNT - menuVisibleEntries) *
+																MAX_SLICES - menuVisibleEntries) *
 															-menuEntryHeight,
 													0);
 								StartTouchPosition = currentTouchPosition;
@@ -288,41 +304,46 @@ int main()
 						if (MouseScroll > 0)
 						{
 							Dragging = true;
+							HitCancel();
 						}
 
 						MenuScrollOffset =
 								clamp(MenuScrollOffset + MouseScroll,
 											clamp(SlicesCount - (menuVisibleEntries - 1), 0,
-														COLORS_AMOUNT - menuVisibleEntries) *
+														MAX_SLICES - menuVisibleEntries) *
 													-menuEntryHeight,
 											0);
 #endif
 
 						// draw a button to add a slice
-						if (SlicesCount < COLORS_AMOUNT)
+						if (SlicesCount < MAX_SLICES)
 						{
-							int addButtonY = MenuScrollOffset + menuEntryHeight * SlicesCount;
-
-							DRAW_BUTTON(menuX, addButtonY, menuEntryWidth, menuEntryHeight,
-													"", FontSize, false, FOREGROUND_COLOR,
-													BACKGROUND_COLOR, PRESSED_COLOR, HOVERED_COLOR,
-													FOREGROUND_COLOR, Border, NO_SHADOW, NO_ICON,
-													AddEntry, 0);
+							Rectangle addButtonRect = UiEntryRect(
+									UI_ENTRY, MenuScrollOffset + menuEntryHeight * SlicesCount);
+
+							DrawButton(UiId(UI_ENTRY, SlicesCount), addButtonRect.x,
+												 addButtonRect.y, addButtonRect.width,
+												 addButtonRect.height, "", FontSize, false,
+												 FOREGROUND_COLOR, BACKGROUND_COLOR, PRESSED_COLOR,
+												 HOVERED_COLOR, FOREGROUND_COLOR, Border, NO_SHADOW,
+												 NO_ICON, COMMAND(ADD_ENTRY, 0, 0));
 							// plus sign
-							DrawCross(menuX + menuEntryWidth / 2,
-												addButtonY + menuEntryHeight / 2, 0,
+							DrawCross(addButtonRect.x + addButtonRect.width / 2,
+												addButtonRect.y + menuEntryHeight / 2, 0,
 												(float)menuEntryHeight / 2, menuEntryHeight / 10,
 												FOREGROUND_COLOR);
 						}
 
-						for (int i = 0; i < SlicesCount; i++)
+						// only the entries on the screen are drawn, the one being typed
+						// in keeps its input until it is scrolled back
+						int firstEntry = fmax(-MenuScrollOffset / menuEntryHeight, 0);
+						int lastEntry =
+								fmin(firstEntry + menuVisibleEntries + 2, SlicesCount);
+
+						for (int i = firstEntry; i < lastEntry; i++)
 						{
-							Vector2 sliceNameTextSize = MeasureTextEx(
-									Fonte, Slices[i].Name, FontSize * 2, TEXT_SPACING);
 							int menuEntryY = MenuScrollOffset + i * menuEntryHeight;
-
-							Rectangle menuEntryRect = {menuX, menuEntryY, menuEntryWidth,
-																				 menuEntryHeight};
+							Rectangle menuEntryRect = UiEntryRect(UI_ENTRY, menuEntryY);
 
 							// slice entry background
 							DrawRectangleRec(menuEntryRect, COLORS[Slices[i].Color]);
@@ -332,129 +353,89 @@ int main()
 
 							// draw color palette
 							{
-								ButtonRow palette[PALETTE_ROW_AMOUNT] = {
-										{PALETTE_ROW_PERCENTAGE, PALETTE_COL_AMOUNT,
-										 (Button[PALETTE_COL_AMOUNT]){{0}}},
-										{PALETTE_ROW_PERCENTAGE, PALETTE_COL_AMOUNT,
-										 (Button[PALETTE_COL_AMOUNT]){{0}}}};
-								int paletteX = menuX + Padding;
-								int paletteY = menuEntryY + sliceNameTextSize.y + Padding * 2;
-								int paletteHeight =
-										menuEntryHeight - sliceNameTextSize.y - Padding * 4;
-								int paletteWidth = menuEntryWidth - sidePadding - Padding;
-
-								static ColorPickArgs colorPickArgs[COLORS_AMOUNT]
-																									[COLORS_AMOUNT];
+								ProfileBegin(ZONE_PALETTE);
 
 								for (int c = 0; c < COLORS_AMOUNT; c++)
 								{
-									colorPickArgs[i][c].SliceIndex = i;
-									colorPickArgs[i][c].buttonColumn =
-											c % (COLORS_AMOUNT / PALETTE_ROW_AMOUNT);
-									colorPickArgs[i][c].buttonRow =
-											c / (COLORS_AMOUNT / PALETTE_ROW_AMOUNT);
-
-									palette[c / (COLORS_AMOUNT / PALETTE_ROW_AMOUNT)]
-											.Columns[c % (COLORS_AMOUNT / PALETTE_ROW_AMOUNT)] =
-											(Button){PALETTE_COL_PERCENTAGE,
-															 "",
-															 FontSize,
-															 false,
-															 FOREGROUND_COLOR,
-															 COLORS[c],
-															 COLORS[c],
-															 COLORS[c],
-															 GetContrastedTextColor(COLORS[c]),
-															 c == Slices[i].Color ? Padding : Border,
-															 NO_SHADOW,
-															 NO_ICON,
-															 ColorPickWrapper,
-															 &colorPickArgs[i][c]};
+									const Button* button =
+											&UiPaletteColumns[c / PALETTE_COL_AMOUNT]
+																			 [c % PALETTE_COL_AMOUNT];
+									Rectangle rect =
+											UiEntryRect(UI_ENTRY_PALETTE + c, menuEntryY);
+									Command command = button->Command;
+									command.Slice = i;
+									// the only thing that changes from frame to frame
+									int borderThickness = c == Slices[i].Color
+																						? Padding
+																						: button->BorderThickness;
+
+									DrawButton(UiId(UI_ENTRY_PALETTE + c, i), rect.x, rect.y,
+														 rect.width, rect.height, button->Text,
+														 button->FontSize, button->RepeatPresses,
+														 button->TextColor, button->BackgroundColor,
+														 button->PressedColor, button->HoveredColor,
+														 button->BorderColor, borderThickness,
+														 button->ShadowStyle, button->Icon, command);
 								}
 
-								DrawButtonGrid(paletteX, paletteY, paletteWidth, paletteHeight,
-															 Padding, palette, PALETTE_ROW_AMOUNT);
+								ProfileEnd(ZONE_PALETTE);
 							}
 
 							// draw editable text box
 							{
-								Rectangle menuEntryTextFieldRect = {
-										menuX + Padding, menuEntryY + Padding,
-										menuEntryWidth - sidePadding * 2, sliceNameTextSize.y};
+								Rectangle menuEntryTextFieldRect =
+										UiEntryRect(UI_ENTRY_NAME, menuEntryY);
 
 								if (TypingIndex != i)
 								{
-									SelectTextFieldArgs args = {i};
-									DRAW_BUTTON(
-											menuEntryTextFieldRect.x, menuEntryTextFieldRect.y,
-											menuEntryTextFieldRect.width,
+									DrawButton(
+											UiId(UI_ENTRY_NAME, i), menuEntryTextFieldRect.x,
+											menuEntryTextFieldRect.y, menuEntryTextFieldRect.width,
 											menuEntryTextFieldRect.height, Slices[i].Name, FontSize,
 											false, FOREGROUND_COLOR, BACKGROUND_COLOR, PRESSED_COLOR,
-											HOVERED_COLOR, FOREGROUND_COLOR, Border, NO_SHADOW,
-											NO_ICON, SelectTextField, &args);
+											HOVERED_COLOR, FOREGROUND_COLOR, Border, Ui.Shadow,
+											NO_ICON, COMMAND(SELECT_TEXT_FIELD, i, 0));
 								}
 								else
 								{
 #ifdef PLATFORM_ANDROID
 									ShowAndroidKeyboard();
 #endif
+									EditUpdate(&Edit, i);
+
 									DrawTextField(menuEntryTextFieldRect.x,
 																menuEntryTextFieldRect.y,
 																menuEntryTextFieldRect.width,
 																menuEntryTextFieldRect.height, FOREGROUND_COLOR,
-																HIGHLIGHT_COLOR, FOREGROUND_COLOR, FontSize,
-																Border, Slices[i].Name);
-
-#ifdef PLATFORM_ANDROID
-									char inputChar;
-
-									while ((inputChar = GetAndroidInput()) != 0)
-									{
-										int len = strlen(Slices[i].Name);
-										if (len < SLICE_NAME_SIZE - 1)
-										{
-											Slices[i].Name[len] = tolower(inputChar);
-											Slices[i].Name[len + 1] = '\0';
-										}
-									}
-
-									if (androidDeletePressed)
-									{
-										int len = strlen(Slices[i].Name);
-										if (len > 0)
-										{
-											Slices[i].Name[len - 1] = '\0';
-										}
-
-										androidDeletePressed = false;
-									}
-#endif
+																HIGHLIGHT_COLOR, FOREGROUND_COLOR,
+																SELECTION_COLOR, FontSize, Border, Ui.Shadow,
+																&Edit);
 								}
 							}
 
 							// draw a trash button to delete slices
 							{
-								Rectangle trashButtonRect = {
-										menuX + menuEntryWidth - sidePadding, menuEntryY + Padding,
-										squareButtonSize, squareButtonSize};
-
-								RemoveEntryArgs args = {i};
-								DRAW_BUTTON(trashButtonRect.x, trashButtonRect.y,
-														trashButtonRect.width, trashButtonRect.height, "",
-														FontSize, false, RED, BACKGROUND_COLOR,
-														RED_PRESSED_COLOR, RED_HOVERED_COLOR, RED, Padding,
-														NO_SHADOW, TrashTexture, RemoveEntry, &args);
+								Rectangle trashButtonRect =
+										UiEntryRect(UI_ENTRY_TRASH, menuEntryY);
+
+								DrawButton(UiId(UI_ENTRY_TRASH, i), trashButtonRect.x,
+													 trashButtonRect.y, trashButtonRect.width,
+													 trashButtonRect.height, "", FontSize, false, RED,
+													 BACKGROUND_COLOR, RED_PRESSED_COLOR,
+													 RED_HOVERED_COLOR, RED, Padding, Ui.Shadow,
+													 TrashIcon, COMMAND(REMOVE_ENTRY, i, 0));
 							}
 						}
 					}
 
 					// Draw a close button
 					{
-						DRAW_BUTTON(cornerButtonRect.x, cornerButtonRect.y,
-												cornerButtonRect.width, cornerButtonRect.height, "",
-												FontSize, false, RED, BACKGROUND_COLOR,
-												RED_PRESSED_COLOR, RED_HOVERED_COLOR, RED, Padding,
-												NO_SHADOW, NO_ICON, ToggleMenu, 0);
+						DrawButton(UiId(UI_CORNER, 0), cornerButtonRect.x,
+											 cornerButtonRect.y, cornerButtonRect.width,
+											 cornerButtonRect.height, "", FontSize, false, RED,
+											 BACKGROUND_COLOR, RED_PRESSED_COLOR, RED_HOVERED_COLOR,
+											 RED, Padding, NO_SHADOW, NO_ICON,
+											 COMMAND(TOGGLE_MENU, 0, 0));
 
 						// x sign
 						DrawCross(cornerButtonRect.x + cornerButtonRect.width / 2,
@@ -462,32 +443,48 @@ int main()
 											squareButtonSize, squareButtonSize / 8, RED);
 					}
 
-					if (Clicked)
+					// Draw an undo button under it
+					if (HistoryCanUndo())
+					{
+						Rectangle undoButtonRect = Ui.Rects[UI_UNDO];
+
+						DrawButton(UiId(UI_UNDO, 0), undoButtonRect.x, undoButtonRect.y,
+											 undoButtonRect.width, undoButtonRect.height, "undo",
+											 FontSize, false, FOREGROUND_COLOR, BACKGROUND_COLOR,
+											 PRESSED_COLOR, HOVERED_COLOR, FOREGROUND_COLOR, Padding,
+											 Ui.Shadow, NO_ICON, COMMAND(UNDO, 0, 0));
+					}
+
+					UiPaletteCheck();
+
+					if (Clicked && TypingIndex >= 0)
 					{
-						TypingIndex = -1;
+						CommandPush(COMMAND(SELECT_TEXT_FIELD, -1, 0));
 #ifdef PLATFORM_ANDROID
 						HideAndroidKeyboard();
 #endif
 					}
+
+					ProfileEnd(ZONE_MENU);
 				}
 				break;
 				default:
 					// Draw the wheel
 					{
 						{
-							int wheelRadius = (ScreenWidth < ScreenHeight
-																		 ? ScreenWidth / 2 - ScreenWidth / 16
-																		 : ScreenHeight / 2 - ScreenHeight / 32);
+							int wheelRadius = Ui.WheelRadius;
 
 							if (SlicesCount == 0)
 							{
 								WheelAngle -= 5 * DeltaTime;
-								DrawWheel(WheelAngle, wheelRadius, DEFAULT_SLICES,
-													COLORS_AMOUNT);
+								ProfileZone(ZONE_WHEEL,
+														DrawWheel(WheelAngle, wheelRadius, DEFAULT_SLICES,
+																			COLORS_AMOUNT););
 							}
 							else
 							{
-								DrawWheel(WheelAngle, wheelRadius, Slices, SlicesCount);
+								ProfileZone(ZONE_WHEEL, DrawWheel(WheelAngle, wheelRadius,
+																									Slices, SlicesCount););
 
 								if (WheelAcceleration > 0)
 								{
@@ -503,9 +500,12 @@ int main()
 								}
 								else if (WheelPickedIndex >= STATE_WINNER)
 								{
-									Vector2 winnerTextSize =
-											MeasureTextEx(Fonte, Slices[WheelPickedIndex].Name,
-																		FontSize, TEXT_SPACING);
+									Vector2 winnerTextSize;
+									ProfileZone(
+											ZONE_TEXT_MEASURE,
+											winnerTextSize =
+													TextMeasure(Slices[WheelPickedIndex].Name, FontSize,
+																			TEXT_SPACING););
 
 									Color winnerColor = COLORS[Slices[WheelPickedIndex].Color];
 
@@ -523,11 +523,12 @@ int main()
 									switch (PopupState)
 									{
 										case POPUP_WAITING:
+											FlightIgnoreFrame();
 											WaitTime(1);
 											PopupState = POPUP_DISMISSIBLE;
 											break;
 										case POPUP_DISMISSIBLE:
-											if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+											if (Input.MousePressed)
 											{
 												PopupState = POPUP_NONE;
 												WheelPickedIndex = STATE_NO_WINNER;
@@ -540,16 +541,17 @@ int main()
 								}
 								else
 								{
-									WheelTextSize =
-											MeasureTextEx(Fonte, WHEEL_TEXT, FontSize, TEXT_SPACING);
+									ProfileZone(ZONE_TEXT_MEASURE,
+															WheelTextSize = TextMeasure(WHEEL_TEXT, FontSize,
+																										TEXT_SPACING););
 
-									DrawTextEx(
-											Fonte, WHEEL_TEXT,
+									TextDraw(
+											WHEEL_TEXT,
 											(Vector2){(float)ScreenWidth / 2 - WheelTextSize.x / 2,
 																(float)ScreenHeight / 2 - WheelTextSize.y / 2},
 											FontSize, TEXT_SPACING, HIGHLIGHT_COLOR);
 
-									if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) &&
+									if (Input.MousePressed &&
 											CheckCollisionPointCircle(
 													(Vector2){MouseX, MouseY},
 													(Vector2){(float)ScreenWidth / 2,
@@ -572,35 +574,52 @@ int main()
 
 						// Draw a menu button
 						{
-							DRAW_BUTTON(cornerButtonRect.x, cornerButtonRect.y,
-													cornerButtonRect.width, cornerButtonRect.height, "",
-													FontSize, false, FOREGROUND_COLOR, BACKGROUND_COLOR,
-													PRESSED_COLOR, HOVERED_COLOR, FOREGROUND_COLOR,
-													Padding, NO_SHADOW, MenuTexture, ToggleMenu, 0);
+							DrawButton(UiId(UI_CORNER, 0), cornerButtonRect.x,
+												 cornerButtonRect.y, cornerButtonRect.width,
+												 cornerButtonRect.height, "", FontSize, false,
+												 FOREGROUND_COLOR, BACKGROUND_COLOR, PRESSED_COLOR,
+												 HOVERED_COLOR, FOREGROUND_COLOR, Padding, Ui.Shadow,
+												 MenuIcon, COMMAND(TOGGLE_MENU, 0, 0));
 						}
 					}
 					break;
 			}
 
-			if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
+			CommandsApply();
+
+			if (Input.MouseReleased)
 			{
 				Dragging = false;
 			}
 
 			LogAppend("INFO(Mouse): X %d Y %d PressedX %d PressedY %d \n", MouseX,
 								MouseY, MousePressedX, MousePressedY);
-			LogAppend("FrameTime: %f \n", GetFrameTime());
+			LogAppend("FrameTime: %f \n", DeltaTime);
 			LogAppend("FPS: %d \n", GetFPS());
+			StatsFrameEnd();
+			ProfileDraw();
+			StatsDraw();
 			LogDraw();
 			LogSet("");
 
-			EndDrawing();
+			ProfileZone(ZONE_PRESENT, EndDrawing(););
 		}
+
+		ProfileEnd(ZONE_FRAME);
+		ProfileFrameEnd();
+		FlightFrameEnd();
+		TraceFrameEnd();
+
+		if (StartupFrameEnd() || BenchFrameEnd() || ReplayFrameEnd())
+		{
+			break;
+		}
+
+		PaceFrameEnd();
 	}
 
-#define X(Name, NAME) UnloadTexture(Name##Texture);
-	ICON_LIST
-#undef X
+	UnloadTexture(Atlas);
+	ReplayClose();
 	CloseWindow();
 	return 0;
 }
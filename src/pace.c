@@ -0,0 +1,255 @@
+#ifndef PICKLE_PACE
+#define PICKLE_PACE
+
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+
+#include "globals.c"
+#include "trace.c"
+
+// Pickle paces its frames itself, raylib sleeps and then spins all the way to
+// the deadline. When vsync works the swap already waits for the display and
+// nothing is added. Otherwise a frame sleeps until a little before an absolute
+// deadline, the little being how late the sleeps have woken up lately, and
+// only spins through that. Deadlines move by whole periods, so one late wake
+// up does not shift the frames after it
+
+// frames drawn without pacing at the start, to see whether the swap blocks
+#define PACE_PROBE_FRAMES 30
+// frames the overlay numbers are averaged over
+#define PACE_WINDOW 128
+// weight of the newest frame in the running estimates
+#define PACE_WEIGHT 0.1
+// vsync counts as working while frames take this much of a refresh
+#define PACE_VSYNC_RATIO 0.8
+// a display this much faster than the target gets the sleep pacing instead
+#define PACE_FAST_DISPLAY 1.05
+
+enum PaceModeEnum
+{
+	PACE_OFF,
+	PACE_PROBE,
+	PACE_VSYNC,
+	PACE_SLEEP,
+};
+
+static const char* PACE_MODE_NAMES[] = {"off", "probe", "vsync", "sleep"};
+
+// milliseconds averaged over the last PACE_WINDOW frames
+typedef struct
+{
+	float Interval;
+	// distance from the period the frames should take
+	float Jitter;
+	float MaxJitter;
+	float Sleep;
+	float Spin;
+	// frames that ended after their deadline
+	int Late;
+} PaceStats;
+
+static int PaceMode = PACE_OFF;
+static bool PaceVsyncWanted = false;
+// seconds
+static double PacePeriod = 0;
+static double PaceRefreshPeriod = 0;
+static double PaceDeadline = 0;
+static double PaceLast = 0;
+static double PaceSlept = 0;
+static double PaceSpun = 0;
+// how late sleeps wake up, and the time left to spin for it
+static double PaceLateness = 0.0003;
+static double PaceSlack = 0.0005;
+// a frame without the pacing, swap included
+static double PaceWork = 0;
+static int PaceProbed = 0;
+static PaceStats PaceSum = {0};
+static PaceStats PaceShown = {0};
+static int PaceSummed = 0;
+
+#ifdef PLATFORM_WINDOWS
+#	define PaceNow() GetTime()
+
+// there is no absolute sleep, raylib waits the rest
+static void PaceSleepUntil(double time)
+{
+	WaitTime(time - GetTime());
+}
+#else
+static double PaceNow(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void PaceSleepUntil(double time)
+{
+	struct timespec deadline = {time, (time - floor(time)) * 1e9};
+
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) ==
+				 EINTR)
+	{
+	}
+}
+#endif
+
+// call before the window exists, benchmarks and fast replays run unpaced
+static void PaceConfigure(bool vsync)
+{
+#ifdef BENCH
+	vsync = false;
+#endif
+	PaceVsyncWanted = vsync;
+
+	if (vsync)
+	{
+		SetConfigFlags(FLAG_VSYNC_HINT);
+	}
+}
+
+// 0 draws frames as fast as they come
+static void PaceSetTarget(int fps)
+{
+	PacePeriod = fps > 0 ? 1.0 / fps : 0;
+	PaceMode = fps <= 0 ? PACE_OFF : PaceVsyncWanted ? PACE_PROBE : PACE_SLEEP;
+	PaceProbed = 0;
+	PaceDeadline = PaceLast = PaceNow();
+}
+
+static void PaceStatsPush(double interval)
+{
+	double period = PaceMode == PACE_VSYNC ? PaceRefreshPeriod : PacePeriod;
+	float jitter = fabs(interval - period) * 1000;
+
+	PaceSum.Interval += interval * 1000;
+	PaceSum.Jitter += jitter;
+	PaceSum.MaxJitter = fmax(PaceSum.MaxJitter, jitter);
+	PaceSum.Sleep += PaceSlept * 1000;
+	PaceSum.Spin += PaceSpun * 1000;
+
+	if (++PaceSummed < PACE_WINDOW)
+	{
+		return;
+	}
+
+	PaceShown = (PaceStats){PaceSum.Interval / PACE_WINDOW,
+													PaceSum.Jitter / PACE_WINDOW,
+													PaceSum.MaxJitter,
+													PaceSum.Sleep / PACE_WINDOW,
+													PaceSum.Spin / PACE_WINDOW,
+													PaceSum.Late};
+	PaceSum = (PaceStats){0};
+	PaceSummed = 0;
+	TraceCounter("PaceJitter", PaceShown.Jitter);
+}
+
+// decides whether the swap blocks once the probe frames are done, and keeps
+// checking it still does
+static void PaceVsyncCheck(void)
+{
+	if (PaceMode == PACE_PROBE && ++PaceProbed >= PACE_PROBE_FRAMES)
+	{
+#ifdef PLATFORM_ANDROID
+		int refresh = 0;
+#else
+		int refresh = GetMonitorRefreshRate(GetCurrentMonitor());
+#endif
+		PaceRefreshPeriod = refresh > 0 ? 1.0 / refresh : PacePeriod;
+		PaceDeadline = PaceNow();
+		PaceMode = PaceWork > PaceRefreshPeriod * PACE_VSYNC_RATIO ? PACE_VSYNC
+																															 : PACE_SLEEP;
+
+		// vsync would run at the display rate, over the target
+		if (PaceMode == PACE_VSYNC &&
+				PaceRefreshPeriod * PACE_FAST_DISPLAY < PacePeriod)
+		{
+			ClearWindowState(FLAG_VSYNC_HINT);
+			PaceMode = PACE_SLEEP;
+		}
+
+		TraceInstant("pace", PACE_MODE_NAMES[PaceMode], refresh);
+	}
+	else if (PaceMode == PACE_VSYNC &&
+					 PaceWork < PaceRefreshPeriod * PACE_VSYNC_RATIO / 2)
+	{
+		// the driver stopped waiting for the display
+		PaceMode = PACE_SLEEP;
+		PaceDeadline = PaceNow();
+		TraceInstant("pace", PACE_MODE_NAMES[PaceMode], 0);
+	}
+}
+
+// Milliseconds a frame should take at most. With vsync a frame includes the
+// wait for the display, so it takes a whole refresh when it is on time and
+// counts as late once it is halfway into missing the next one
+static float PaceBudget(void)
+{
+	if (PaceMode == PACE_VSYNC)
+	{
+		return PaceRefreshPeriod * 1.5 * 1000;
+	}
+
+	return (PacePeriod > 0 ? PacePeriod : 1.0 / TARGET_FPS) * 1000;
+}
+
+// sleeps and spins until the next deadline, returns when it got there
+static double PaceWait(double now)
+{
+	PaceDeadline += PacePeriod;
+
+	if (PaceDeadline < now)
+	{
+		// starts again from here instead of rushing frames to catch up
+		PaceSum.Late++;
+		PaceDeadline = now;
+		return now;
+	}
+
+	double wake = PaceDeadline - PaceSlack;
+
+	if (wake > now)
+	{
+		PaceSleepUntil(wake);
+		double woke = PaceNow();
+		PaceSlept = woke - now;
+		PaceLateness = PaceLateness * (1 - PACE_WEIGHT) +
+									 fmax(woke - wake, 0) * PACE_WEIGHT;
+		// some room over the usual lateness, never most of the frame
+		PaceSlack = fmin(PaceLateness * 1.5, PacePeriod / 4);
+		now = woke;
+	}
+
+	double spinStart = now;
+
+	while (now < PaceDeadline)
+	{
+		now = PaceNow();
+	}
+
+	PaceSpun = now - spinStart;
+	return now;
+}
+
+// call once the frame is presented, waits until the next one is due
+static void PaceFrameEnd(void)
+{
+	double now = PaceNow();
+	// the frame and the swap, without the pacing
+	double work = now - PaceLast;
+
+	PaceWork = PaceWork * (1 - PACE_WEIGHT) + work * PACE_WEIGHT;
+	PaceSlept = PaceSpun = 0;
+	PaceVsyncCheck();
+
+	if (PaceMode == PACE_SLEEP)
+	{
+		now = PaceWait(now);
+	}
+
+	PaceStatsPush(now - PaceLast);
+	PaceLast = now;
+}
+
+#endif	// PICKLE_PACE
@@ -0,0 +1,255 @@
+#ifndef PICKLE_PROFILE
+#define PICKLE_PROFILE
+
+#include <math.h>
+
+#include "globals.c"
+#include "log.c"
+#include "pace.c"
+#include "trace.c"
+
+// Zones can nest, a zone entered multiple times in a frame accumulates
+#define PROFILE_ZONE_LIST      \
+	X(Frame, FRAME)              \
+	X(Input, INPUT)              \
+	X(Menu, MENU)                \
+	X(Palette, PALETTE)          \
+	X(Layout, LAYOUT)            \
+	X(Wheel, WHEEL)              \
+	X(TextMeasure, TEXT_MEASURE) \
+	X(Present, PRESENT)
+
+#define X(Name, NAME) ZONE_##NAME,
+enum ZoneEnum
+{
+	PROFILE_ZONE_LIST ZONES_AMOUNT
+};
+#undef X
+
+#define X(Name, NAME) #Name,
+static const char* ZONE_NAMES[] = {PROFILE_ZONE_LIST};
+#undef X
+
+#define PROFILE_MAX_DEPTH 16
+
+typedef struct
+{
+	int Zone;
+	double Start;
+} ZoneMark;
+
+// zone timing stays on in release builds for the flight recorder
+static ZoneMark ZoneStack[PROFILE_MAX_DEPTH];
+static int ZoneDepth = 0;
+static double ZoneAccumulated[ZONES_AMOUNT] = {0};
+// milliseconds spent in each zone during the last finished frame
+static float ZoneLastFrame[ZONES_AMOUNT] = {0};
+
+static void ProfileBegin(int zone)
+{
+	if (ZoneDepth >= PROFILE_MAX_DEPTH)
+	{
+		LogAppend("ERROR: Profiler zones are nested too deep!\n");
+		return;
+	}
+
+	ZoneStack[ZoneDepth++] = (ZoneMark){zone, GetTime()};
+}
+
+static void ProfileEnd(int zone)
+{
+	if (ZoneDepth <= 0 || ZoneStack[ZoneDepth - 1].Zone != zone)
+	{
+		LogAppend("ERROR: Profiler zone '%s' closed out of order!\n",
+							ZONE_NAMES[zone]);
+		return;
+	}
+
+	ZoneDepth--;
+	double start = ZoneStack[ZoneDepth].Start;
+	double duration = GetTime() - start;
+	ZoneAccumulated[zone] += duration;
+	TraceComplete("zone", ZONE_NAMES[zone], start, duration);
+}
+
+#define ProfileZone(zone, ...) \
+	ProfileBegin(zone);          \
+	__VA_ARGS__                  \
+	ProfileEnd(zone);
+
+#ifdef RELEASE
+#	define ProfileDraw(...)
+#else
+// frames kept in the rolling window
+#	ifndef PROFILE_HISTORY
+#		define PROFILE_HISTORY 256
+#	endif
+
+// width of a histogram bucket in microseconds
+#	ifndef PROFILE_BUCKET_US
+#		define PROFILE_BUCKET_US 100
+#	endif
+
+// the last bucket holds every sample above the histogram range
+#	ifndef PROFILE_BUCKETS
+#		define PROFILE_BUCKETS 512
+#	endif
+
+#	define PROFILE_FONT_SIZE 20
+// lines under the zones for the frame pacing
+#	define PROFILE_PACE_LINES 3
+
+typedef struct
+{
+	float Samples[PROFILE_HISTORY];
+	unsigned short Histogram[PROFILE_BUCKETS];
+} ZoneStats;
+
+static ZoneStats Zones[ZONES_AMOUNT] = {0};
+static int ProfileFrame = 0;
+static int ProfileSampleCount = 0;
+static bool ProfileOverlayVisible =
+#	ifdef PLATFORM_ANDROID
+		true;
+#	else
+		false;
+#	endif
+
+static int ProfileBucket(float milliseconds)
+{
+	int bucket = milliseconds * 1000 / PROFILE_BUCKET_US;
+	return clamp(bucket, 0, PROFILE_BUCKETS - 1);
+}
+
+// pushes this frame's zone totals into the rolling window
+static void ProfileHistoryPush(void)
+{
+	for (int z = 0; z < ZONES_AMOUNT; z++)
+	{
+		ZoneStats* zone = &Zones[z];
+
+		if (ProfileSampleCount == PROFILE_HISTORY)
+		{
+			zone->Histogram[ProfileBucket(zone->Samples[ProfileFrame])]--;
+		}
+
+		zone->Samples[ProfileFrame] = ZoneLastFrame[z];
+		zone->Histogram[ProfileBucket(ZoneLastFrame[z])]++;
+	}
+
+	ProfileFrame = (ProfileFrame + 1) % PROFILE_HISTORY;
+
+	if (ProfileSampleCount < PROFILE_HISTORY)
+	{
+		ProfileSampleCount++;
+	}
+}
+
+// upper bound in milliseconds of the bucket holding the given percentile
+static float ProfilePercentile(int zone, int percentile)
+{
+	int wanted = (ProfileSampleCount * percentile + 99) / 100;
+	int seen = 0;
+
+	for (int b = 0; b < PROFILE_BUCKETS; b++)
+	{
+		seen += Zones[zone].Histogram[b];
+
+		if (seen >= wanted && seen > 0)
+		{
+			return (float)(b + 1) * PROFILE_BUCKET_US / 1000;
+		}
+	}
+
+	return 0;
+}
+
+static void ProfileDraw(void)
+{
+	if (IsKeyPressed(KEY_F3))
+	{
+		ProfileOverlayVisible = !ProfileOverlayVisible;
+	}
+
+	if (!ProfileOverlayVisible || ProfileSampleCount == 0)
+	{
+		return;
+	}
+
+	int lineHeight = PROFILE_FONT_SIZE + 2;
+	int graphHeight = ScreenHeight / 6;
+	int tableHeight = lineHeight * (ZONES_AMOUNT + 1 + PROFILE_PACE_LINES);
+	int x = Padding;
+	int y = ScreenHeight - graphHeight - tableHeight - Padding * 2;
+	float budget = PaceBudget();
+
+	DrawRectangle(0, y - Padding, PROFILE_FONT_SIZE * 24,
+								tableHeight + graphHeight + Padding * 3, Fade(BLACK, 0.7f));
+
+	DrawText("zone          p50    p95    p99 ms", x, y, PROFILE_FONT_SIZE,
+					 WHITE);
+
+	for (int z = 0; z < ZONES_AMOUNT; z++)
+	{
+		float p99 = ProfilePercentile(z, 99);
+
+		y += lineHeight;
+		DrawText(TextFormat("%-12s %6.1f %6.1f %6.1f", ZONE_NAMES[z],
+												ProfilePercentile(z, 50), ProfilePercentile(z, 95),
+												p99),
+						 x, y, PROFILE_FONT_SIZE, p99 > budget ? RED : WHITE);
+	}
+
+	y += lineHeight;
+	DrawText(TextFormat("pace %-6s %6.2f ms", PACE_MODE_NAMES[PaceMode],
+											PaceShown.Interval),
+					 x, y, PROFILE_FONT_SIZE, WHITE);
+	y += lineHeight;
+	DrawText(TextFormat("jitter %5.2f max %5.2f ms", PaceShown.Jitter,
+											PaceShown.MaxJitter),
+					 x, y, PROFILE_FONT_SIZE, PaceShown.MaxJitter > 1 ? RED : WHITE);
+	y += lineHeight;
+	DrawText(TextFormat("sleep %5.2f spin %5.2f late %d", PaceShown.Sleep,
+											PaceShown.Spin, PaceShown.Late),
+					 x, y, PROFILE_FONT_SIZE, PaceShown.Late > 0 ? RED : WHITE);
+
+	// frame time graph, the line marks the frame budget
+	{
+		int graphY = y + lineHeight + Padding;
+		int graphWidth = PROFILE_FONT_SIZE * 24 - Padding * 2;
+		float barWidth = (float)graphWidth / PROFILE_HISTORY;
+		float scale = graphHeight / (budget * 2);
+
+		for (int i = 0; i < ProfileSampleCount; i++)
+		{
+			// oldest sample on the left
+			int frame = (ProfileFrame + PROFILE_HISTORY - ProfileSampleCount + i) %
+									PROFILE_HISTORY;
+			float frameTime = Zones[ZONE_FRAME].Samples[frame];
+			float barHeight = fmin(frameTime * scale, graphHeight);
+
+			DrawRectangle(x + i * barWidth, graphY + graphHeight - barHeight,
+										fmax(barWidth, 1), barHeight,
+										frameTime > budget ? RED : GREEN);
+		}
+
+		DrawLine(x, graphY + graphHeight / 2, x + graphWidth,
+						 graphY + graphHeight / 2, WHITE);
+	}
+}
+#endif	// RELEASE
+
+static void ProfileFrameEnd(void)
+{
+	for (int z = 0; z < ZONES_AMOUNT; z++)
+	{
+		ZoneLastFrame[z] = ZoneAccumulated[z] * 1000;
+		ZoneAccumulated[z] = 0;
+	}
+
+#ifndef RELEASE
+	ProfileHistoryPush();
+#endif
+}
+
+#endif	// PICKLE_PROFILE
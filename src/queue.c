@@ -0,0 +1,201 @@
+#ifndef PICKLE_QUEUE
+#define PICKLE_QUEUE
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+// Typed text handed from one thread to another, like from the java ui thread
+// to the native one on android. One thread pushes and one pops, and neither
+// waits on the other, the bytes are written before the head is published with
+// release and read after it is taken with acquire, and the tail goes back the
+// same way. Characters go in as whole utf-8 sequences, so a pop never sees
+// half of one, and a backspace is a character of its own
+#define QUEUE_SIZE 4096
+// pushed for a deleted character, typed text never holds it
+#define QUEUE_BACKSPACE '\b'
+
+typedef struct
+{
+	unsigned char Bytes[QUEUE_SIZE];
+	// on their own cache lines, so the threads do not keep taking them from
+	// each other
+	alignas(64) atomic_uint Head;
+	alignas(64) atomic_uint Tail;
+	// characters that did not fit, taken by the consumer
+	atomic_uint Dropped;
+} Queue;
+
+// bytes in the utf-8 sequence that starts with the byte, 0 when none does
+static int QueueSequenceSize(unsigned char byte)
+{
+	if (byte < 0x80)
+	{
+		return 1;
+	}
+	else if ((byte & 0xE0) == 0xC0)
+	{
+		return 2;
+	}
+	else if ((byte & 0xF0) == 0xE0)
+	{
+		return 3;
+	}
+	else if ((byte & 0xF8) == 0xF0)
+	{
+		return 4;
+	}
+
+	return 0;
+}
+
+// utf-8 without CodepointToUTF8, whose buffer is shared by every thread
+static int QueueEncode(int codepoint, char* bytes)
+{
+	if (codepoint < 0 || codepoint > 0x10FFFF)
+	{
+		return 0;
+	}
+	else if (codepoint < 0x80)
+	{
+		bytes[0] = codepoint;
+		return 1;
+	}
+	else if (codepoint < 0x800)
+	{
+		bytes[0] = 0xC0 | codepoint >> 6;
+		bytes[1] = 0x80 | (codepoint & 0x3F);
+		return 2;
+	}
+	else if (codepoint < 0x10000)
+	{
+		bytes[0] = 0xE0 | codepoint >> 12;
+		bytes[1] = 0x80 | (codepoint >> 6 & 0x3F);
+		bytes[2] = 0x80 | (codepoint & 0x3F);
+		return 3;
+	}
+
+	bytes[0] = 0xF0 | codepoint >> 18;
+	bytes[1] = 0x80 | (codepoint >> 12 & 0x3F);
+	bytes[2] = 0x80 | (codepoint >> 6 & 0x3F);
+	bytes[3] = 0x80 | (codepoint & 0x3F);
+	return 4;
+}
+
+// writes the sequence at the head when it fits, the caller publishes the head
+static bool QueueWrite(Queue* queue,
+											 const char* bytes,
+											 int size,
+											 unsigned int* head,
+											 unsigned int* tail)
+{
+	if (*head + size - *tail > QUEUE_SIZE)
+	{
+		// the consumer may have made room since the tail was read
+		*tail = atomic_load_explicit(&queue->Tail, memory_order_acquire);
+
+		if (*head + size - *tail > QUEUE_SIZE)
+		{
+			return false;
+		}
+	}
+
+	for (int i = 0; i < size; i++)
+	{
+		queue->Bytes[(*head + i) & (QUEUE_SIZE - 1)] = bytes[i];
+	}
+
+	*head += size;
+	return true;
+}
+
+// producer only, false when the character did not fit
+static bool QueuePush(Queue* queue, int codepoint)
+{
+	char bytes[4];
+	int size = QueueEncode(codepoint, bytes);
+	unsigned int head = atomic_load_explicit(&queue->Head, memory_order_relaxed);
+	unsigned int tail = atomic_load_explicit(&queue->Tail, memory_order_acquire);
+
+	if (size == 0 || !QueueWrite(queue, bytes, size, &head, &tail))
+	{
+		atomic_fetch_add_explicit(&queue->Dropped, 1, memory_order_relaxed);
+		return false;
+	}
+
+	atomic_store_explicit(&queue->Head, head, memory_order_release);
+	return true;
+}
+
+// Producer only, pushes the utf-8 text up to the first character that does
+// not fit and publishes it all at once. Broken sequences and backspaces are
+// left out, it returns how many characters went in
+static int QueuePushText(Queue* queue, const char* text)
+{
+	unsigned int head = atomic_load_explicit(&queue->Head, memory_order_relaxed);
+	unsigned int tail = atomic_load_explicit(&queue->Tail, memory_order_acquire);
+	int pushed = 0;
+	int dropped = 0;
+
+	for (int size = 0; *text != '\0'; text += size)
+	{
+		size = QueueSequenceSize(*text);
+		bool valid = size > 0 && *text != QUEUE_BACKSPACE;
+
+		// stops at the nul of a cut sequence too
+		for (int i = 1; i < size && valid; i++)
+		{
+			valid = (text[i] & 0xC0) == 0x80;
+		}
+
+		if (!valid)
+		{
+			size = 1;
+		}
+		else if (dropped > 0 || !QueueWrite(queue, text, size, &head, &tail))
+		{
+			dropped++;
+		}
+		else
+		{
+			pushed++;
+		}
+	}
+
+	atomic_fetch_add_explicit(&queue->Dropped, dropped, memory_order_relaxed);
+	atomic_store_explicit(&queue->Head, head, memory_order_release);
+	return pushed;
+}
+
+// consumer only, the next character or QUEUE_BACKSPACE, 0 when it is empty
+static int QueuePop(Queue* queue)
+{
+	unsigned int tail = atomic_load_explicit(&queue->Tail, memory_order_relaxed);
+	unsigned int head = atomic_load_explicit(&queue->Head, memory_order_acquire);
+
+	if (tail == head)
+	{
+		return 0;
+	}
+
+	unsigned char lead = queue->Bytes[tail & (QUEUE_SIZE - 1)];
+	int size = QueueSequenceSize(lead);
+	int codepoint = size > 1 ? lead & (0x7F >> size) : lead;
+
+	for (int i = 1; i < size; i++)
+	{
+		codepoint = codepoint << 6 |
+								(queue->Bytes[(tail + i) & (QUEUE_SIZE - 1)] & 0x3F);
+	}
+
+	atomic_store_explicit(&queue->Tail, tail + size, memory_order_release);
+	return codepoint;
+}
+
+// consumer only, characters dropped since the last call
+static unsigned int QueueTakeDropped(Queue* queue)
+{
+	return atomic_exchange_explicit(&queue->Dropped, 0, memory_order_relaxed);
+}
+
+#endif	// PICKLE_QUEUE
@@ -0,0 +1,392 @@
+#ifndef PICKLE_REPLAY
+#define PICKLE_REPLAY
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "globals.c"
+#include "input.c"
+#include "pace.c"
+
+// Records every input frame to a compact binary file and feeds it back later,
+// together with the random seed a replay runs the exact same session.
+//
+// The file is a header followed by one record per frame, little endian:
+//   header  "PKLREC" u8 version, u32 seed
+//   frame   f32 delta, u16 flags, i16 mouse x, i16 mouse y
+//           f32 wheel                 when REPLAY_WHEEL is set
+//           u8 count, i32 chars[]     when REPLAY_CHARS is set
+//           i16 width, i16 height     when REPLAY_RESIZE is set
+//           u8 count, f32 x, f32 y    when REPLAY_TOUCH is set
+//           u16 keys                  when REPLAY_KEYS is set
+#define REPLAY_MAGIC "PKLREC"
+#define REPLAY_VERSION 1
+// recordings are written through a big buffer so a frame rarely hits the disk
+#define REPLAY_BUFFER_SIZE (64 * 1024)
+
+enum ReplayFlags
+{
+	REPLAY_MOUSE_PRESSED = 1 << 0,
+	REPLAY_MOUSE_DOWN = 1 << 1,
+	REPLAY_MOUSE_RELEASED = 1 << 2,
+	REPLAY_ESCAPE_PRESSED = 1 << 3,
+	REPLAY_BACKSPACE_PRESSED = 1 << 4,
+	REPLAY_BACKSPACE_DOWN = 1 << 5,
+	REPLAY_WHEEL = 1 << 6,
+	REPLAY_CHARS = 1 << 7,
+	REPLAY_RESIZE = 1 << 8,
+	REPLAY_TOUCH = 1 << 9,
+	REPLAY_UNDO_PRESSED = 1 << 10,
+	REPLAY_REDO_PRESSED = 1 << 11,
+	REPLAY_KEYS = 1 << 12,
+};
+
+static FILE* ReplayFile = NULL;
+static const char* ReplayRecordPath = NULL;
+static const char* ReplayPlayPath = NULL;
+// replays as fast as possible instead of waiting for the recorded deltas
+static bool ReplayFast = false;
+static bool ReplayDone = false;
+static unsigned int ReplayFrames = 0;
+static uint32_t ReplaySeed = 0;
+static int ReplayWidth = 0;
+static int ReplayHeight = 0;
+static float ReplayDelta = 0;
+static double ReplayFrameStart = 0;
+static char ReplayBuffer[REPLAY_BUFFER_SIZE];
+
+// writes the low size bytes of the value, least significant first, so the
+// recording plays the same on any host
+static void ReplayWrite(uint32_t value, int size)
+{
+	for (int i = 0; i < size; i++)
+	{
+		fputc((value >> (i * 8)) & 0xff, ReplayFile);
+	}
+}
+
+static void ReplayWriteFloat(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	ReplayWrite(bits, sizeof(bits));
+}
+
+static void ReplayWriteFrame(const InputFrame* frame)
+{
+	uint16_t flags = 0;
+
+	flags |= frame->MousePressed ? REPLAY_MOUSE_PRESSED : 0;
+	flags |= frame->MouseDown ? REPLAY_MOUSE_DOWN : 0;
+	flags |= frame->MouseReleased ? REPLAY_MOUSE_RELEASED : 0;
+	flags |= frame->EscapePressed ? REPLAY_ESCAPE_PRESSED : 0;
+	flags |= frame->BackspacePressed ? REPLAY_BACKSPACE_PRESSED : 0;
+	flags |= frame->BackspaceDown ? REPLAY_BACKSPACE_DOWN : 0;
+	flags |= frame->UndoPressed ? REPLAY_UNDO_PRESSED : 0;
+	flags |= frame->RedoPressed ? REPLAY_REDO_PRESSED : 0;
+	flags |= frame->MouseWheel != 0 ? REPLAY_WHEEL : 0;
+	flags |= frame->CharCount > 0 ? REPLAY_CHARS : 0;
+	flags |= frame->Keys != 0 ? REPLAY_KEYS : 0;
+	flags |= frame->ScreenWidth != ReplayWidth ||
+									 frame->ScreenHeight != ReplayHeight
+							 ? REPLAY_RESIZE
+							 : 0;
+#ifdef PLATFORM_ANDROID
+	flags |= frame->TouchCount > 0 ? REPLAY_TOUCH : 0;
+#endif
+
+	ReplayWriteFloat(frame->DeltaTime);
+	ReplayWrite(flags, 2);
+	ReplayWrite((uint16_t)frame->MouseX, 2);
+	ReplayWrite((uint16_t)frame->MouseY, 2);
+
+	if (flags & REPLAY_WHEEL)
+	{
+		ReplayWriteFloat(frame->MouseWheel);
+	}
+
+	if (flags & REPLAY_CHARS)
+	{
+		ReplayWrite(frame->CharCount, 1);
+
+		for (int i = 0; i < frame->CharCount; i++)
+		{
+			ReplayWrite((uint32_t)frame->Chars[i], 4);
+		}
+	}
+
+	if (flags & REPLAY_RESIZE)
+	{
+		ReplayWrite((uint16_t)frame->ScreenWidth, 2);
+		ReplayWrite((uint16_t)frame->ScreenHeight, 2);
+		ReplayWidth = frame->ScreenWidth;
+		ReplayHeight = frame->ScreenHeight;
+	}
+
+#ifdef PLATFORM_ANDROID
+	if (flags & REPLAY_TOUCH)
+	{
+		ReplayWrite(frame->TouchCount, 1);
+		ReplayWriteFloat(frame->TouchPosition.x);
+		ReplayWriteFloat(frame->TouchPosition.y);
+	}
+#endif
+
+	if (flags & REPLAY_KEYS)
+	{
+		ReplayWrite(frame->Keys, 2);
+	}
+
+	ReplayFrames++;
+}
+
+// reads size bytes written by ReplayWrite
+static bool ReplayRead(uint32_t* value, int size)
+{
+	unsigned char bytes[4];
+
+	if (fread(bytes, size, 1, ReplayFile) != 1)
+	{
+		return false;
+	}
+
+	*value = 0;
+
+	for (int i = 0; i < size; i++)
+	{
+		*value |= (uint32_t)bytes[i] << (i * 8);
+	}
+
+	return true;
+}
+
+static bool ReplayReadFloat(float* value)
+{
+	uint32_t bits;
+
+	if (!ReplayRead(&bits, sizeof(bits)))
+	{
+		return false;
+	}
+
+	memcpy(value, &bits, sizeof(bits));
+	return true;
+}
+
+// returns false when the recording ends in the middle of the frame
+static bool ReplayReadRecord(InputFrame* frame)
+{
+	uint32_t flags, mouseX, mouseY;
+
+	if (!ReplayReadFloat(&frame->DeltaTime) || !ReplayRead(&flags, 2) ||
+			!ReplayRead(&mouseX, 2) || !ReplayRead(&mouseY, 2))
+	{
+		return false;
+	}
+
+	frame->MouseX = (int16_t)mouseX;
+	frame->MouseY = (int16_t)mouseY;
+	frame->MousePressed = flags & REPLAY_MOUSE_PRESSED;
+	frame->MouseDown = flags & REPLAY_MOUSE_DOWN;
+	frame->MouseReleased = flags & REPLAY_MOUSE_RELEASED;
+	frame->EscapePressed = flags & REPLAY_ESCAPE_PRESSED;
+	frame->BackspacePressed = flags & REPLAY_BACKSPACE_PRESSED;
+	frame->BackspaceDown = flags & REPLAY_BACKSPACE_DOWN;
+	frame->UndoPressed = flags & REPLAY_UNDO_PRESSED;
+	frame->RedoPressed = flags & REPLAY_REDO_PRESSED;
+
+	if ((flags & REPLAY_WHEEL) && !ReplayReadFloat(&frame->MouseWheel))
+	{
+		return false;
+	}
+
+	if (flags & REPLAY_CHARS)
+	{
+		uint32_t count;
+
+		if (!ReplayRead(&count, 1))
+		{
+			return false;
+		}
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t c;
+
+			if (!ReplayRead(&c, 4))
+			{
+				return false;
+			}
+
+			if (frame->CharCount < INPUT_MAX_CHARS)
+			{
+				frame->Chars[frame->CharCount++] = (int32_t)c;
+			}
+		}
+	}
+
+	if (flags & REPLAY_RESIZE)
+	{
+		uint32_t width, height;
+
+		if (!ReplayRead(&width, 2) || !ReplayRead(&height, 2))
+		{
+			return false;
+		}
+
+		ReplayWidth = (int16_t)width;
+		ReplayHeight = (int16_t)height;
+		SetWindowSize(ReplayWidth, ReplayHeight);
+	}
+
+	if (flags & REPLAY_TOUCH)
+	{
+		uint32_t count;
+		Vector2 position;
+
+		if (!ReplayRead(&count, 1) || !ReplayReadFloat(&position.x) ||
+				!ReplayReadFloat(&position.y))
+		{
+			return false;
+		}
+
+#ifdef PLATFORM_ANDROID
+		frame->TouchCount = count;
+		frame->TouchPosition = position;
+#endif
+	}
+
+	if (flags & REPLAY_KEYS)
+	{
+		uint32_t keys;
+
+		if (!ReplayRead(&keys, 2))
+		{
+			return false;
+		}
+
+		frame->Keys = keys;
+	}
+
+	return true;
+}
+
+// fills the frame from the recording, the frame is left empty once it ends
+static void ReplayReadFrame(InputFrame* frame)
+{
+	if (!ReplayDone && ReplayReadRecord(frame))
+	{
+		ReplayDelta = frame->DeltaTime;
+		ReplayFrames++;
+	}
+	else
+	{
+		ReplayDone = true;
+		memset(frame, 0, sizeof(*frame));
+	}
+
+	// the layout follows the recording even if the window could not resize
+	frame->ScreenWidth = ReplayWidth;
+	frame->ScreenHeight = ReplayHeight;
+}
+
+// call after InitWindow, raylib seeds the random generator there
+static void ReplaySetup(void)
+{
+	if (ReplayPlayPath != NULL)
+	{
+		char magic[sizeof(REPLAY_MAGIC) - 1];
+		uint32_t version = 0;
+		ReplayFile = fopen(ReplayPlayPath, "rb");
+
+		if (ReplayFile == NULL ||
+				fread(magic, sizeof(magic), 1, ReplayFile) != 1 ||
+				memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0 ||
+				!ReplayRead(&version, 1) || version != REPLAY_VERSION ||
+				!ReplayRead(&ReplaySeed, sizeof(ReplaySeed)))
+		{
+			TraceLog(LOG_ERROR, "REPLAY: %s is not a valid recording",
+							 ReplayPlayPath);
+			ReplayDone = true;
+			return;
+		}
+
+		PaceSetTarget(0);
+		SetRandomSeed(ReplaySeed);
+		ReplayWidth = GetScreenWidth();
+		ReplayHeight = GetScreenHeight();
+		InputSource = ReplayReadFrame;
+		TraceLog(LOG_INFO, "REPLAY: Playing %s", ReplayPlayPath);
+	}
+	else if (ReplayRecordPath != NULL)
+	{
+		ReplayFile = fopen(ReplayRecordPath, "wb");
+
+		if (ReplayFile == NULL)
+		{
+			TraceLog(LOG_ERROR, "REPLAY: Could not open %s", ReplayRecordPath);
+			return;
+		}
+
+		setvbuf(ReplayFile, ReplayBuffer, _IOFBF, sizeof(ReplayBuffer));
+		ReplaySeed = time(NULL);
+		SetRandomSeed(ReplaySeed);
+		fwrite(REPLAY_MAGIC, sizeof(REPLAY_MAGIC) - 1, 1, ReplayFile);
+		ReplayWrite(REPLAY_VERSION, 1);
+		ReplayWrite(ReplaySeed, sizeof(ReplaySeed));
+		InputSink = ReplayWriteFrame;
+		TraceLog(LOG_INFO, "REPLAY: Recording to %s", ReplayRecordPath);
+	}
+
+	ReplayFrameStart = GetTime();
+}
+
+// returns true once the replay ran out of frames, in real time it waits until
+// the recorded frame time passed
+static bool ReplayFrameEnd(void)
+{
+	if (ReplayPlayPath == NULL)
+	{
+		return false;
+	}
+
+	if (ReplayDone)
+	{
+		TraceLog(LOG_INFO, "REPLAY: Played %u frames", ReplayFrames);
+		return true;
+	}
+
+	if (!ReplayFast)
+	{
+		double remaining = ReplayDelta - (GetTime() - ReplayFrameStart);
+
+		if (remaining > 0)
+		{
+			WaitTime(remaining);
+		}
+	}
+
+	ReplayFrameStart = GetTime();
+	return false;
+}
+
+static void ReplayClose(void)
+{
+	if (ReplayFile == NULL)
+	{
+		return;
+	}
+
+	if (ReplayRecordPath != NULL && ReplayPlayPath == NULL)
+	{
+		TraceLog(LOG_INFO, "REPLAY: Recorded %u frames to %s", ReplayFrames,
+						 ReplayRecordPath);
+	}
+
+	fclose(ReplayFile);
+	ReplayFile = NULL;
+}
+
+#endif	// PICKLE_REPLAY
@@ -0,0 +1,117 @@
+#ifndef PICKLE_STARTUP
+#define PICKLE_STARTUP
+
+#include <stdio.h>
+#include <time.h>
+
+#include "globals.c"
+
+// Times every startup phase from the start of main to the first presented
+// frame, GetTime only works after InitWindow so this reads the clock itself
+#define STARTUP_PHASE_LIST   \
+	X(InitWindow, INIT_WINDOW) \
+	X(LoadAtlas, LOAD_ATLAS)   \
+	X(WindowIcon, WINDOW_ICON) \
+	X(FirstFrame, FIRST_FRAME)
+
+#define X(Name, NAME) STARTUP_##NAME,
+enum StartupPhaseEnum
+{
+	STARTUP_PHASE_LIST STARTUP_PHASES_AMOUNT
+};
+#undef X
+
+#define X(Name, NAME) #Name,
+static const char* STARTUP_PHASE_NAMES[] = {STARTUP_PHASE_LIST};
+#undef X
+
+static double StartupTimes[STARTUP_PHASES_AMOUNT] = {0};
+static double StartupStart = 0;
+static double StartupLast = 0;
+static int StartupPhase = 0;
+// writes the phases to this file and quits after the first frame when set
+static const char* StartupBenchOut = NULL;
+
+static double StartupNow(void)
+{
+	struct timespec now;
+#ifdef _WIN32
+	timespec_get(&now, TIME_UTC);
+#else
+	clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// call first thing in main
+static void StartupBegin(void)
+{
+	StartupStart = StartupNow();
+	StartupLast = StartupStart;
+}
+
+// ends the given phase, phases must be marked in order
+static void StartupMark(int phase)
+{
+	if (phase != StartupPhase)
+	{
+		return;
+	}
+
+	double now = StartupNow();
+	StartupTimes[phase] = (now - StartupLast) * 1000;
+	StartupLast = now;
+	StartupPhase++;
+}
+
+static void StartupWrite(void)
+{
+	FILE* file = fopen(StartupBenchOut, "a");
+
+	if (file == NULL)
+	{
+		TraceLog(LOG_ERROR, "STARTUP: Could not open %s", StartupBenchOut);
+		return;
+	}
+
+	fprintf(file, "{\"phases_ms\":{");
+
+	for (int p = 0; p < STARTUP_PHASES_AMOUNT; p++)
+	{
+		fprintf(file, "%s\"%s\":%.3f", p > 0 ? "," : "", STARTUP_PHASE_NAMES[p],
+						StartupTimes[p]);
+	}
+
+	fprintf(file, "},\"total_ms\":%.3f}\n", (StartupLast - StartupStart) * 1000);
+	fclose(file);
+}
+
+// returns true when pickle should quit because only startup is benchmarked
+static bool StartupFrameEnd(void)
+{
+	if (StartupPhase != STARTUP_FIRST_FRAME)
+	{
+		return false;
+	}
+
+	StartupMark(STARTUP_FIRST_FRAME);
+
+	for (int p = 0; p < STARTUP_PHASES_AMOUNT; p++)
+	{
+		TraceLog(LOG_INFO, "STARTUP: %-14s %8.2fms", STARTUP_PHASE_NAMES[p],
+						 StartupTimes[p]);
+	}
+
+	TraceLog(LOG_INFO, "STARTUP: %-14s %8.2fms", "Total",
+					 (StartupLast - StartupStart) * 1000);
+
+	if (StartupBenchOut == NULL)
+	{
+		return false;
+	}
+
+	StartupWrite();
+	return true;
+}
+
+#endif	// PICKLE_STARTUP
@@ -0,0 +1,290 @@
+#ifndef PICKLE_STATS
+#define PICKLE_STATS
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "globals.c"
+#include "profile.c"
+
+// Render counters, batches and vertices are estimated from the raylib calls,
+// a new batch starts whenever the primitive mode or the bound texture changes
+#define STAT_LIST                      \
+	X(DrawCalls, DRAW_CALLS)             \
+	X(Batches, BATCHES)                  \
+	X(Flushes, FLUSHES)                  \
+	X(Vertices, VERTICES)                \
+	X(TextureSwitches, TEXTURE_SWITCHES) \
+	X(MeasureText, MEASURE_TEXT)         \
+	X(TextBoxes, TEXT_BOXES)             \
+	X(HitTests, HIT_TESTS)               \
+	X(Layouts, LAYOUTS)                  \
+	X(DroppedChars, DROPPED_CHARS)
+
+#define X(Name, NAME) STAT_##NAME,
+enum StatEnum
+{
+	STAT_LIST STATS_AMOUNT
+};
+#undef X
+
+#define X(Name, NAME) #Name,
+static const char* STAT_NAMES[] = {STAT_LIST};
+#undef X
+
+static const char* SCENE_NAMES[] = {"wheel", "menu"};
+
+// same limits as rlgl defaults
+#define STAT_BATCH_DRAWS 256
+#define STAT_BATCH_VERTICES (8192 * 4)
+
+typedef enum
+{
+	STAT_MODE_LINES,
+	STAT_MODE_TRIANGLES,
+	STAT_MODE_QUADS,
+} StatMode;
+
+// texture id used by raylib shapes, 0 stands for the rlgl default texture
+static unsigned int StatShapesTexture = 0;
+
+static unsigned int Stats[STATS_AMOUNT] = {0};
+static unsigned int StatsLastFrame[STATS_AMOUNT] = {0};
+static unsigned long long StatsTotal[STATS_AMOUNT] = {0};
+static unsigned long long StatsScene[2][STATS_AMOUNT] = {0};
+static unsigned long long StatsFrames = 0;
+static unsigned long long StatsSceneFrames[2] = {0};
+static int StatBatchMode = -1;
+static long long StatBatchTexture = -1;
+static int StatBatchVertices = 0;
+static int StatBatchDraws = 0;
+
+static void StatDraw(StatMode mode, unsigned int texture, int vertices)
+{
+	Stats[STAT_DRAW_CALLS]++;
+	Stats[STAT_VERTICES] += vertices;
+
+	if (StatBatchTexture != texture)
+	{
+		Stats[STAT_TEXTURE_SWITCHES]++;
+	}
+
+	if (StatBatchMode != (int)mode || StatBatchTexture != texture)
+	{
+		Stats[STAT_BATCHES]++;
+		StatBatchDraws++;
+	}
+
+	StatBatchVertices += vertices;
+
+	if (StatBatchDraws >= STAT_BATCH_DRAWS ||
+			StatBatchVertices >= STAT_BATCH_VERTICES)
+	{
+		Stats[STAT_FLUSHES]++;
+		StatBatchDraws = 1;
+		StatBatchVertices = vertices;
+	}
+
+	StatBatchMode = mode;
+	StatBatchTexture = texture;
+}
+
+// same segment count raylib picks when 0 segments are passed
+static int StatSegments(float radius, float startAngle, float endAngle,
+												int segments)
+{
+	if (segments > 0 || radius <= 0.5f)
+	{
+		return segments > 0 ? segments : 4;
+	}
+
+	float th = acosf(2 * powf(1 - 0.5f / radius, 2) - 1);
+	segments = (endAngle - startAngle) * ceilf(2 * PI / th) / 360;
+
+	return segments > 0 ? segments : 4;
+}
+
+static void StatCircleSector(Vector2 center,
+														 float radius,
+														 float startAngle,
+														 float endAngle,
+														 int segments,
+														 Color color)
+{
+	(void)center;
+	(void)color;
+	segments = StatSegments(radius, startAngle, endAngle, segments);
+	StatDraw(STAT_MODE_QUADS, StatShapesTexture, (segments + 1) / 2 * 4);
+}
+
+static void StatRing(Vector2 center,
+										 float innerRadius,
+										 float outerRadius,
+										 float startAngle,
+										 float endAngle,
+										 int segments,
+										 Color color)
+{
+	(void)center;
+	(void)innerRadius;
+	(void)color;
+	segments = StatSegments(outerRadius, startAngle, endAngle, segments);
+	StatDraw(STAT_MODE_QUADS, StatShapesTexture, segments * 4);
+}
+
+static int StatGlyphs(const char* text)
+{
+	int glyphs = 0;
+
+	for (const char* c = text; *c != '\0'; c++)
+	{
+		// skips whitespace and utf8 continuation bytes
+		glyphs += (unsigned char)*c > ' ' && (*c & 0xC0) != 0x80;
+	}
+
+	return glyphs;
+}
+
+static void StatsFrameBegin(void)
+{
+	memset(Stats, 0, sizeof(Stats));
+	StatBatchMode = -1;
+	StatBatchTexture = -1;
+	StatBatchVertices = 0;
+	StatBatchDraws = 0;
+}
+
+// call after the scene is drawn so debug overlays are not counted
+static void StatsFrameEnd(void)
+{
+	// EndDrawing flushes whatever is left
+	Stats[STAT_FLUSHES]++;
+
+	memcpy(StatsLastFrame, Stats, sizeof(Stats));
+	StatsFrames++;
+	StatsSceneFrames[CurrentScene]++;
+
+	for (int s = 0; s < STATS_AMOUNT; s++)
+	{
+		StatsTotal[s] += Stats[s];
+		StatsScene[CurrentScene][s] += Stats[s];
+	}
+}
+
+static void StatsWriteJson(FILE* file)
+{
+	fprintf(file, "{\"frames\":%llu,\"per_frame\":{", StatsFrames);
+
+	for (int s = 0; s < STATS_AMOUNT; s++)
+	{
+		fprintf(file, "%s\"%s\":%.2f", s > 0 ? "," : "", STAT_NAMES[s],
+						StatsFrames > 0 ? (double)StatsTotal[s] / StatsFrames : 0);
+	}
+
+	fprintf(file, "},\"total\":{");
+
+	for (int s = 0; s < STATS_AMOUNT; s++)
+	{
+		fprintf(file, "%s\"%s\":%llu", s > 0 ? "," : "", STAT_NAMES[s],
+						StatsTotal[s]);
+	}
+
+	fprintf(file, "},\"scenes\":{");
+
+	for (int scene = 0; scene < 2; scene++)
+	{
+		fprintf(file, "%s\"%s\":{\"frames\":%llu", scene > 0 ? "," : "",
+						SCENE_NAMES[scene], StatsSceneFrames[scene]);
+
+		for (int s = 0; s < STATS_AMOUNT; s++)
+		{
+			fprintf(file, ",\"%s\":%.2f", STAT_NAMES[s],
+							StatsSceneFrames[scene] > 0
+									? (double)StatsScene[scene][s] / StatsSceneFrames[scene]
+									: 0);
+		}
+
+		fprintf(file, "}");
+	}
+
+	fprintf(file, "}}");
+}
+
+#ifdef RELEASE
+#	define StatsDraw(...)
+#else
+static void StatsDraw(void)
+{
+	if (!ProfileOverlayVisible)
+	{
+		return;
+	}
+
+	int lineHeight = PROFILE_FONT_SIZE + 2;
+	int width = PROFILE_FONT_SIZE * 18;
+	int x = ScreenWidth - width;
+	int y = ScreenHeight - lineHeight * (STATS_AMOUNT + 1) - Padding;
+
+	DrawRectangle(x - Padding, y - Padding, width + Padding,
+								lineHeight * (STATS_AMOUNT + 1) + Padding * 2,
+								Fade(BLACK, 0.7f));
+
+	DrawText(TextFormat("%-16s frame  %s avg", "counter",
+											SCENE_NAMES[CurrentScene]),
+					 x, y, PROFILE_FONT_SIZE, WHITE);
+
+	unsigned long long sceneFrames = fmax(StatsSceneFrames[CurrentScene], 1);
+
+	for (int s = 0; s < STATS_AMOUNT; s++)
+	{
+		y += lineHeight;
+		DrawText(TextFormat("%-16s %6u %9.1f", STAT_NAMES[s], StatsLastFrame[s],
+												(double)StatsScene[CurrentScene][s] / sceneFrames),
+						 x, y, PROFILE_FONT_SIZE, WHITE);
+	}
+}
+#endif	// RELEASE
+
+// Every raylib call pickle draws with goes through the counters, a macro can
+// use the function it shadows without recursing
+#define DrawRectangle(...) \
+	(StatDraw(STAT_MODE_QUADS, StatShapesTexture, 4), DrawRectangle(__VA_ARGS__))
+#define DrawRectangleRec(...)                       \
+	(StatDraw(STAT_MODE_QUADS, StatShapesTexture, 4), \
+	 DrawRectangleRec(__VA_ARGS__))
+#define DrawRectangleLines(...) \
+	(StatDraw(STAT_MODE_LINES, 0, 8), DrawRectangleLines(__VA_ARGS__))
+#define DrawRectangleLinesEx(...)                    \
+	(StatDraw(STAT_MODE_QUADS, StatShapesTexture, 16), \
+	 DrawRectangleLinesEx(__VA_ARGS__))
+#define DrawLine(...) (StatDraw(STAT_MODE_LINES, 0, 2), DrawLine(__VA_ARGS__))
+#define DrawLineEx(...) \
+	(StatDraw(STAT_MODE_TRIANGLES, 0, 6), DrawLineEx(__VA_ARGS__))
+#define DrawTriangle(...) \
+	(StatDraw(STAT_MODE_QUADS, StatShapesTexture, 4), DrawTriangle(__VA_ARGS__))
+#define DrawTriangleLines(...) \
+	(StatDraw(STAT_MODE_LINES, 0, 6), DrawTriangleLines(__VA_ARGS__))
+#define DrawCircleV(...)                             \
+	(StatDraw(STAT_MODE_QUADS, StatShapesTexture, 72), \
+	 DrawCircleV(__VA_ARGS__))
+#define DrawCircleSector(...) \
+	(StatCircleSector(__VA_ARGS__), DrawCircleSector(__VA_ARGS__))
+#define DrawRing(...) (StatRing(__VA_ARGS__), DrawRing(__VA_ARGS__))
+#define DrawTexturePro(texture, ...)           \
+	(StatDraw(STAT_MODE_QUADS, (texture).id, 4), \
+	 DrawTexturePro(texture, __VA_ARGS__))
+#define DrawText(text, ...)                               \
+	(StatDraw(STAT_MODE_QUADS, GetFontDefault().texture.id, \
+						StatGlyphs(text) * 4),                        \
+	 DrawText(text, __VA_ARGS__))
+#define DrawTextEx(font, text, ...)                                    \
+	(StatDraw(STAT_MODE_QUADS, (font).texture.id, StatGlyphs(text) * 4), \
+	 DrawTextEx(font, text, __VA_ARGS__))
+#define DrawTextPro(font, text, ...)                                   \
+	(StatDraw(STAT_MODE_QUADS, (font).texture.id, StatGlyphs(text) * 4), \
+	 DrawTextPro(font, text, __VA_ARGS__))
+#define MeasureTextEx(...) \
+	(Stats[STAT_MEASURE_TEXT]++, MeasureTextEx(__VA_ARGS__))
+
+#endif	// PICKLE_STATS
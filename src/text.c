@@ -0,0 +1,312 @@
+#ifndef PICKLE_TEXT
+#define PICKLE_TEXT
+
+#include <math.h>
+
+#include "../raylib/src/rlgl.h"
+#include "globals.c"
+#include "assets.c"
+#include "stats.c"
+
+// The atlas glyphs are found through a small open addressing table, so no
+// lookup searches the glyph list like GetGlyphIndex does
+#define TEXT_GLYPHS 256
+// must be a power of two and at least twice TEXT_GLYPHS
+#define TEXT_SLOTS 512
+// codepoints below this, ascii and latin-1, skip the hash table
+#define TEXT_DIRECT_SIZE 256
+
+typedef struct
+{
+	// includes the padding, so it is drawn as is
+	Rectangle Source;
+	float OffsetX;
+	float OffsetY;
+	float Advance;
+} TextGlyph;
+
+typedef struct
+{
+	int Codepoint;
+	TextGlyph Glyph;
+} TextEntry;
+
+static TextEntry TextEntries[TEXT_GLYPHS] = {0};
+// entry index plus one, zero is an empty slot
+static unsigned short TextSlots[TEXT_SLOTS] = {0};
+// NULL when the atlas does not have the glyph
+static TextGlyph* TextDirect[TEXT_DIRECT_SIZE] = {0};
+
+static unsigned int TextHash(int codepoint)
+{
+	return ((unsigned int)codepoint * 2654435761u) & (TEXT_SLOTS - 1);
+}
+
+static TextEntry* TextFind(int codepoint)
+{
+	for (unsigned int slot = TextHash(codepoint); TextSlots[slot] != 0;
+			 slot = (slot + 1) & (TEXT_SLOTS - 1))
+	{
+		TextEntry* entry = &TextEntries[TextSlots[slot] - 1];
+
+		if (entry->Codepoint == codepoint)
+		{
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void TextInsert(int entryIndex)
+{
+	TextEntry* entry = &TextEntries[entryIndex];
+	unsigned int slot = TextHash(entry->Codepoint);
+
+	while (TextSlots[slot] != 0)
+	{
+		slot = (slot + 1) & (TEXT_SLOTS - 1);
+	}
+
+	TextSlots[slot] = entryIndex + 1;
+
+	if ((unsigned int)entry->Codepoint < TEXT_DIRECT_SIZE)
+	{
+		TextDirect[entry->Codepoint] = &entry->Glyph;
+	}
+}
+
+// stands in for glyphs the atlas does not have, half an em of nothing
+static TextGlyph TextMissing = {{0, 0, 0, 0}, 0, 0, IOSEVKA_BASE_SIZE / 2};
+
+static void LoadText(void)
+{
+	int count = fmin(Fonte.glyphCount, TEXT_GLYPHS);
+
+	for (int i = 0; i < count; i++)
+	{
+		float padding = Fonte.glyphPadding;
+		Rectangle rec = Fonte.recs[i];
+		TextEntries[i].Codepoint = Fonte.glyphs[i].value;
+		TextEntries[i].Glyph = (TextGlyph){
+				{rec.x - padding, rec.y - padding, rec.width + padding * 2,
+				 rec.height + padding * 2},
+				Fonte.glyphs[i].offsetX - padding,
+				Fonte.glyphs[i].offsetY - padding,
+				Fonte.glyphs[i].advanceX != 0 ? Fonte.glyphs[i].advanceX : rec.width,
+		};
+		TextInsert(i);
+	}
+}
+
+// never NULL, glyphs the atlas does not have give TextMissing
+static TextGlyph* TextFindGlyph(int codepoint)
+{
+	if ((unsigned int)codepoint < TEXT_DIRECT_SIZE)
+	{
+		return TextDirect[codepoint] != NULL ? TextDirect[codepoint]
+																				 : &TextMissing;
+	}
+
+	TextEntry* entry = TextFind(codepoint);
+
+	return entry != NULL ? &entry->Glyph : &TextMissing;
+}
+
+// decodes the next character, ascii without calling into raylib
+static int TextNextCodepoint(const char* text, int* size)
+{
+	if ((unsigned char)*text < 0x80)
+	{
+		*size = 1;
+		return *text;
+	}
+
+	return GetCodepointNext(text, size);
+}
+
+// whether a text field should take the character
+static bool TextCanDraw(int codepoint)
+{
+	return codepoint >= ' ' && codepoint != 0x7f && TextFind(codepoint) != NULL;
+}
+
+// same metrics as MeasureTextEx
+static Vector2 TextMeasure(const char* text, float fontSize, float spacing)
+{
+	float width = 0;
+	int count = 0;
+
+	Stats[STAT_MEASURE_TEXT]++;
+
+	for (int size = 0; *text != '\0'; text += size, count++)
+	{
+		width += TextFindGlyph(TextNextCodepoint(text, &size))->Advance;
+	}
+
+	return (Vector2){width * fontSize / Fonte.baseSize +
+											 (count > 0 ? (count - 1) * spacing : 0),
+									 fontSize};
+}
+
+// Draws like DrawTextPro, every glyph is rotated around position on its own
+static void TextDrawPro(const char* text,
+												Vector2 position,
+												Vector2 origin,
+												float rotation,
+												float fontSize,
+												float spacing,
+												Color tint)
+{
+	float scale = fontSize / Fonte.baseSize;
+	float offset = 0;
+
+	for (int size = 0; *text != '\0'; text += size)
+	{
+		TextGlyph* glyph = TextFindGlyph(TextNextCodepoint(text, &size));
+
+		// spaces and missing glyphs have nothing to draw
+		if (glyph->Source.width > 0 && *text != ' ')
+		{
+			Rectangle destination = {position.x, position.y,
+															 glyph->Source.width * scale,
+															 glyph->Source.height * scale};
+			Vector2 glyphOrigin = {origin.x - offset - glyph->OffsetX * scale,
+														 origin.y - glyph->OffsetY * scale};
+			DrawTexturePro(Fonte.texture, glyph->Source, destination, glyphOrigin,
+										 rotation, tint);
+		}
+
+		offset += glyph->Advance * scale + spacing;
+	}
+}
+
+// Glyph quads laid out once in their own space and drawn every frame with a
+// single transform, for text that moves but rarely changes
+typedef struct
+{
+	Vector2 Corners[4];
+	// texture coordinates, already divided by the texture size
+	Rectangle Source;
+	Color Tint;
+} TextQuad;
+
+typedef struct
+{
+	TextQuad* Quads;
+	int Capacity;
+	int Count;
+} TextMesh;
+
+static void TextMeshClear(TextMesh* mesh)
+{
+	mesh->Count = 0;
+}
+
+// Lays the text out like TextDrawPro would draw it, returns false and adds
+// nothing when the mesh is out of room
+static bool TextMeshAdd(TextMesh* mesh,
+												const char* text,
+												Vector2 position,
+												Vector2 origin,
+												float rotation,
+												float fontSize,
+												float spacing,
+												Color tint)
+{
+	float scale = fontSize / Fonte.baseSize;
+	float cosRotation = cosf(rotation * DEG2RAD);
+	float sinRotation = sinf(rotation * DEG2RAD);
+	float offset = 0;
+	int count = mesh->Count;
+
+	for (int size = 0; *text != '\0'; text += size)
+	{
+		TextGlyph* glyph = TextFindGlyph(TextNextCodepoint(text, &size));
+
+		if (glyph->Source.width > 0 && *text != ' ')
+		{
+			if (count == mesh->Capacity)
+			{
+				return false;
+			}
+
+			Texture2D texture = Fonte.texture;
+			TextQuad* quad = &mesh->Quads[count++];
+			float left = offset + glyph->OffsetX * scale - origin.x;
+			float top = glyph->OffsetY * scale - origin.y;
+			float right = left + glyph->Source.width * scale;
+			float bottom = top + glyph->Source.height * scale;
+			// same corner order as DrawTexturePro
+			float x[4] = {left, left, right, right};
+			float y[4] = {top, bottom, bottom, top};
+
+			for (int c = 0; c < 4; c++)
+			{
+				quad->Corners[c] =
+						(Vector2){position.x + x[c] * cosRotation - y[c] * sinRotation,
+											position.y + x[c] * sinRotation + y[c] * cosRotation};
+			}
+
+			quad->Source = (Rectangle){glyph->Source.x / texture.width,
+																 glyph->Source.y / texture.height,
+																 glyph->Source.width / texture.width,
+																 glyph->Source.height / texture.height};
+			quad->Tint = tint;
+		}
+
+		offset += glyph->Advance * scale + spacing;
+	}
+
+	mesh->Count = count;
+	return true;
+}
+
+// the whole mesh is a single batch
+static void TextMeshDraw(const TextMesh* mesh, Vector2 position, float rotation)
+{
+	if (mesh->Count == 0)
+	{
+		return;
+	}
+
+	rlPushMatrix();
+	rlTranslatef(position.x, position.y, 0);
+	rlRotatef(rotation, 0, 0, 1);
+	rlSetTexture(Fonte.texture.id);
+	rlBegin(RL_QUADS);
+
+	for (int i = 0; i < mesh->Count; i++)
+	{
+		const TextQuad* quad = &mesh->Quads[i];
+		Rectangle source = quad->Source;
+		float u[4] = {source.x, source.x, source.x + source.width,
+									source.x + source.width};
+		float v[4] = {source.y, source.y + source.height, source.y + source.height,
+									source.y};
+
+		rlColor4ub(quad->Tint.r, quad->Tint.g, quad->Tint.b, quad->Tint.a);
+
+		for (int c = 0; c < 4; c++)
+		{
+			rlTexCoord2f(u[c], v[c]);
+			rlVertex2f(quad->Corners[c].x, quad->Corners[c].y);
+		}
+	}
+
+	rlEnd();
+	StatDraw(STAT_MODE_QUADS, Fonte.texture.id, mesh->Count * 4);
+	rlSetTexture(0);
+	rlPopMatrix();
+}
+
+static void TextDraw(const char* text,
+										 Vector2 position,
+										 float fontSize,
+										 float spacing,
+										 Color tint)
+{
+	TextDrawPro(text, position, (Vector2){0, 0}, 0, fontSize, spacing, tint);
+}
+
+#endif	// PICKLE_TEXT
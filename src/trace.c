@@ -0,0 +1,181 @@
+#ifndef PICKLE_TRACE
+#define PICKLE_TRACE
+
+#include <stdio.h>
+#include <time.h>
+
+#include "globals.c"
+#include "log.c"
+
+#ifndef TRACE_DEFAULT_FRAMES
+#	define TRACE_DEFAULT_FRAMES 600
+#endif
+
+// Chrome trace-event capture, loads in https://ui.perfetto.dev and
+// chrome://tracing
+#ifdef RELEASE
+#	define TraceStart(frames) (void)(frames)
+#	define TraceComplete(...)
+#	define TraceInstant(...)
+#	define TraceCounter(...)
+#	define TraceFrameEnd(...)
+#else
+// events are preallocated so capturing does not allocate mid frame
+#	ifndef TRACE_MAX_EVENTS
+#		define TRACE_MAX_EVENTS 65536
+#	endif
+
+typedef struct
+{
+	const char* Name;
+	const char* Category;
+	char Phase;
+	double Timestamp;
+	double Duration;
+	double Value;
+} TraceEvent;
+
+static TraceEvent TraceEvents[TRACE_MAX_EVENTS];
+static int TraceEventCount = 0;
+static int TraceDroppedCount = 0;
+static int TraceFramesLeft = 0;
+
+static const char* POPUP_NAMES[] = {"Popup none", "Popup waiting",
+																		"Popup dismissible"};
+
+static void TraceStart(int frames)
+{
+	if (TraceFramesLeft > 0 || frames <= 0)
+	{
+		return;
+	}
+
+	TraceEventCount = 0;
+	TraceDroppedCount = 0;
+	TraceFramesLeft = frames;
+}
+
+static void TracePush(TraceEvent event)
+{
+	if (TraceFramesLeft <= 0)
+	{
+		return;
+	}
+
+	if (TraceEventCount >= TRACE_MAX_EVENTS)
+	{
+		TraceDroppedCount++;
+		return;
+	}
+
+	TraceEvents[TraceEventCount++] = event;
+}
+
+// name and category must outlive the capture, they are not copied
+#	define TraceComplete(category, name, start, duration) \
+		TracePush((TraceEvent){name, category, 'X', start, duration, 0})
+
+#	define TraceInstant(category, name, value) \
+		TracePush((TraceEvent){name, category, 'i', GetTime(), 0, value})
+
+#	define TraceCounter(name, value) \
+		TracePush((TraceEvent){name, "counter", 'C', GetTime(), 0, value})
+
+static void TraceWrite(void)
+{
+	char fileName[64];
+	snprintf(fileName, sizeof(fileName), "pickle-trace-%ld.json",
+					 (long)time(NULL));
+
+	FILE* file = fopen(fileName, "w");
+
+	if (file == NULL)
+	{
+		TraceLog(LOG_WARNING, "TRACE: Could not open %s", fileName);
+		return;
+	}
+
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	for (int i = 0; i < TraceEventCount; i++)
+	{
+		TraceEvent* event = &TraceEvents[i];
+
+		fprintf(file,
+						"%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,"
+						"\"pid\":1,\"tid\":1",
+						i > 0 ? ",\n" : "", event->Name, event->Category, event->Phase,
+						event->Timestamp * 1e6);
+
+		switch (event->Phase)
+		{
+			case 'X':
+				fprintf(file, ",\"dur\":%.3f}", event->Duration * 1e6);
+				break;
+			case 'i':
+				fprintf(file, ",\"s\":\"t\",\"args\":{\"value\":%g}}", event->Value);
+				break;
+			default:
+				fprintf(file, ",\"args\":{\"value\":%g}}", event->Value);
+				break;
+		}
+	}
+
+	fprintf(file, "\n]}\n");
+	fclose(file);
+
+	TraceLog(LOG_INFO, "TRACE: Wrote %d events to %s (%d dropped)",
+					 TraceEventCount, fileName, TraceDroppedCount);
+}
+
+// records the wheel state machine, called once per frame
+static void TraceWheel(void)
+{
+	static int lastPickedIndex = STATE_NO_WINNER;
+	static PopupEnum lastPopupState = POPUP_NONE;
+
+	if (WheelPickedIndex != lastPickedIndex)
+	{
+		TraceInstant("spin",
+								 WheelPickedIndex == STATE_SPINNING	 ? "Spin started"
+								 : WheelPickedIndex >= STATE_WINNER ? "Winner picked"
+																										: "Spin reset",
+								 WheelPickedIndex);
+		lastPickedIndex = WheelPickedIndex;
+	}
+
+	if (PopupState != lastPopupState)
+	{
+		TraceInstant("spin", POPUP_NAMES[PopupState], PopupState);
+		lastPopupState = PopupState;
+	}
+
+	if (WheelAcceleration > 0)
+	{
+		TraceCounter("WheelAcceleration", WheelAcceleration);
+		TraceCounter("WheelAngle", WheelAngle);
+	}
+}
+
+static void TraceFrameEnd(void)
+{
+	if (IsKeyPressed(KEY_F4))
+	{
+		TraceStart(TRACE_DEFAULT_FRAMES);
+	}
+
+	TraceWheel();
+
+	if (TraceFramesLeft > 0)
+	{
+		LogAppend("TRACE: Capturing, %d frames left\n", TraceFramesLeft);
+
+		if (--TraceFramesLeft == 0)
+		{
+			TraceWrite();
+		}
+	}
+}
+#endif	// RELEASE
+
+#endif	// PICKLE_TRACE
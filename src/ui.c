@@ -0,0 +1,188 @@
+#ifndef PICKLE_UI
+#define PICKLE_UI
+
+#include <string.h>
+
+#include "globals.c"
+#include "commands.c"
+#include "draw.c"
+#include "log.c"
+#include "profile.c"
+#include "stats.c"
+
+// The menu is laid out once per screen size instead of every frame. Every
+// entry shares the same layout relative to its top, so adding, removing or
+// scrolling slices only moves entries and never lays anything out again
+#define UI_WIDGET_LIST       \
+	X(Corner, CORNER)          \
+	X(Undo, UNDO)              \
+	X(Entry, ENTRY)            \
+	X(EntryName, ENTRY_NAME)   \
+	X(EntryTrash, ENTRY_TRASH) \
+	X(EntryPalette, ENTRY_PALETTE)
+
+#define X(Name, NAME) UI_##NAME,
+enum UiWidgetEnum
+{
+	UI_WIDGET_LIST
+	// the rest of the palette follows its first color
+	UI_WIDGETS_AMOUNT = UI_ENTRY_PALETTE + COLORS_AMOUNT
+};
+#undef X
+
+typedef struct
+{
+	// the screen size the layout was made for
+	int ScreenWidth;
+	int ScreenHeight;
+	int SquareButtonSize;
+	int SidePadding;
+	int VisibleEntries;
+	int EntryHeight;
+	int WheelRadius;
+	// the shadow buttons and the text field are raised with, the border deep
+	ShadowStyle Shadow;
+	// entry widgets are relative to the top of their entry
+	Rectangle Rects[UI_WIDGETS_AMOUNT];
+} UiLayout;
+
+static UiLayout Ui = {0};
+// Only written with the layout, a frame only picks the border of the selected
+// color and the slice the command is for
+static Button UiPaletteColumns[PALETTE_ROW_AMOUNT][PALETTE_COL_AMOUNT];
+static ButtonRow UiPalette[PALETTE_ROW_AMOUNT];
+static GridLayout UiPaletteLayout = GRID_LAYOUT_EMPTY;
+
+#ifdef RELEASE
+#	define UiPaletteCheck()
+#	define UiPaletteSeal()
+#else
+static unsigned int UiPaletteHash = 0;
+
+static unsigned int UiPaletteHashGet(void)
+{
+	const unsigned char* bytes = (const unsigned char*)UiPaletteColumns;
+	unsigned int hash = 2166136261u;
+
+	for (size_t i = 0; i < sizeof(UiPaletteColumns); i++)
+	{
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+
+	return hash;
+}
+
+static void UiPaletteSeal(void)
+{
+	UiPaletteHash = UiPaletteHashGet();
+}
+
+// call after drawing the menu, the palette must be the one the layout built
+static void UiPaletteCheck(void)
+{
+	LogIf(UiPaletteHashGet() != UiPaletteHash,
+				LogAppend("ERROR: The palette changed outside of the layout!\n"));
+}
+#endif
+
+// call once the screen information is updated, it returns right away unless
+// the screen changed size
+static void UiLayoutUpdate(void)
+{
+	if (Ui.ScreenWidth == ScreenWidth && Ui.ScreenHeight == ScreenHeight)
+	{
+		return;
+	}
+
+	ProfileBegin(ZONE_LAYOUT);
+
+	bool portrait = ScreenWidth < ScreenHeight;
+	int squareButtonSize = (portrait ? ScreenWidth : ScreenHeight) / 8;
+	int sidePadding = squareButtonSize + Padding;
+	int menuX = portrait ? 0 : sidePadding;
+	int menuEntryWidth = ScreenWidth - (portrait ? sidePadding : sidePadding * 2);
+	// the height TextMeasure gives for a name
+	int nameHeight = FontSize * 2;
+
+	Ui.ScreenWidth = ScreenWidth;
+	Ui.ScreenHeight = ScreenHeight;
+	Ui.SquareButtonSize = squareButtonSize;
+	Ui.SidePadding = sidePadding;
+	Ui.VisibleEntries = portrait ? 6 : 3;
+	Ui.EntryHeight = ScreenHeight / Ui.VisibleEntries;
+	Ui.WheelRadius = portrait ? ScreenWidth / 2 - ScreenWidth / 16
+														: ScreenHeight / 2 - ScreenHeight / 32;
+	Ui.Shadow = (ShadowStyle){Border, SHADOW_COLOR, ShadowKind_Float};
+
+	Ui.Rects[UI_CORNER] =
+			(Rectangle){ScreenWidth - squareButtonSize - Padding, Padding,
+									squareButtonSize, squareButtonSize};
+	Ui.Rects[UI_UNDO] = Ui.Rects[UI_CORNER];
+	Ui.Rects[UI_UNDO].y += squareButtonSize + Padding;
+	Ui.Rects[UI_ENTRY] =
+			(Rectangle){menuX, 0, menuEntryWidth, Ui.EntryHeight};
+	Ui.Rects[UI_ENTRY_NAME] = (Rectangle){
+			menuX + Padding, Padding, menuEntryWidth - sidePadding * 2, nameHeight};
+	Ui.Rects[UI_ENTRY_TRASH] =
+			(Rectangle){menuX + menuEntryWidth - sidePadding, Padding,
+									squareButtonSize, squareButtonSize};
+
+	for (int r = 0; r < PALETTE_ROW_AMOUNT; r++)
+	{
+		UiPalette[r] = (ButtonRow){PERCENT(PALETTE_ROW_PERCENTAGE),
+															 PALETTE_COL_AMOUNT, UiPaletteColumns[r]};
+
+		for (int c = 0; c < PALETTE_COL_AMOUNT; c++)
+		{
+			int color = r * PALETTE_COL_AMOUNT + c;
+			Button* button = &UiPaletteColumns[r][c];
+
+			// zeroed so the padding hashes the same every time
+			memset(button, 0, sizeof(*button));
+			button->Width = PERCENT(PALETTE_COL_PERCENTAGE);
+			button->Text = "";
+			button->FontSize = FontSize;
+			button->TextColor = FOREGROUND_COLOR;
+			button->BackgroundColor = COLORS[color];
+			button->PressedColor = COLORS[color];
+			button->HoveredColor = COLORS[color];
+			button->BorderColor = GetContrastedTextColor(COLORS[color]);
+			button->BorderThickness = Border;
+			button->ShadowStyle = Ui.Shadow;
+			button->Icon = NO_ICON;
+			button->Command = COMMAND(RECOLOR, 0, color);
+		}
+	}
+
+	UiPaletteSeal();
+
+	LAYOUT_GRID(&UiPaletteLayout, menuEntryWidth - sidePadding - Padding,
+							Ui.EntryHeight - nameHeight - Padding * 4, Padding, UiPalette,
+							PALETTE_ROW_AMOUNT, ColumnAmount);
+
+	for (int c = 0; c < COLORS_AMOUNT && c < UiPaletteLayout.Count; c++)
+	{
+		Rectangle cell = UiPaletteLayout.Cells[c];
+		Ui.Rects[UI_ENTRY_PALETTE + c] =
+				(Rectangle){menuX + Padding + cell.x, nameHeight + Padding * 2 + cell.y,
+										cell.width, cell.height};
+	}
+
+	ProfileEnd(ZONE_LAYOUT);
+}
+
+// a widget of the entry whose top is at entryY
+static Rectangle UiEntryRect(int widget, float entryY)
+{
+	Rectangle rect = Ui.Rects[widget];
+	rect.y += entryY;
+	return rect;
+}
+
+// the hit id of a widget, the ones outside the entries use entry 0
+static int UiId(int widget, int entry)
+{
+	return entry * UI_WIDGETS_AMOUNT + widget;
+}
+
+#endif	// PICKLE_UI
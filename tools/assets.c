@@ -0,0 +1,262 @@
+// Generates the headers in assets/ from the source images and fonts, the data
+// is const, already in the pixel format pickle uploads and optionally DEFLATE
+// compressed. Built and run on the host with ./build.sh linux -a. A notice in
+// <input>.license, like the license of a font, is copied to the top of the
+// header
+//
+//   assets image <input.png> <output.h> <NAME> [-z]
+//   assets font <input.ttf> <output.h> <NAME> <size> <glyphs> [-z]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "../raylib/src/raylib.h"
+
+// enough for bilinear filtering, glyphs end up twice this apart
+#define ASSETS_GLYPH_PADDING 2
+
+static void WriteBytes(FILE* file,
+											 const char* name,
+											 const unsigned char* data,
+											 int size)
+{
+	fprintf(file, "static const unsigned char %s_DATA[%d] = {", name, size);
+
+	for (int i = 0; i < size; i++)
+	{
+		fprintf(file, "%s0x%02x,", i % 16 == 0 ? "\n\t" : " ", data[i]);
+	}
+
+	fprintf(file, "\n};\n");
+}
+
+// raw DEFLATE like CompressData writes, so DecompressData reads it back, but
+// zlib gives the same bytes whichever raylib the tool is built against
+static unsigned char* Deflate(const unsigned char* data,
+															int size,
+															int* compressedSize)
+{
+	z_stream stream = {0};
+	deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -15, 8,
+							 Z_DEFAULT_STRATEGY);
+
+	int bound = deflateBound(&stream, size);
+	unsigned char* compressed = malloc(bound);
+
+	stream.next_in = (unsigned char*)data;
+	stream.avail_in = size;
+	stream.next_out = compressed;
+	stream.avail_out = bound;
+	deflate(&stream, Z_FINISH);
+	*compressedSize = stream.total_out;
+	deflateEnd(&stream);
+
+	return compressed;
+}
+
+// writes the image as is, or compressed when asked and it is smaller
+static void WriteImage(FILE* file, const char* name, Image image, bool compress)
+{
+	int size = GetPixelDataSize(image.width, image.height, image.format);
+	int compressedSize = 0;
+	unsigned char* compressed = NULL;
+
+	if (compress)
+	{
+		compressed = Deflate(image.data, size, &compressedSize);
+
+		if (compressedSize >= size)
+		{
+			free(compressed);
+			compressed = NULL;
+			compressedSize = 0;
+		}
+	}
+
+	fprintf(file, "#define %s_WIDTH %d\n", name, image.width);
+	fprintf(file, "#define %s_HEIGHT %d\n", name, image.height);
+	fprintf(file, "#define %s_FORMAT %d\n", name, image.format);
+	fprintf(file, "#define %s_SIZE %d\n", name, size);
+	fprintf(file, "// zero when the data is not compressed\n");
+	fprintf(file, "#define %s_COMPRESSED_SIZE %d\n\n", name, compressedSize);
+
+	if (compressed != NULL)
+	{
+		WriteBytes(file, name, compressed, compressedSize);
+		free(compressed);
+	}
+	else
+	{
+		WriteBytes(file, name, image.data, size);
+	}
+}
+
+static FILE* OpenHeader(const char* output, const char* input)
+{
+	FILE* file = fopen(output, "w");
+
+	if (file == NULL)
+	{
+		TraceLog(LOG_ERROR, "ASSETS: Could not open %s", output);
+		exit(1);
+	}
+
+	fprintf(file, "// Generated by tools/assets.c from %s, do not edit\n\n",
+					input);
+
+	char path[256];
+	snprintf(path, sizeof(path), "%s.license", input);
+	FILE* notice = fopen(path, "r");
+
+	if (notice == NULL)
+	{
+		return file;
+	}
+
+	char line[256];
+
+	while (fgets(line, sizeof(line), notice) != NULL)
+	{
+		if (line[0] == '\n')
+		{
+			fprintf(file, "//\n");
+		}
+		else
+		{
+			fprintf(file, "// %s", line);
+		}
+	}
+
+	fprintf(file, "\n");
+	fclose(notice);
+	return file;
+}
+
+static int GenerateImage(const char* input,
+												 const char* output,
+												 const char* name,
+												 bool compress)
+{
+	Image image = LoadImage(input);
+
+	if (image.data == NULL)
+	{
+		return 1;
+	}
+
+	// textures and the window icon both want rgba
+	ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+	FILE* file = OpenHeader(output, input);
+	WriteImage(file, name, image, compress);
+	fclose(file);
+	UnloadImage(image);
+
+	return 0;
+}
+
+// bakes only the given glyphs into a tightly packed single channel atlas
+static int GenerateFont(const char* input,
+												const char* output,
+												const char* name,
+												int fontSize,
+												const char* text,
+												bool compress)
+{
+	int fileSize = 0;
+	unsigned char* fileData = LoadFileData(input, &fileSize);
+
+	if (fileData == NULL)
+	{
+		return 1;
+	}
+
+	int glyphCount = 0;
+	int* codepoints = LoadCodepoints(text, &glyphCount);
+	GlyphInfo* glyphs = LoadFontData(fileData, fileSize, fontSize, codepoints,
+																	 glyphCount, FONT_DEFAULT);
+	Rectangle* recs = NULL;
+	// skyline packing wastes less space than the default row packing
+	Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCount, fontSize,
+																	ASSETS_GLYPH_PADDING, 1);
+	int height = 0;
+
+	for (int i = 0; i < glyphCount; i++)
+	{
+		int bottom = recs[i].y + recs[i].height + ASSETS_GLYPH_PADDING;
+		height = bottom > height ? bottom : height;
+	}
+
+	// the atlas is white with the coverage in alpha, only the alpha is kept
+	unsigned char* pixels = atlas.data;
+
+	for (int i = 0; i < atlas.width * height; i++)
+	{
+		pixels[i] = pixels[i * 2 + 1];
+	}
+
+	atlas.height = height;
+	atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+	FILE* file = OpenHeader(output, input);
+	fprintf(file, "#define %s_BASE_SIZE %d\n", name, fontSize);
+	fprintf(file, "#define %s_GLYPH_COUNT %d\n", name, glyphCount);
+	fprintf(file, "#define %s_GLYPH_PADDING %d\n", name, ASSETS_GLYPH_PADDING);
+	WriteImage(file, name, atlas, compress);
+
+	fprintf(file, "\nstatic const Rectangle %s_RECS[%d] = {\n", name,
+					glyphCount);
+
+	for (int i = 0; i < glyphCount; i++)
+	{
+		fprintf(file, "\t{%g, %g, %g, %g},\n", recs[i].x, recs[i].y,
+						recs[i].width, recs[i].height);
+	}
+
+	fprintf(file, "};\n\n// glyph images are in the atlas\n");
+	fprintf(file, "static const GlyphInfo %s_GLYPHS[%d] = {\n", name,
+					glyphCount);
+
+	for (int i = 0; i < glyphCount; i++)
+	{
+		fprintf(file, "\t{%d, %d, %d, %d, {0}},\n", glyphs[i].value,
+						glyphs[i].offsetX, glyphs[i].offsetY, glyphs[i].advanceX);
+	}
+
+	fprintf(file, "};\n");
+	fclose(file);
+
+	UnloadImage(atlas);
+	UnloadFontData(glyphs, glyphCount);
+	UnloadCodepoints(codepoints);
+	MemFree(recs);
+	UnloadFileData(fileData);
+
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	bool compress = strcmp(argv[argc - 1], "-z") == 0;
+	int args = argc - compress;
+
+	SetTraceLogLevel(LOG_WARNING);
+
+	if (args == 5 && strcmp(argv[1], "image") == 0)
+	{
+		return GenerateImage(argv[2], argv[3], argv[4], compress);
+	}
+	else if (args == 7 && strcmp(argv[1], "font") == 0)
+	{
+		return GenerateFont(argv[2], argv[3], argv[4], atoi(argv[5]), argv[6],
+												compress);
+	}
+
+	printf(
+			"%s image <input.png> <output.h> <NAME> [-z]\n"
+			"%s font <input.ttf> <output.h> <NAME> <size> <glyphs> [-z]\n",
+			argv[0], argv[0]);
+	return 1;
+}